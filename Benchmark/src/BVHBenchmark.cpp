@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+#include <PWMath/BVH.h>
+#include <PWMath/Triangle.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunBVHBenchmarks()
+	{
+		using namespace PWMath;
+
+		std::mt19937 random{ 3 };
+		std::uniform_real_distribution<float> position{ -1000.0f, 1000.0f }, size{ 0.5f, 5.0f }, direction{ -1.0f, 1.0f };
+
+		// Build time grows with the primitive count, so it is measured over a few orders of magnitude
+		for (size_t count : { size_t{ 1000 }, size_t{ 10000 }, size_t{ 100000 }, size_t{ 1000000 } })
+		{
+			std::vector<AABBF32> boxes(count);
+			for (auto& box : boxes)
+			{
+				const Vector3F32 center{ position(random), position(random), position(random) };
+				const Vector3F32 extent{ size(random), size(random), size(random) };
+				box = AABBF32{ center - extent, center + extent };
+			}
+
+			char name[64];
+			std::snprintf(name, sizeof(name), "BVH build (%zu boxes)", count);
+			Run(name, "boxes", count, [&]() { return BuildBVH(boxes.data(), count).nodes.size(); });
+
+			BVHF32 bvh = BuildBVH(boxes.data(), count);
+			std::snprintf(name, sizeof(name), "BVH refit (%zu boxes)", count);
+			Run(name, "boxes", count, [&]() { Refit(bvh, boxes.data()); return bvh.nodes.size(); });
+
+			// Rays through the scene, each stops at the nearest box it enters
+			constexpr size_t rayCount = 1024;
+			std::vector<RayF32> rays;
+			for (size_t i = 0; i < rayCount; ++i)
+				rays.push_back(RayF32{ { position(random), position(random), position(random) }, { direction(random), direction(random), direction(random) } });
+
+			std::snprintf(name, sizeof(name), "BVH ray traversal (%zu boxes)", count);
+			Run(name, "rays", rayCount, [&]()
+			{
+				size_t hits = 0;
+				for (const auto& ray : rays)
+				{
+					hits += Intersect(bvh, ray, 4000.0f, [&](uint32_t index, float& maxDistance)
+					{
+						float entry;
+						if (!Intersects(ray, boxes[index], maxDistance, entry))
+							return false;
+						maxDistance = entry;
+						return true;
+					});
+				}
+				return hits;
+			});
+		}
+	}
+}
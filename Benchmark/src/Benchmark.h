@@ -0,0 +1,136 @@
+#pragma once
+#include "PerfCounters.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+	// Results are added into this so the compiler can't remove the work being measured
+	inline volatile uint64_t sink = 0;
+
+	// Set from the command line, see Main.cpp
+	struct Options
+	{
+		const char* filter = nullptr;	// Only benchmarks with this in their name are run
+		double minSeconds = -1.0;		// Overrides the minSeconds passed to Run when 0 or more
+		bool counters = false;			// Counts hardware events over the timed calls, see PerfCounters
+	};
+	inline Options options;
+
+	// One measurement made by Run, written to the JSON report
+	struct Result
+	{
+		std::string name;
+		std::string unit;
+		double itemsPerSecond;
+		size_t calls;
+		double seconds;
+		size_t items;				// Over all the timed calls
+		double bytesPerItem;		// Memory traffic per item, 0 when not given
+		bool counted;				// counts holds the PerfCounters events (0 for the unavailable ones)
+		uint64_t counts[static_cast<size_t>(Counter::Count)];
+	};
+	inline std::vector<Result> results;
+
+	// Prints a result on one line, followed by its per item counts when it was counted
+	void PrintResult(const Result& result);
+
+	// Calls function until at least minSeconds have passed and prints how many items were processed per second
+	// Notes:
+	//  - function processes itemsPerCall items each call and returns a value depending on the work done
+	//  - One untimed call is made first to warm the caches
+	//  - Benchmarks filtered out by options.filter are skipped, every run is added to results
+	//  - With bytesPerItem the bandwidth is printed too
+	//  - With options.counters the hardware events of the timed calls are printed per item
+	template<typename Function>
+	void Run(const char* name, const char* unit, size_t itemsPerCall, Function&& function, double minSeconds = 0.25, double bytesPerItem = 0.0)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		if (options.filter && !std::strstr(name, options.filter))
+			return;
+		if (options.minSeconds >= 0.0)
+			minSeconds = options.minSeconds;
+
+		sink = sink + static_cast<uint64_t>(function());
+
+		PerfCounters* counters = options.counters ? &GetPerfCounters() : nullptr;
+		if (counters)
+			counters->Start();
+
+		size_t calls = 0;
+		double seconds = 0.0;
+		const auto start = Clock::now();
+		do
+		{
+			sink = sink + static_cast<uint64_t>(function());
+			++calls;
+			seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		} while (seconds < minSeconds);
+
+		if (counters)
+			counters->Stop();
+
+		Result result{ name, unit, 0.0, calls, seconds, itemsPerCall * calls, bytesPerItem, counters != nullptr, {} };
+		result.itemsPerSecond = static_cast<double>(result.items) / seconds;
+		if (counters)
+		{
+			for (size_t i = 0; i < static_cast<size_t>(Counter::Count); ++i)
+				result.counts[i] = counters->Read(static_cast<Counter>(i));
+		}
+
+		PrintResult(result);
+		results.push_back(result);
+	}
+
+	// The first component of a scalar, vector or matrix, used as the value returned to Run
+	template<typename T>
+	auto FirstComponent(const T& value)
+	{
+		if constexpr (std::is_arithmetic_v<T>)
+			return value;
+		else
+			return FirstComponent(value[0]);
+	}
+
+	// Runs outputs[i] = function(i) over all the outputs each call (one "op" per output)
+	template<typename TOutput, typename Function>
+	void RunEach(const std::string& name, std::vector<TOutput>& outputs, Function&& function)
+	{
+		const size_t count = outputs.size();
+		Run(name.c_str(), "ops", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				outputs[i] = function(i);
+			return FirstComponent(outputs[count - 1]);
+		});
+	}
+
+	// Writes results as JSON to path, returns false if the file can't be written
+	bool WriteJson(const char* path);
+
+	void RunRayBenchmarks();
+	void RunTriangleBenchmarks();
+	void RunBVHBenchmarks();
+	void RunSphereBenchmarks();
+	void RunSpatialHashGridBenchmarks();
+	void RunKDTreeBenchmarks();
+	void RunViewportBenchmarks();
+	void RunProjectionBenchmarks();
+	void RunFixedBenchmarks();
+	void RunHalfBenchmarks();
+	void RunNormalEncodingBenchmarks();
+	void RunColorBenchmarks();
+	void RunRotationBenchmarks();
+	void RunVectorBenchmarks();
+	void RunMatrixBenchmarks();
+	void RunTransformBenchmarks();
+	void RunWorkingSetBenchmarks();
+}
@@ -0,0 +1,99 @@
+#include "Benchmark.h"
+#include <PWMath/Color.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	static uint8_t ToUnorm8(float value)
+	{
+		return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	void RunColorBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t colorCount = 1 << 20;
+
+		std::mt19937 random{ 11 };
+		std::uniform_int_distribution<uint32_t> channel{ 0, 255 };
+		std::vector<Vector4U8> pixels(colorCount);
+		for (auto& pixel : pixels)
+			pixel = Vector4U8{ static_cast<uint8_t>(channel(random)), static_cast<uint8_t>(channel(random)), static_cast<uint8_t>(channel(random)), static_cast<uint8_t>(channel(random)) };
+		std::vector<Vector4F32> colors(colorCount);
+		std::vector<Vector4U16> widePixels(colorCount);
+
+		Run("Vector4U8 -> Vector4F32 unorm (one at a time)", "colors", colorCount, [&]()
+		{
+			for (size_t i = 0; i < colorCount; ++i)
+				colors[i] = Vector4F32{ pixels[i] } * (1.0f / 255.0f);
+			return colors[colorCount - 1].r;
+		});
+		Run("Vector4U8 -> Vector4F32 unorm (DecodeColors)", "colors", colorCount, [&]()
+		{
+			DecodeColors(colors.data(), pixels.data(), colorCount);
+			return colors[colorCount - 1].r;
+		});
+		Run("Vector4U8 -> Vector4F32 sRGB (SrgbToLinear)", "colors", colorCount, [&]()
+		{
+			for (size_t i = 0; i < colorCount; ++i)
+			{
+				const Vector4U8 pixel = pixels[i];
+				colors[i] = Vector4F32{ SrgbToLinear(pixel.r / 255.0f), SrgbToLinear(pixel.g / 255.0f), SrgbToLinear(pixel.b / 255.0f), pixel.a / 255.0f };
+			}
+			return colors[colorCount - 1].r;
+		});
+		Run("Vector4U8 -> Vector4F32 sRGB (DecodeColors)", "colors", colorCount, [&]()
+		{
+			DecodeColors(colors.data(), pixels.data(), colorCount, ColorSpace::Srgb);
+			return colors[colorCount - 1].r;
+		});
+		Run("Vector4U8 -> Vector4F32 sRGB premul (DecodeColors)", "colors", colorCount, [&]()
+		{
+			DecodeColors(colors.data(), pixels.data(), colorCount, ColorSpace::Srgb, AlphaMode::Premultiplied);
+			return colors[colorCount - 1].r;
+		});
+
+		Run("Vector4F32 -> Vector4U8 unorm (one at a time)", "colors", colorCount, [&]()
+		{
+			for (size_t i = 0; i < colorCount; ++i)
+			{
+				const Vector4F32 color = colors[i];
+				pixels[i] = Vector4U8{ ToUnorm8(color.r), ToUnorm8(color.g), ToUnorm8(color.b), ToUnorm8(color.a) };
+			}
+			return pixels[colorCount - 1].r;
+		});
+		Run("Vector4F32 -> Vector4U8 unorm (EncodeColors)", "colors", colorCount, [&]()
+		{
+			EncodeColors(pixels.data(), colors.data(), colorCount);
+			return pixels[colorCount - 1].r;
+		});
+		Run("Vector4F32 -> Vector4U8 sRGB (LinearToSrgb)", "colors", colorCount, [&]()
+		{
+			for (size_t i = 0; i < colorCount; ++i)
+			{
+				const Vector4F32 color = colors[i];
+				pixels[i] = Vector4U8{ ToUnorm8(LinearToSrgb(color.r)), ToUnorm8(LinearToSrgb(color.g)), ToUnorm8(LinearToSrgb(color.b)), ToUnorm8(color.a) };
+			}
+			return pixels[colorCount - 1].r;
+		});
+		Run("Vector4F32 -> Vector4U8 sRGB (EncodeColors)", "colors", colorCount, [&]()
+		{
+			EncodeColors(pixels.data(), colors.data(), colorCount, ColorSpace::Srgb);
+			return pixels[colorCount - 1].r;
+		});
+		Run("Vector4F32 -> Vector4U16 sRGB (EncodeColors)", "colors", colorCount, [&]()
+		{
+			EncodeColors(widePixels.data(), colors.data(), colorCount, ColorSpace::Srgb);
+			return widePixels[colorCount - 1].r;
+		});
+		Run("Vector4U16 -> Vector4F32 sRGB (DecodeColors)", "colors", colorCount, [&]()
+		{
+			DecodeColors(colors.data(), widePixels.data(), colorCount, ColorSpace::Srgb);
+			return colors[colorCount - 1].r;
+		});
+	}
+}
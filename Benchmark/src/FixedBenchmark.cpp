@@ -0,0 +1,78 @@
+#include "Benchmark.h"
+#include <PWMath/Fixed.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunFixedBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t count = 1 << 16;
+
+		std::mt19937 random{ 7 };
+		std::uniform_real_distribution<float> value{ -100.0f, 100.0f };
+		std::vector<FixedQ16> x(count), y(count), z(count), results(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			x[i] = FixedQ16{ value(random) };
+			y[i] = FixedQ16{ value(random) };
+			z[i] = FixedQ16{ value(random) };
+		}
+		const Vector3Stream<const FixedQ16> stream{ x.data(), y.data(), z.data() };
+
+		Run("Dot Vector3Q16 (one at a time)", "vectors", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				results[i] = Dot(stream.Get(i), stream.Get(count - 1 - i));
+			return results[count - 1].raw;
+		});
+		Run("Dot Vector3Q16 (stream)", "vectors", count - 1, [&]()
+		{
+			// Offset by one so the two sides differ
+			const Vector3Stream<const FixedQ16> offset{ x.data() + 1, y.data() + 1, z.data() + 1 };
+			Dot(results.data(), stream, offset, count - 1);
+			return results[count - 2].raw;
+		});
+
+		std::vector<Vector4Q16> packed(count);
+		std::vector<Vector4Q16Fast> fast(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			packed[i] = Vector4Q16{ x[i], y[i], z[i], FixedQ16{ 1 } };
+			fast[i] = Vector4Q16Fast{ x[i], y[i], z[i], FixedQ16{ 1 } };
+		}
+
+		Run("Vector4Q16 * Vector4Q16 (Packed)", "vectors", count - 1, [&]()
+		{
+			for (size_t i = 0; i + 1 < count; ++i)
+				packed[i] = packed[i] * packed[i + 1];
+			return packed[0].x.raw;
+		});
+		Run("Vector4Q16 * Vector4Q16 (Fast)", "vectors", count - 1, [&]()
+		{
+			for (size_t i = 0; i + 1 < count; ++i)
+				fast[i] = fast[i] * fast[i + 1];
+			return fast[0].x.raw;
+		});
+
+		std::vector<FixedQ32> angles(count), sines(count);
+		for (auto& angle : angles)
+			angle = FixedQ32{ value(random) };
+
+		Run("Sin FixedQ32", "angles", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				sines[i] = Sin(angles[i]);
+			return sines[count - 1].raw;
+		});
+		Run("Sqrt FixedQ32", "values", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				sines[i] = Sqrt(Abs(angles[i]));
+			return sines[count - 1].raw;
+		});
+	}
+}
@@ -0,0 +1,45 @@
+#include "Benchmark.h"
+#include <PWMath/Half.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunHalfBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t vectorCount = 1 << 20;
+
+		std::mt19937 random{ 8 };
+		std::uniform_real_distribution<float> position{ -100.0f, 100.0f };
+		std::vector<Vector3F32> vectors(vectorCount);
+		for (auto& vector : vectors)
+			vector = Vector3F32{ position(random), position(random), position(random) };
+		std::vector<Vector3F16> halfVectors(vectorCount);
+
+		Run("Vector3F32 -> Vector3F16 (one at a time)", "vectors", vectorCount, [&]()
+		{
+			for (size_t i = 0; i < vectorCount; ++i)
+				halfVectors[i] = Vector3F16{ vectors[i] };
+			return halfVectors[vectorCount - 1].x.bits;
+		});
+		Run("Vector3F32 -> Vector3F16 (Convert)", "vectors", vectorCount, [&]()
+		{
+			Convert(halfVectors.data(), vectors.data(), vectorCount);
+			return halfVectors[vectorCount - 1].x.bits;
+		});
+		Run("Vector3F16 -> Vector3F32 (one at a time)", "vectors", vectorCount, [&]()
+		{
+			for (size_t i = 0; i < vectorCount; ++i)
+				vectors[i] = Vector3F32{ halfVectors[i] };
+			return vectors[vectorCount - 1].x;
+		});
+		Run("Vector3F16 -> Vector3F32 (Convert)", "vectors", vectorCount, [&]()
+		{
+			Convert(vectors.data(), halfVectors.data(), vectorCount);
+			return vectors[vectorCount - 1].x;
+		});
+	}
+}
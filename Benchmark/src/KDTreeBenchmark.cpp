@@ -0,0 +1,79 @@
+#include "Benchmark.h"
+#include <PWMath/KDTree.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunKDTreeBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t queryCount = 1024, neighbourCount = 8;
+
+		std::mt19937 random{ 6 };
+		std::uniform_real_distribution<float> position{ -100.0f, 100.0f };
+
+		std::vector<Vector3F32> queries(queryCount);
+		for (auto& query : queries)
+			query = Vector3F32{ position(random), position(random), position(random) };
+
+		for (size_t count : { size_t{ 10000 }, size_t{ 100000 }, size_t{ 1000000 } })
+		{
+			std::vector<Vector3F32> points(count);
+			for (auto& point : points)
+				point = Vector3F32{ position(random), position(random), position(random) };
+
+			char name[64];
+			std::snprintf(name, sizeof(name), "k-d tree build (%zu points)", count);
+			Run(name, "points", count, [&]() { return BuildKDTree(points.data(), count).LeafCount(); });
+
+			const KDTree3F32 tree = BuildKDTree(points.data(), count);
+			std::vector<uint32_t> indices(queryCount * neighbourCount), counts(queryCount);
+			std::vector<float> distances2(queryCount * neighbourCount);
+
+			std::snprintf(name, sizeof(name), "k-d tree %zu nearest (%zu points)", neighbourCount, count);
+			Run(name, "queries", queryCount, [&]()
+			{
+				QueryNearest(tree, queries.data(), queryCount, neighbourCount, 1000.0f, indices.data(), distances2.data(), counts.data());
+				return counts[0];
+			});
+
+			// Keeps the nearest points the same way, testing every point with Length2
+			std::snprintf(name, sizeof(name), "Brute force %zu nearest (%zu points)", neighbourCount, count);
+			Run(name, "queries", queryCount / 64, [&]()
+			{
+				size_t found = 0;
+				for (size_t q = 0; q < queryCount / 64; ++q)
+				{
+					float nearest[neighbourCount];
+					std::fill_n(nearest, neighbourCount, 1000.0f * 1000.0f);
+					for (const auto& point : points)
+					{
+						const float distance2 = Length2(point - queries[q]);
+						if (distance2 >= nearest[neighbourCount - 1])
+							continue;
+
+						size_t slot = neighbourCount - 1;
+						for (; slot > 0 && nearest[slot - 1] > distance2; --slot)
+							nearest[slot] = nearest[slot - 1];
+						nearest[slot] = distance2;
+					}
+					found += nearest[0] < 1000.0f * 1000.0f;
+				}
+				return found;
+			});
+
+			std::snprintf(name, sizeof(name), "k-d tree radius query (%zu points)", count);
+			Run(name, "queries", queryCount, [&]()
+			{
+				size_t found = 0;
+				for (const auto& query : queries)
+					QueryRadius(tree, query, 5.0f, [&](uint32_t, float) { ++found; });
+				return found;
+			});
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Usage: Benchmark [--filter <text>] [--min-seconds <seconds>] [--json <path>] [--counters]
+//  - --filter only runs the benchmarks with text in their name
+//  - --min-seconds overrides how long each benchmark runs for (0 runs each once after the warm up)
+//  - --json writes the results to path, see Report.cpp for the layout
+//  - --counters adds cycles, instructions, cache and branch misses per item (Linux perf_event_open, see PerfCounters.h)
+int main(int argc, char** argv)
+{
+	const char* jsonPath = nullptr;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const bool hasValue = i + 1 < argc;
+		if (std::strcmp(argv[i], "--counters") == 0)
+			Benchmark::options.counters = true;
+		else if (hasValue && std::strcmp(argv[i], "--filter") == 0)
+			Benchmark::options.filter = argv[++i];
+		else if (hasValue && std::strcmp(argv[i], "--min-seconds") == 0)
+			Benchmark::options.minSeconds = std::atof(argv[++i]);
+		else if (hasValue && std::strcmp(argv[i], "--json") == 0)
+			jsonPath = argv[++i];
+		else
+		{
+			std::fprintf(stderr, "Usage: %s [--filter <text>] [--min-seconds <seconds>] [--json <path>] [--counters]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if (Benchmark::options.counters && !Benchmark::GetPerfCounters().AnyAvailable())
+		std::fprintf(stderr, "No hardware counters available (needs Linux with perf_event_paranoid <= 2 and a PMU), timing only\n");
+
+	Benchmark::RunRayBenchmarks();
+	Benchmark::RunTriangleBenchmarks();
+	Benchmark::RunBVHBenchmarks();
+	Benchmark::RunSphereBenchmarks();
+	Benchmark::RunSpatialHashGridBenchmarks();
+	Benchmark::RunKDTreeBenchmarks();
+	Benchmark::RunViewportBenchmarks();
+	Benchmark::RunProjectionBenchmarks();
+	Benchmark::RunFixedBenchmarks();
+	Benchmark::RunHalfBenchmarks();
+	Benchmark::RunNormalEncodingBenchmarks();
+	Benchmark::RunColorBenchmarks();
+	Benchmark::RunRotationBenchmarks();
+	Benchmark::RunVectorBenchmarks();
+	Benchmark::RunMatrixBenchmarks();
+	Benchmark::RunTransformBenchmarks();
+	Benchmark::RunWorkingSetBenchmarks();
+
+	if (jsonPath && !Benchmark::WriteJson(jsonPath))
+	{
+		std::fprintf(stderr, "Couldn't write %s\n", jsonPath);
+		return 1;
+	}
+
+	return 0;
+}
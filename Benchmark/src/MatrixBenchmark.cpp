@@ -0,0 +1,106 @@
+#include "Benchmark.h"
+#include <PWMath/Matrix.h>
+#include <PWMath/Matrix2x2.h>
+#include <PWMath/Matrix3x3.h>
+#include <PWMath/Matrix4x4.h>
+
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+	// Values in [1, 4] (or 1 to 10 for integers, so products of 4x4 matrices don't overflow)
+	template<typename T>
+	static T RandomElement(std::mt19937& random)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+			return std::uniform_real_distribution<T>{ 1, 4 }(random);
+		else
+			return static_cast<T>(std::uniform_int_distribution<int>{ 1, 10 }(random));
+	}
+
+	// Every operator and function of Matrix<T, N, N, P>, each on 1024 matrices
+	template<typename T, size_t N, PWMath::PackingMode P>
+	static void RunMatrixOps(const char* typeName)
+	{
+		using namespace PWMath;
+		using MatrixType = Matrix<T, N, N, P>;
+		using VectorType = Vector<T, N, P>;
+
+		constexpr size_t count = 1024;
+		const std::string size = std::to_string(N);
+		const std::string prefix = "Matrix" + size + "x" + size + "<" + typeName + (P == PackingMode::Fast ? ", Fast> " : ", Packed> ");
+
+		std::mt19937 random{ 12 };
+		std::vector<MatrixType> a(count), b(count), matrices(count);
+		std::vector<VectorType> v(count), vectors(count);
+		std::vector<T> s(count), scalars(count);
+		std::vector<uint8_t> equal(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (size_t r = 0; r < N; ++r)
+			{
+				for (size_t c = 0; c < N; ++c)
+				{
+					a[i][r][c] = RandomElement<T>(random);
+					b[i][r][c] = RandomElement<T>(random);
+				}
+				v[i][r] = RandomElement<T>(random);
+			}
+			s[i] = RandomElement<T>(random);
+		}
+
+		RunEach(prefix + "+a", matrices, [&](size_t i) { return +a[i]; });
+		RunEach(prefix + "-a", matrices, [&](size_t i) { return -a[i]; });
+
+		RunEach(prefix + "a + b", matrices, [&](size_t i) { return a[i] + b[i]; });
+		RunEach(prefix + "a - b", matrices, [&](size_t i) { return a[i] - b[i]; });
+		RunEach(prefix + "a * b", matrices, [&](size_t i) { return a[i] * b[i]; });
+		RunEach(prefix + "a += b", matrices, [&](size_t i) { MatrixType m = a[i]; m += b[i]; return m; });
+		RunEach(prefix + "a -= b", matrices, [&](size_t i) { MatrixType m = a[i]; m -= b[i]; return m; });
+		RunEach(prefix + "a *= b", matrices, [&](size_t i) { MatrixType m = a[i]; m *= b[i]; return m; });
+
+		RunEach(prefix + "a * s", matrices, [&](size_t i) { return a[i] * s[i]; });
+		RunEach(prefix + "s * a", matrices, [&](size_t i) { return s[i] * a[i]; });
+		RunEach(prefix + "a *= s", matrices, [&](size_t i) { MatrixType m = a[i]; m *= s[i]; return m; });
+
+		RunEach(prefix + "a * v", vectors, [&](size_t i) { return a[i] * v[i]; });
+		RunEach(prefix + "v * a", vectors, [&](size_t i) { return v[i] * a[i]; });
+		RunEach(prefix + "v *= a", vectors, [&](size_t i) { VectorType vector = v[i]; vector *= a[i]; return vector; });
+
+		RunEach(prefix + "a == b", equal, [&](size_t i) { return static_cast<uint8_t>(a[i] == b[i]); });
+		RunEach(prefix + "GetRow", vectors, [&](size_t i) { return a[i].GetRow(i % N); });
+		RunEach(prefix + "GetColumn", vectors, [&](size_t i) { return a[i].GetColumn(i % N); });
+		RunEach(prefix + "Transpose", matrices, [&](size_t i) { return Transpose(a[i]); });
+		RunEach(prefix + "Determinant", scalars, [&](size_t i) { return Determinant(a[i]); });
+		if constexpr (N == 3)
+		{
+			RunEach(prefix + "Cofactor", matrices, [&](size_t i) { return Cofactor(a[i]); });
+			// Inverses of integer matrices are truncated, they're only measured for floating point ones
+			if constexpr (std::is_floating_point_v<T>)
+				RunEach(prefix + "Inverse", matrices, [&](size_t i) { return Inverse(a[i]); });
+		}
+	}
+
+	template<typename T>
+	static void RunMatrixOpsForType(const char* typeName)
+	{
+		using PWMath::PackingMode;
+
+		RunMatrixOps<T, 2, PackingMode::Packed>(typeName);
+		RunMatrixOps<T, 2, PackingMode::Fast>(typeName);
+		RunMatrixOps<T, 3, PackingMode::Packed>(typeName);
+		RunMatrixOps<T, 3, PackingMode::Fast>(typeName);
+		RunMatrixOps<T, 4, PackingMode::Packed>(typeName);
+		RunMatrixOps<T, 4, PackingMode::Fast>(typeName);
+	}
+
+	void RunMatrixBenchmarks()
+	{
+		RunMatrixOpsForType<float>("float");
+		RunMatrixOpsForType<double>("double");
+		RunMatrixOpsForType<int32_t>("int");
+	}
+}
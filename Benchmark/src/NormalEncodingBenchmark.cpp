@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+#include <PWMath/NormalEncoding.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	template<typename TEncoded>
+	static void RunNormalEncoding(const char* encodeName, const char* decodeName, const char* batchEncodeName, const char* batchDecodeName,
+		std::vector<PWMath::Vector3F32>& normals)
+	{
+		const size_t count = normals.size();
+		std::vector<TEncoded> encoded(count);
+
+		Run(encodeName, "normals", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				encoded[i] = TEncoded::Encode(normals[i]);
+			return static_cast<uint64_t>(encoded[count - 1].x);
+		});
+		Run(batchEncodeName, "normals", count, [&]()
+		{
+			PWMath::Encode(encoded.data(), normals.data(), count);
+			return static_cast<uint64_t>(encoded[count - 1].x);
+		});
+		Run(decodeName, "normals", count, [&]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				normals[i] = encoded[i].Decode();
+			return normals[count - 1].x;
+		});
+		Run(batchDecodeName, "normals", count, [&]()
+		{
+			PWMath::Decode(normals.data(), encoded.data(), count);
+			return normals[count - 1].x;
+		});
+	}
+
+	void RunNormalEncodingBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t normalCount = 1 << 16;
+
+		std::mt19937 random{ 9 };
+		std::normal_distribution<float> direction;
+		std::vector<Vector3F32> normals(normalCount);
+		for (auto& normal : normals)
+			normal = Normalize(Vector3F32{ direction(random), direction(random), direction(random) });
+
+		RunNormalEncoding<OctahedralNormal16>("Encode OctahedralNormal16 (one at a time)", "Decode OctahedralNormal16 (one at a time)",
+			"Encode OctahedralNormal16 (batch)", "Decode OctahedralNormal16 (batch)", normals);
+		RunNormalEncoding<SnormNormal16>("Encode SnormNormal16 (one at a time)", "Decode SnormNormal16 (one at a time)",
+			"Encode SnormNormal16 (batch)", "Decode SnormNormal16 (batch)", normals);
+
+		// PackedNormal1010102 has no x member, so it gets its own runs
+		std::vector<PackedNormal1010102> packed(normalCount);
+		Run("Encode PackedNormal1010102 (one at a time)", "normals", normalCount, [&]()
+		{
+			for (size_t i = 0; i < normalCount; ++i)
+				packed[i] = PackedNormal1010102::Encode(normals[i]);
+			return packed[normalCount - 1].bits;
+		});
+		Run("Encode PackedNormal1010102 (batch)", "normals", normalCount, [&]()
+		{
+			Encode(packed.data(), normals.data(), normalCount);
+			return packed[normalCount - 1].bits;
+		});
+		Run("Decode PackedNormal1010102 (batch)", "normals", normalCount, [&]()
+		{
+			Decode(normals.data(), packed.data(), normalCount);
+			return normals[normalCount - 1].x;
+		});
+	}
+}
@@ -0,0 +1,154 @@
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif // __linux__
+
+namespace Benchmark
+{
+#if defined(__linux__)
+	// groupLeader is the descriptor of the group to join, -1 starts a new group
+	static int OpenCounter(uint32_t type, uint64_t config, int groupLeader)
+	{
+		perf_event_attr attributes;
+		std::memset(&attributes, 0, sizeof(attributes));
+		attributes.size = sizeof(attributes);
+		attributes.type = type;
+		attributes.config = config;
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		// Threads started afterwards count too, their counts are added when they exit. Allowed because PERF_FORMAT_GROUP isn't used
+		attributes.inherit = 1;
+		attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		// This thread, any CPU
+		return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+	}
+#endif // __linux__
+
+	PerfCounters::PerfCounters()
+	{
+		for (int& descriptor : descriptors)
+			descriptor = -1;
+
+#if defined(__linux__)
+		// The first counter that opens leads the group, the others join it so they count over the same windows.
+		// A counter the processor can't schedule along with the group counts on its own instead
+		auto open = [&](Counter counter, uint32_t type, uint64_t config)
+		{
+			int& descriptor = descriptors[static_cast<size_t>(counter)];
+			descriptor = OpenCounter(type, config, leader);
+			if (descriptor < 0 && leader >= 0)
+				descriptor = OpenCounter(type, config, -1);
+			if (leader < 0)
+				leader = descriptor;
+		};
+		open(Counter::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+		open(Counter::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+		open(Counter::L1DMisses, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+		open(Counter::LLCMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+		open(Counter::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif // __linux__
+	}
+
+	PerfCounters::~PerfCounters()
+	{
+#if defined(__linux__)
+		for (const int descriptor : descriptors)
+		{
+			if (descriptor >= 0)
+				close(descriptor);
+		}
+#endif // __linux__
+	}
+
+	bool PerfCounters::AnyAvailable() const
+	{
+		for (const int descriptor : descriptors)
+		{
+			if (descriptor >= 0)
+				return true;
+		}
+		return false;
+	}
+
+	// The group members only count while the leader does, so the leader is enabled last and disabled first
+	void PerfCounters::Start()
+	{
+#if defined(__linux__)
+		for (const int descriptor : descriptors)
+		{
+			if (descriptor >= 0 && descriptor != leader)
+			{
+				ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+				ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+		if (leader >= 0)
+		{
+			ioctl(leader, PERF_EVENT_IOC_RESET, 0);
+			ioctl(leader, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif // __linux__
+	}
+
+	void PerfCounters::Stop()
+	{
+#if defined(__linux__)
+		if (leader >= 0)
+			ioctl(leader, PERF_EVENT_IOC_DISABLE, 0);
+		for (const int descriptor : descriptors)
+		{
+			if (descriptor >= 0 && descriptor != leader)
+				ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+		}
+#endif // __linux__
+	}
+
+	uint64_t PerfCounters::Read(Counter counter) const
+	{
+#if defined(__linux__)
+		const int descriptor = descriptors[static_cast<size_t>(counter)];
+		if (descriptor < 0)
+			return 0;
+
+		// value, time enabled, time running
+		uint64_t values[3] = {};
+		if (read(descriptor, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0)
+			return 0;
+
+		// The counter only ran for part of the time when the kernel multiplexed it with others
+		if (values[2] < values[1])
+			return static_cast<uint64_t>(static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]));
+		return values[0];
+#else
+		(void)counter;
+		return 0;
+#endif // __linux__
+	}
+
+	PerfCounters& GetPerfCounters()
+	{
+		static PerfCounters counters;
+		return counters;
+	}
+
+	const char* CounterName(Counter counter)
+	{
+		switch (counter)
+		{
+		case Counter::Cycles:		return "cycles";
+		case Counter::Instructions:	return "instructions";
+		case Counter::L1DMisses:	return "l1d_misses";
+		case Counter::LLCMisses:	return "llc_misses";
+		case Counter::BranchMisses:	return "branch_misses";
+		default:					return "unknown";
+		}
+	}
+}
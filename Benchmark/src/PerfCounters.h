@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Benchmark
+{
+	// The hardware events PerfCounters counts
+	enum class Counter
+	{
+		Cycles,
+		Instructions,
+		L1DMisses,		// L1 data cache read misses
+		LLCMisses,		// Last level cache misses
+		BranchMisses,
+
+		Count
+	};
+
+	// Counts hardware events for the calling thread and the threads it starts, in user space with Linux perf_event_open
+	// Notes:
+	//  - The counts of a started thread are added once it exits, the parallel functions join their threads before returning
+	//  - The events are opened as one group so they count over the same windows, the ones the processor (or a virtual machine) doesn't have are skipped
+	//  - Counts are scaled up when the kernel had to multiplex the events
+	//  - On other platforms, or when perf_event_paranoid is above 2, nothing is available and every count is 0
+	class PerfCounters
+	{
+	public:
+		PerfCounters();
+		~PerfCounters();
+
+		PerfCounters(const PerfCounters&) = delete;
+		PerfCounters& operator=(const PerfCounters&) = delete;
+
+		bool Available(Counter counter) const { return descriptors[static_cast<size_t>(counter)] >= 0; }
+		bool AnyAvailable() const;
+
+		// Zeroes and starts every available counter
+		void Start();
+		// Stops the counters, Read gives the counts between Start and Stop
+		void Stop();
+		uint64_t Read(Counter counter) const;
+
+	private:
+		int descriptors[static_cast<size_t>(Counter::Count)];
+		// Descriptor of the group leader, one of descriptors
+		int leader = -1;
+	};
+
+	// Counters shared by every benchmark, opened on first use
+	PerfCounters& GetPerfCounters();
+
+	// Short name for a counter, used in the output and the JSON report (ex: "l1d_misses")
+	const char* CounterName(Counter counter);
+}
@@ -0,0 +1,58 @@
+#include "Benchmark.h"
+#include <PWMath/Projection.h>
+#include <PWMath/Transform.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunProjectionBenchmarks()
+	{
+		using namespace PWMath;
+		using Vector3Fast = Vector3<float, PackingMode::Fast>;
+		using Matrix4x4Fast = Matrix4x4<float, PackingMode::Fast>;
+
+		constexpr size_t pointCount = 1 << 16;
+
+		std::mt19937 random{ 6 };
+		std::uniform_real_distribution<float> position{ -10.0f, 10.0f };
+		std::vector<Vector4F32Fast> points(pointCount);
+		for (auto& point : points)
+			point = Vector4F32Fast{ position(random), position(random), position(random), 1.0f };
+
+		const auto projection = PerspectiveProjectionF32::Create(1.2f, 16.0f / 9.0f, 0.1f, 100.0f);
+		const auto projectionMatrix = projection.ToMatrix<PackingMode::Fast>();
+		std::vector<Vector4F32Fast> clipPoints(pointCount);
+
+		Run("Project points (Matrix4x4)", "points", pointCount, [&]()
+		{
+			for (size_t i = 0; i < pointCount; ++i)
+				clipPoints[i] = points[i] * projectionMatrix;
+			return clipPoints[pointCount - 1].x;
+		});
+		Run("Project points (PerspectiveProjection)", "points", pointCount, [&]()
+		{
+			Project(clipPoints.data(), points.data(), projection, pointCount);
+			return clipPoints[pointCount - 1].x;
+		});
+
+		std::vector<Matrix4x4Fast> views(1024);
+		for (auto& view : views)
+			view = ComposeTRS(Vector3Fast{ position(random), position(random), position(random) }, position(random), Normalize(Vector3Fast{ 1.0f, 2.0f, 3.0f }), Vector3Fast{ 1.0f });
+		std::vector<Matrix4x4Fast> viewProjections(views.size());
+
+		Run("View * projection (Matrix4x4)", "matrices", views.size(), [&]()
+		{
+			for (size_t i = 0; i < views.size(); ++i)
+				viewProjections[i] = views[i] * projectionMatrix;
+			return viewProjections.back()[3][2];
+		});
+		Run("View * projection (PerspectiveProjection)", "matrices", views.size(), [&]()
+		{
+			for (size_t i = 0; i < views.size(); ++i)
+				viewProjections[i] = views[i] * projection;
+			return viewProjections.back()[3][2];
+		});
+	}
+}
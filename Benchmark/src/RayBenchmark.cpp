@@ -0,0 +1,91 @@
+#include "Benchmark.h"
+#include <PWMath/Ray.h>
+
+#include <bit>
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunRayBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t boxCount = 4096, rayCount = 4096;
+
+		std::mt19937 random{ 1 };
+		std::uniform_real_distribution<float> position{ -100.0f, 100.0f }, size{ 0.5f, 10.0f }, direction{ -1.0f, 1.0f };
+
+		std::vector<float> minX(boxCount), minY(boxCount), minZ(boxCount), maxX(boxCount), maxY(boxCount), maxZ(boxCount);
+		for (size_t i = 0; i < boxCount; ++i)
+		{
+			minX[i] = position(random), minY[i] = position(random), minZ[i] = position(random);
+			maxX[i] = minX[i] + size(random), maxY[i] = minY[i] + size(random), maxZ[i] = minZ[i] + size(random);
+		}
+		const Vector3Stream<const float> mins{ minX.data(), minY.data(), minZ.data() }, maxs{ maxX.data(), maxY.data(), maxZ.data() };
+
+		std::vector<RayF32> rays;
+		std::vector<float> originX(rayCount), originY(rayCount), originZ(rayCount), inverseX(rayCount), inverseY(rayCount), inverseZ(rayCount);
+		for (size_t i = 0; i < rayCount; ++i)
+		{
+			const RayF32 ray{ { position(random), position(random), position(random) }, { direction(random), direction(random), direction(random) } };
+			rays.push_back(ray);
+			originX[i] = ray.origin.x, originY[i] = ray.origin.y, originZ[i] = ray.origin.z;
+			inverseX[i] = ray.inverseDirection.x, inverseY[i] = ray.inverseDirection.y, inverseZ[i] = ray.inverseDirection.z;
+		}
+		const std::vector<float> maxDistances(rayCount, 1000.0f);
+
+		std::vector<uint32_t> hitIndices(boxCount);
+		std::vector<float> entries(boxCount);
+
+		// 1 ray against every box
+		Run("Ray vs boxes (single)", "tests", boxCount * 16, [&]()
+		{
+			size_t hits = 0;
+			for (size_t r = 0; r < 16; ++r)
+			{
+				for (size_t i = 0; i < boxCount; ++i)
+				{
+					float entry;
+					hits += Intersects(rays[r], AABBF32{ mins.Get<PackingMode::Default>(i), maxs.Get<PackingMode::Default>(i) }, 1000.0f, entry);
+				}
+			}
+			return hits;
+		});
+
+		Run("Ray vs boxes (packet)", "tests", boxCount * 16, [&]()
+		{
+			size_t hits = 0;
+			for (size_t r = 0; r < 16; ++r)
+				hits += Intersect(rays[r], mins, maxs, boxCount, 1000.0f, hitIndices.data(), entries.data());
+			return hits;
+		});
+
+		// Every ray against 1 box
+		const AABBF32 box{ { -20.0f, -20.0f, -20.0f }, { 20.0f, 20.0f, 20.0f } };
+
+		Run("Rays vs box (single)", "rays", rayCount, [&]()
+		{
+			size_t hits = 0;
+			for (size_t i = 0; i < rayCount; ++i)
+			{
+				float entry;
+				hits += Intersects(rays[i], box, 1000.0f, entry);
+			}
+			return hits;
+		});
+
+		Run("Rays vs box (packet)", "rays", rayCount, [&]()
+		{
+			size_t hits = 0;
+			for (size_t i = 0; i + rayPacketSize <= rayCount; i += rayPacketSize)
+			{
+				const RayStream<const float> packet{
+					{ originX.data() + i, originY.data() + i, originZ.data() + i }, { inverseX.data() + i, inverseY.data() + i, inverseZ.data() + i }
+				};
+				hits += std::popcount(IntersectPacket(packet, box, maxDistances.data() + i, entries.data()));
+			}
+			return hits;
+		});
+	}
+}
@@ -0,0 +1,140 @@
+#include "Benchmark.h"
+#include <PWMath/Macros.h>
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+namespace Benchmark
+{
+	// Names are plain ASCII, but quotes, backslashes and control characters are escaped anyway
+	static std::string EscapeJson(const std::string& text)
+	{
+		std::string escaped;
+		for (const char c : text)
+		{
+			if (c == '"' || c == '\\')
+			{
+				escaped += '\\';
+				escaped += c;
+			}
+			else if (static_cast<unsigned char>(c) < 0x20)
+			{
+				char code[8];
+				std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+				escaped += code;
+			}
+			else
+				escaped += c;
+		}
+		return escaped;
+	}
+
+	static const char* CompilerName()
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return "msvc";
+#else
+		return "unknown";
+#endif
+	}
+
+	// The widest instruction set the SIMD paths were built for
+	static const char* SimdName()
+	{
+#if PWM_USE_AVX512
+		return "AVX512";
+#elif PWM_USE_AVX2
+		return "AVX2";
+#elif PWM_USE_AVX
+		return "AVX";
+#elif PWM_USE_SSE4
+		return "SSE4";
+#elif PWM_USE_SSE2
+		return "SSE2";
+#else
+		return "None";
+#endif
+	}
+
+	void PrintResult(const Result& result)
+	{
+		std::printf("%-56s %14.4f M %s/s", result.name.c_str(), result.itemsPerSecond / 1e6, result.unit.c_str());
+		if (result.bytesPerItem > 0.0)
+			std::printf(" %10.2f GB/s", result.itemsPerSecond * result.bytesPerItem / 1e9);
+		std::printf("\n");
+
+		if (!result.counted || !GetPerfCounters().AnyAvailable())
+			return;
+
+		const PerfCounters& counters = GetPerfCounters();
+		const double items = static_cast<double>(result.items);
+		std::printf("    per item:");
+		for (size_t i = 0; i < static_cast<size_t>(Counter::Count); ++i)
+		{
+			if (counters.Available(static_cast<Counter>(i)))
+				std::printf(" %s %.4g", CounterName(static_cast<Counter>(i)), static_cast<double>(result.counts[i]) / items);
+		}
+		if (counters.Available(Counter::Cycles) && counters.Available(Counter::Instructions) && result.counts[0] != 0)
+			std::printf(", ipc %.3g", static_cast<double>(result.counts[1]) / static_cast<double>(result.counts[0]));
+		std::printf("\n");
+	}
+
+	bool WriteJson(const char* path)
+	{
+		std::FILE* file = std::fopen(path, "w");
+		if (!file)
+			return false;
+
+		char date[32] = "";
+		const std::time_t now = std::time(nullptr);
+		if (const std::tm* utc = std::gmtime(&now))
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", utc);
+
+		std::fprintf(file, "{\n");
+		std::fprintf(file, "  \"context\": {\n");
+		std::fprintf(file, "    \"date\": \"%s\",\n", date);
+		std::fprintf(file, "    \"compiler\": \"%s\",\n", EscapeJson(CompilerName()).c_str());
+		std::fprintf(file, "    \"simd\": \"%s\",\n", SimdName());
+		std::fprintf(file, "    \"counters\": %s,\n", options.counters && GetPerfCounters().AnyAvailable() ? "true" : "false");
+#if defined(NDEBUG)
+		std::fprintf(file, "    \"build\": \"release\"\n");
+#else
+		std::fprintf(file, "    \"build\": \"debug\"\n");
+#endif
+		std::fprintf(file, "  },\n");
+
+		// Bandwidth is only written for the runs that gave their bytes per item, counts only for the counters that were available
+		const PerfCounters* counters = options.counters ? &GetPerfCounters() : nullptr;
+		std::fprintf(file, "  \"benchmarks\": [");
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const Result& result = results[i];
+			std::fprintf(file, "%s\n    { \"name\": \"%s\", \"unit\": \"%s\", \"items_per_second\": %.6e, \"calls\": %zu, \"seconds\": %.6f, \"items\": %zu",
+				i == 0 ? "" : ",", EscapeJson(result.name).c_str(), EscapeJson(result.unit).c_str(), result.itemsPerSecond, result.calls, result.seconds, result.items);
+			if (result.bytesPerItem > 0.0)
+				std::fprintf(file, ", \"bytes_per_item\": %g, \"bytes_per_second\": %.6e", result.bytesPerItem, result.itemsPerSecond * result.bytesPerItem);
+			if (result.counted && counters && counters->AnyAvailable())
+			{
+				std::fprintf(file, ", \"per_item\": {");
+				bool first = true;
+				for (size_t c = 0; c < static_cast<size_t>(Counter::Count); ++c)
+				{
+					if (!counters->Available(static_cast<Counter>(c)))
+						continue;
+					std::fprintf(file, "%s\"%s\": %.6e", first ? " " : ", ", CounterName(static_cast<Counter>(c)), static_cast<double>(result.counts[c]) / static_cast<double>(result.items));
+					first = false;
+				}
+				std::fprintf(file, " }");
+			}
+			std::fprintf(file, " }");
+		}
+		std::fprintf(file, "%s]\n}\n", results.empty() ? "" : "\n  ");
+
+		return std::fclose(file) == 0;
+	}
+}
@@ -0,0 +1,87 @@
+#include "Benchmark.h"
+#include <PWMath/Transform.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunRotationBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t angleCount = 1 << 16;
+
+		std::mt19937 random{ 10 };
+		std::uniform_real_distribution<float> angle{ -3.14159265f, 3.14159265f }, axis{ -1.0f, 1.0f };
+		std::vector<float> angles(angleCount), sines(angleCount), cosines(angleCount), x(angleCount), y(angleCount), z(angleCount);
+		for (size_t i = 0; i < angleCount; ++i)
+		{
+			angles[i] = angle(random);
+			x[i] = axis(random);
+			y[i] = axis(random);
+			z[i] = axis(random) + 2.0f;
+		}
+		const Vector3Stream<const float> axes{ x.data(), y.data(), z.data() };
+
+		Run("SinCos (std::sin and std::cos)", "angles", angleCount, [&]()
+		{
+			for (size_t i = 0; i < angleCount; ++i)
+			{
+				sines[i] = std::sin(angles[i]);
+				cosines[i] = std::cos(angles[i]);
+			}
+			return sines[angleCount - 1] + cosines[angleCount - 1];
+		});
+		Run("SinCos (batch)", "angles", angleCount, [&]()
+		{
+			SinCos(sines.data(), cosines.data(), angles.data(), angleCount);
+			return sines[angleCount - 1] + cosines[angleCount - 1];
+		});
+
+		std::vector<Matrix2x2F32> matrices2(angleCount);
+		Run("Rotate Matrix2x2 (one at a time)", "matrices", angleCount, [&]()
+		{
+			for (size_t i = 0; i < angleCount; ++i)
+				matrices2[i] = Rotate(Matrix2x2F32{ 1.0f }, angles[i]);
+			return matrices2[angleCount - 1][0][1];
+		});
+		Run("MakeRotation Matrix2x2 (batch)", "matrices", angleCount, [&]()
+		{
+			MakeRotation(matrices2.data(), angles.data(), angleCount);
+			return matrices2[angleCount - 1][0][1];
+		});
+
+		std::vector<Matrix3x3F32> matrices3(angleCount);
+		Run("Rotate Matrix3x3 axis-angle (one at a time)", "matrices", angleCount, [&]()
+		{
+			for (size_t i = 0; i < angleCount; ++i)
+				matrices3[i] = Rotate(Matrix3x3F32{ 1.0f }, angles[i], axes.Get(i));
+			return matrices3[angleCount - 1][0][1];
+		});
+		Run("MakeRotation Matrix3x3 axis-angle (batch)", "matrices", angleCount, [&]()
+		{
+			MakeRotation(matrices3.data(), angles.data(), axes, angleCount);
+			return matrices3[angleCount - 1][0][1];
+		});
+
+		std::vector<Matrix4x4F32> matrices4(angleCount);
+		Run("Rotate Matrix4x4 axis-angle (one at a time)", "matrices", angleCount, [&]()
+		{
+			for (size_t i = 0; i < angleCount; ++i)
+				matrices4[i] = Rotate(Matrix4x4F32{ 1.0f }, angles[i], axes.Get(i));
+			return matrices4[angleCount - 1][0][1];
+		});
+		Run("MakeRotation Matrix4x4 axis-angle (batch)", "matrices", angleCount, [&]()
+		{
+			MakeRotation(matrices4.data(), angles.data(), axes, angleCount);
+			return matrices4[angleCount - 1][0][1];
+		});
+		Run("Rotate Matrix4x4 axis-angle (batch, in place)", "matrices", angleCount, [&]()
+		{
+			Rotate(matrices4.data(), angles.data(), axes, angleCount);
+			return matrices4[angleCount - 1][0][1];
+		});
+	}
+}
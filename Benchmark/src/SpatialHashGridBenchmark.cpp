@@ -0,0 +1,56 @@
+#include "Benchmark.h"
+#include <PWMath/SpatialHashGrid.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunSpatialHashGridBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr float worldSize = 1000.0f;
+		constexpr size_t queryCount = 4096, neighbourCount = 8;
+
+		std::mt19937 random{ 5 };
+		std::uniform_real_distribution<float> position{ 0.0f, worldSize };
+
+		// Same density scaled to the point count, the cells hold about 8 points each
+		for (size_t count : { size_t{ 10000 }, size_t{ 100000 }, size_t{ 1000000 } })
+		{
+			std::vector<Vector3F32> points(count);
+			for (auto& point : points)
+				point = Vector3F32{ position(random), position(random), position(random) };
+			const float cellSize = 2.0f * worldSize / std::cbrt(static_cast<float>(count));
+
+			SpatialHashGridF32 grid;
+			Rebuild(grid, points.data(), count, cellSize);
+
+			char name[64];
+			std::snprintf(name, sizeof(name), "Hash grid rebuild (%zu points)", count);
+			Run(name, "points", count, [&]() { Rebuild(grid, points.data(), count, cellSize); return grid.BucketCount(); });
+
+			std::snprintf(name, sizeof(name), "Hash grid radius query (%zu points)", count);
+			Run(name, "queries", queryCount, [&]()
+			{
+				size_t found = 0;
+				for (size_t i = 0; i < queryCount; ++i)
+					QueryRadius(grid, points[i], cellSize, [&](uint32_t, float) { ++found; });
+				return found;
+			});
+
+			std::snprintf(name, sizeof(name), "Hash grid %zu nearest query (%zu points)", neighbourCount, count);
+			Run(name, "queries", queryCount, [&]()
+			{
+				size_t found = 0;
+				uint32_t indices[neighbourCount];
+				float distances2[neighbourCount];
+				for (size_t i = 0; i < queryCount; ++i)
+					found += QueryNearest(grid, points[i], neighbourCount, worldSize, indices, distances2);
+				return found;
+			});
+		}
+	}
+}
@@ -0,0 +1,26 @@
+#include "Benchmark.h"
+#include <PWMath/Sphere.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunSphereBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t pointCount = 1 << 20;
+
+		// Scattered like the vertices of a mesh, denser in the middle
+		std::mt19937 random{ 4 };
+		std::normal_distribution<float> position{ 0.0f, 10.0f };
+		std::vector<Vector3F32> points(pointCount);
+		for (auto& point : points)
+			point = Vector3F32{ position(random), position(random) * 0.5f, position(random) * 2.0f };
+
+		Run("Bounding sphere (centroid)", "points", pointCount, [&]() { return BoundingSphereCentroid(points.data(), pointCount).radius; });
+		Run("Bounding sphere (Ritter)", "points", pointCount, [&]() { return BoundingSphereRitter(points.data(), pointCount).radius; });
+		Run("Bounding sphere (EPOS)", "points", pointCount, [&]() { return BoundingSphereEPOS(points.data(), pointCount).radius; });
+	}
+}
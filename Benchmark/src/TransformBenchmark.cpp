@@ -0,0 +1,153 @@
+#include "Benchmark.h"
+#include <PWMath/Projection.h>
+#include <PWMath/Stream.h>
+#include <PWMath/Transform.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	// Every transform and projection builder for Matrix<T, N, N, P>, each on 1024 matrices
+	template<typename T, PWMath::PackingMode P>
+	static void RunTransformOps(const char* typeName)
+	{
+		using namespace PWMath;
+		using Vector2Type = Vector2<T, P>;
+		using Vector3Type = Vector3<T, P>;
+
+		constexpr size_t count = 1024;
+		const std::string suffix = std::string{ "<" } + typeName + (P == PackingMode::Fast ? ", Fast>" : ", Packed>");
+
+		std::mt19937 random{ 13 };
+		std::uniform_real_distribution<T> value{ -2, 2 }, angle{ -3.14159265, 3.14159265 }, scale{ 0.5, 2 };
+		std::vector<T> angles(count), xs(count), ys(count), zs(count), scaleXs(count), scaleYs(count), scaleZs(count), axisXs(count), axisYs(count), axisZs(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			angles[i] = angle(random);
+			xs[i] = value(random);
+			ys[i] = value(random);
+			zs[i] = value(random);
+			scaleXs[i] = scale(random);
+			scaleYs[i] = scale(random);
+			scaleZs[i] = scale(random);
+			axisXs[i] = value(random);
+			axisYs[i] = value(random);
+			axisZs[i] = scale(random);
+		}
+		const Vector2Stream<const T> translations2{ xs.data(), ys.data() }, scales2{ scaleXs.data(), scaleYs.data() };
+		const Vector3Stream<const T> translations3{ xs.data(), ys.data(), zs.data() }, scales3{ scaleXs.data(), scaleYs.data(), scaleZs.data() };
+		const Vector3Stream<const T> axes{ axisXs.data(), axisYs.data(), axisZs.data() };
+
+		// Builders applied to an existing matrix start from these
+		const Matrix2x2<T, P> base2{ static_cast<T>(1) };
+		const Matrix3x3<T, P> base3 = ComposeTRS(Vector2Type{ 1, 2 }, static_cast<T>(0.5), Vector2Type{ 2, 3 });
+		const Matrix4x4<T, P> base4 = ComposeTRS(Vector3Type{ 1, 2, 3 }, static_cast<T>(0.5), Vector3Type{ 1, 1, 1 }, Vector3Type{ 2, 3, 4 });
+
+		std::vector<Matrix2x2<T, P>> matrices2(count);
+		std::vector<Matrix3x3<T, P>> matrices3(count);
+		std::vector<Matrix4x4<T, P>> matrices4(count);
+
+		RunEach("Translate Matrix3x3" + suffix, matrices3, [&](size_t i) { return Translate(base3, translations2.template Get<P>(i)); });
+		RunEach("Translate Matrix4x4" + suffix, matrices4, [&](size_t i) { return Translate(base4, translations3.template Get<P>(i)); });
+		RunEach("TranslateInPlace Matrix3x3" + suffix, matrices3, [&](size_t i) { auto m = base3; TranslateInPlace(m, translations2.template Get<P>(i)); return m; });
+		RunEach("TranslateInPlace Matrix4x4" + suffix, matrices4, [&](size_t i) { auto m = base4; TranslateInPlace(m, translations3.template Get<P>(i)); return m; });
+
+		RunEach("Scale Matrix2x2" + suffix, matrices2, [&](size_t i) { return Scale(base2, scales2.template Get<P>(i)); });
+		RunEach("Scale Matrix3x3 (2D)" + suffix, matrices3, [&](size_t i) { return Scale(base3, scales2.template Get<P>(i)); });
+		RunEach("Scale Matrix3x3 (3D)" + suffix, matrices3, [&](size_t i) { return Scale(base3, scales3.template Get<P>(i)); });
+		RunEach("Scale Matrix4x4" + suffix, matrices4, [&](size_t i) { return Scale(base4, scales3.template Get<P>(i)); });
+		RunEach("ScaleInPlace Matrix2x2" + suffix, matrices2, [&](size_t i) { auto m = base2; ScaleInPlace(m, scales2.template Get<P>(i)); return m; });
+		RunEach("ScaleInPlace Matrix3x3 (2D)" + suffix, matrices3, [&](size_t i) { auto m = base3; ScaleInPlace(m, scales2.template Get<P>(i)); return m; });
+		RunEach("ScaleInPlace Matrix3x3 (3D)" + suffix, matrices3, [&](size_t i) { auto m = base3; ScaleInPlace(m, scales3.template Get<P>(i)); return m; });
+		RunEach("ScaleInPlace Matrix4x4" + suffix, matrices4, [&](size_t i) { auto m = base4; ScaleInPlace(m, scales3.template Get<P>(i)); return m; });
+
+		RunEach("Rotate Matrix2x2" + suffix, matrices2, [&](size_t i) { return Rotate(base2, angles[i]); });
+		RunEach("Rotate Matrix3x3 (2D)" + suffix, matrices3, [&](size_t i) { return Rotate(base3, angles[i]); });
+		RunEach("Rotate Matrix3x3 (3D)" + suffix, matrices3, [&](size_t i) { return Rotate(base3, angles[i], axes.template Get<P>(i)); });
+		RunEach("Rotate Matrix4x4" + suffix, matrices4, [&](size_t i) { return Rotate(base4, angles[i], axes.template Get<P>(i)); });
+
+		RunEach("Shear Matrix2x2" + suffix, matrices2, [&](size_t i) { return Shear(base2, xs[i], ys[i]); });
+		RunEach("Shear Matrix3x3 (2D)" + suffix, matrices3, [&](size_t i) { return Shear(base3, xs[i], ys[i]); });
+		RunEach("Shear Matrix3x3 (3D)" + suffix, matrices3, [&](size_t i)
+		{
+			return Shear(base3, Vector2Type{ xs[i], ys[i] }, Vector2Type{ ys[i], zs[i] }, Vector2Type{ zs[i], xs[i] });
+		});
+		RunEach("Shear Matrix4x4" + suffix, matrices4, [&](size_t i)
+		{
+			return Shear(base4, Vector2Type{ xs[i], ys[i] }, Vector2Type{ ys[i], zs[i] }, Vector2Type{ zs[i], xs[i] });
+		});
+		RunEach("ShearInPlace Matrix2x2" + suffix, matrices2, [&](size_t i) { auto m = base2; ShearInPlace(m, xs[i], ys[i]); return m; });
+		RunEach("ShearInPlace Matrix3x3 (2D)" + suffix, matrices3, [&](size_t i) { auto m = base3; ShearInPlace(m, xs[i], ys[i]); return m; });
+		RunEach("ShearInPlace Matrix3x3 (3D)" + suffix, matrices3, [&](size_t i)
+		{
+			auto m = base3;
+			ShearInPlace(m, Vector2Type{ xs[i], ys[i] }, Vector2Type{ ys[i], zs[i] }, Vector2Type{ zs[i], xs[i] });
+			return m;
+		});
+		RunEach("ShearInPlace Matrix4x4" + suffix, matrices4, [&](size_t i)
+		{
+			auto m = base4;
+			ShearInPlace(m, Vector2Type{ xs[i], ys[i] }, Vector2Type{ ys[i], zs[i] }, Vector2Type{ zs[i], xs[i] });
+			return m;
+		});
+
+		RunEach("ComposeTRS Matrix3x3" + suffix, matrices3, [&](size_t i)
+		{
+			return ComposeTRS(translations2.template Get<P>(i), angles[i], scales2.template Get<P>(i));
+		});
+		RunEach("ComposeTRS Matrix4x4" + suffix, matrices4, [&](size_t i)
+		{
+			return ComposeTRS(translations3.template Get<P>(i), angles[i], axes.template Get<P>(i), scales3.template Get<P>(i));
+		});
+		Run(("ComposeTRS Matrix3x3 (batch)" + suffix).c_str(), "ops", count, [&]()
+		{
+			ComposeTRS(matrices3.data(), translations2, angles.data(), scales2, count);
+			return FirstComponent(matrices3[count - 1]);
+		});
+		Run(("ComposeTRS Matrix4x4 (batch)" + suffix).c_str(), "ops", count, [&]()
+		{
+			ComposeTRS(matrices4.data(), translations3, angles.data(), axes, scales3, count);
+			return FirstComponent(matrices4[count - 1]);
+		});
+
+		// The transforms built above are the inputs of the normal matrices
+		std::vector<Matrix4x4<T, P>> transforms(count);
+		ComposeTRS(transforms.data(), translations3, angles.data(), axes, scales3, count);
+		RunEach("NormalMatrix Matrix3x3" + suffix, matrices3, [&](size_t i) { return NormalMatrix(Matrix3x3<T, P>{ transforms[i] }); });
+		RunEach("NormalMatrix Matrix4x4" + suffix, matrices3, [&](size_t i) { return NormalMatrix(transforms[i]); });
+		Run(("NormalMatrix Matrix4x4 (batch)" + suffix).c_str(), "ops", count, [&]()
+		{
+			NormalMatrix(matrices3.data(), transforms.data(), count);
+			return FirstComponent(matrices3[count - 1]);
+		});
+
+		// Projection parameters vary a little per matrix, so the builders can't be hoisted out of the loop
+		RunEach("Orthographic" + suffix, matrices4, [&](size_t i) { return Orthographic<T, P>(10.0f + static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f); });
+		RunEach("OrthographicGL" + suffix, matrices4, [&](size_t i) { return OrthographicGL<T, P>(10.0f + static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f); });
+		RunEach("Perpective" + suffix, matrices4, [&](size_t i) { return Perpective<T, P>(1.2f + 0.1f * static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f); });
+		RunEach("PerpectiveGL" + suffix, matrices4, [&](size_t i) { return PerpectiveGL<T, P>(1.2f + 0.1f * static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f); });
+		RunEach("PerspectiveProjection::Create + ToMatrix" + suffix, matrices4, [&](size_t i)
+		{
+			return PerspectiveProjection<T>::Create(1.2f + 0.1f * static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f).template ToMatrix<P>();
+		});
+		RunEach("OrthographicProjection::CreateGL + ToMatrix" + suffix, matrices4, [&](size_t i)
+		{
+			return OrthographicProjection<T>::CreateGL(10.0f + static_cast<float>(xs[i]), 16.0f / 9.0f, 0.1f, 100.0f).template ToMatrix<P>();
+		});
+
+		const auto projection = PerspectiveProjection<T>::Create(1.2f, 16.0f / 9.0f, 0.1f, 100.0f);
+		RunEach("view * PerspectiveProjection" + suffix, matrices4, [&](size_t i) { return transforms[i] * projection; });
+	}
+
+	void RunTransformBenchmarks()
+	{
+		using PWMath::PackingMode;
+
+		RunTransformOps<float, PackingMode::Packed>("float");
+		RunTransformOps<float, PackingMode::Fast>("float");
+		RunTransformOps<double, PackingMode::Packed>("double");
+		RunTransformOps<double, PackingMode::Fast>("double");
+	}
+}
@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+#include <PWMath/Triangle.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunTriangleBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t triangleCount = 4096, rayCount = 16;
+
+		std::mt19937 random{ 2 };
+		std::uniform_real_distribution<float> position{ -100.0f, 100.0f }, offset{ -5.0f, 5.0f }, direction{ -1.0f, 1.0f };
+
+		// Small triangles scattered in a box, most rays miss most of them like in a real scene
+		std::vector<float> components[9];
+		for (auto& component : components)
+			component.resize(triangleCount);
+		for (size_t i = 0; i < triangleCount; ++i)
+		{
+			const float x = position(random), y = position(random), z = position(random);
+			for (size_t v = 0; v < 3; ++v)
+			{
+				components[v * 3 + 0][i] = x + offset(random);
+				components[v * 3 + 1][i] = y + offset(random);
+				components[v * 3 + 2][i] = z + offset(random);
+			}
+		}
+		const TriangleStream<const float> triangles{
+			{ components[0].data(), components[1].data(), components[2].data() },
+			{ components[3].data(), components[4].data(), components[5].data() },
+			{ components[6].data(), components[7].data(), components[8].data() }
+		};
+
+		std::vector<RayF32> rays;
+		for (size_t i = 0; i < rayCount; ++i)
+			rays.push_back(RayF32{ { position(random), position(random), position(random) }, { direction(random), direction(random), direction(random) } });
+
+		Run("Ray vs triangles (single)", "triangles", triangleCount * rayCount, [&]()
+		{
+			size_t hits = 0;
+			for (const auto& ray : rays)
+			{
+				TriangleHitF32 hit;
+				for (size_t i = 0; i < triangleCount; ++i)
+					hits += Intersects(ray, triangles.vertex0.Get(i), triangles.vertex1.Get(i), triangles.vertex2.Get(i), 1000.0f, hit);
+			}
+			return hits;
+		});
+
+		Run("Ray vs triangles (nearest)", "triangles", triangleCount * rayCount, [&]()
+		{
+			size_t hits = 0;
+			for (const auto& ray : rays)
+			{
+				TriangleHitF32 hit;
+				hits += IntersectNearest(ray, triangles, triangleCount, 1000.0f, hit);
+			}
+			return hits;
+		});
+
+		Run("Ray vs triangles (nearest, watertight)", "triangles", triangleCount * rayCount, [&]()
+		{
+			size_t hits = 0;
+			for (const auto& ray : rays)
+			{
+				TriangleHitF32 hit;
+				hits += IntersectNearestWatertight(ray, triangles, triangleCount, 1000.0f, hit);
+			}
+			return hits;
+		});
+	}
+}
@@ -0,0 +1,124 @@
+#include "Benchmark.h"
+#include <PWMath/Vector.h>
+#include <PWMath/Vector2.h>
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
+
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Benchmark
+{
+	// Values in [1, 4] (or 1 to 100 for integers), so divisions and normalizations are well defined
+	template<typename T>
+	static T RandomValue(std::mt19937& random)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+			return std::uniform_real_distribution<T>{ 1, 4 }(random);
+		else
+			return static_cast<T>(std::uniform_int_distribution<int>{ 1, 100 }(random));
+	}
+
+	template<typename T, size_t L, PWMath::PackingMode P, size_t... I>
+	static PWMath::Vector<T, L, P> RandomVector(std::mt19937& random, std::index_sequence<I...>)
+	{
+		return PWMath::Vector<T, L, P>{ ((void)I, RandomValue<T>(random))... };
+	}
+
+	// Every operator and function of Vector<T, L, P>, each on 1024 vectors
+	template<typename T, size_t L, PWMath::PackingMode P>
+	static void RunVectorOps(const char* typeName)
+	{
+		using namespace PWMath;
+		using VectorType = Vector<T, L, P>;
+
+		constexpr size_t count = 1024;
+		const std::string prefix = "Vector" + std::to_string(L) + "<" + typeName + (P == PackingMode::Fast ? ", Fast> " : ", Packed> ");
+
+		std::mt19937 random{ 11 };
+		std::vector<VectorType> a(count), b(count), vectors(count);
+		std::vector<T> s(count), scalars(count);
+		std::vector<uint8_t> equal(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			a[i] = RandomVector<T, L, P>(random, std::make_index_sequence<L>{});
+			b[i] = RandomVector<T, L, P>(random, std::make_index_sequence<L>{});
+			s[i] = RandomValue<T>(random);
+		}
+
+		RunEach(prefix + "+a", vectors, [&](size_t i) { return +a[i]; });
+		RunEach(prefix + "-a", vectors, [&](size_t i) { return -a[i]; });
+
+		RunEach(prefix + "a + b", vectors, [&](size_t i) { return a[i] + b[i]; });
+		RunEach(prefix + "a - b", vectors, [&](size_t i) { return a[i] - b[i]; });
+		RunEach(prefix + "a * b", vectors, [&](size_t i) { return a[i] * b[i]; });
+		RunEach(prefix + "a / b", vectors, [&](size_t i) { return a[i] / b[i]; });
+		RunEach(prefix + "a += b", vectors, [&](size_t i) { VectorType v = a[i]; v += b[i]; return v; });
+		RunEach(prefix + "a -= b", vectors, [&](size_t i) { VectorType v = a[i]; v -= b[i]; return v; });
+		RunEach(prefix + "a *= b", vectors, [&](size_t i) { VectorType v = a[i]; v *= b[i]; return v; });
+		RunEach(prefix + "a /= b", vectors, [&](size_t i) { VectorType v = a[i]; v /= b[i]; return v; });
+
+		RunEach(prefix + "a + s", vectors, [&](size_t i) { return a[i] + s[i]; });
+		RunEach(prefix + "a - s", vectors, [&](size_t i) { return a[i] - s[i]; });
+		RunEach(prefix + "a * s", vectors, [&](size_t i) { return a[i] * s[i]; });
+		RunEach(prefix + "a / s", vectors, [&](size_t i) { return a[i] / s[i]; });
+		RunEach(prefix + "a += s", vectors, [&](size_t i) { VectorType v = a[i]; v += s[i]; return v; });
+		RunEach(prefix + "a -= s", vectors, [&](size_t i) { VectorType v = a[i]; v -= s[i]; return v; });
+		RunEach(prefix + "a *= s", vectors, [&](size_t i) { VectorType v = a[i]; v *= s[i]; return v; });
+		RunEach(prefix + "a /= s", vectors, [&](size_t i) { VectorType v = a[i]; v /= s[i]; return v; });
+
+		RunEach(prefix + "s + a", vectors, [&](size_t i) { return s[i] + a[i]; });
+		RunEach(prefix + "s - a", vectors, [&](size_t i) { return s[i] - a[i]; });
+		RunEach(prefix + "s * a", vectors, [&](size_t i) { return s[i] * a[i]; });
+		RunEach(prefix + "s / a", vectors, [&](size_t i) { return s[i] / a[i]; });
+
+		RunEach(prefix + "a == b", equal, [&](size_t i) { return static_cast<uint8_t>(a[i] == b[i]); });
+
+		RunEach(prefix + "Dot", scalars, [&](size_t i) { return Dot(a[i], b[i]); });
+		RunEach(prefix + "Length2", scalars, [&](size_t i) { return Length2(a[i]); });
+		// Lengths of integer vectors are truncated, they're only measured for floating point ones
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			RunEach(prefix + "Length", scalars, [&](size_t i) { return Length(a[i]); });
+			RunEach(prefix + "Normalize", vectors, [&](size_t i) { return Normalize(a[i]); });
+		}
+		if constexpr (L == 3)
+			RunEach(prefix + "Cross", vectors, [&](size_t i) { return Cross(a[i], b[i]); });
+
+		// Reverses the components, with the indices known at compile time and at runtime
+		RunEach(prefix + "Swizzle<...>", vectors, [&]<size_t... I>(std::index_sequence<I...>)
+		{
+			return [&](size_t i) { return a[i].template Swizzle<(L - 1 - I)...>(); };
+		}(std::make_index_sequence<L>{}));
+		if constexpr (L > 1)
+		{
+			RunEach(prefix + "Swizzle(...)", vectors, [&]<size_t... I>(std::index_sequence<I...>)
+			{
+				return [&](size_t i) { return a[i].Swizzle((L - 1 - I)...); };
+			}(std::make_index_sequence<L>{}));
+		}
+	}
+
+	template<typename T>
+	static void RunVectorOpsForType(const char* typeName)
+	{
+		using PWMath::PackingMode;
+
+		RunVectorOps<T, 2, PackingMode::Packed>(typeName);
+		RunVectorOps<T, 2, PackingMode::Fast>(typeName);
+		RunVectorOps<T, 3, PackingMode::Packed>(typeName);
+		RunVectorOps<T, 3, PackingMode::Fast>(typeName);
+		RunVectorOps<T, 4, PackingMode::Packed>(typeName);
+		RunVectorOps<T, 4, PackingMode::Fast>(typeName);
+	}
+
+	void RunVectorBenchmarks()
+	{
+		RunVectorOpsForType<float>("float");
+		RunVectorOpsForType<double>("double");
+		RunVectorOpsForType<int32_t>("int");
+	}
+}
@@ -0,0 +1,49 @@
+#include "Benchmark.h"
+#include <PWMath/Viewport.h>
+#include <PWMath/Projection.h>
+
+#include <random>
+#include <vector>
+
+namespace Benchmark
+{
+	void RunViewportBenchmarks()
+	{
+		using namespace PWMath;
+
+		constexpr size_t pointCount = 1 << 16;
+
+		std::mt19937 random{ 5 };
+		std::uniform_real_distribution<float> position{ -10.0f, 10.0f };
+		std::vector<Vector3F32> points(pointCount);
+		for (auto& point : points)
+			point = Vector3F32{ position(random), position(random), position(random) + 15.0f };
+
+		const Matrix4x4F32 viewProjection = Perpective(1.2f, 16.0f / 9.0f, 0.1f, 100.0f);
+		const ViewportF32 viewport{ 0.0f, 0.0f, 1920.0f, 1080.0f };
+		std::vector<Vector3F32> screenPoints(pointCount);
+		std::vector<uint8_t> clipFlags(pointCount);
+
+		// One point at a time, the way it is written without the batch function
+		Run("Project to screen (scalar)", "points", pointCount, [&]()
+		{
+			for (size_t i = 0; i < pointCount; ++i)
+			{
+				Vector4F32 clip = Vector4F32{ points[i].x, points[i].y, points[i].z, 1.0f } * viewProjection;
+				clip /= clip.w;
+				screenPoints[i] = Vector3F32{ (clip.x + 1.0f) * 960.0f, (1.0f - clip.y) * 540.0f, clip.z };
+			}
+			return screenPoints[pointCount - 1].x;
+		});
+		Run("Project to screen (batch)", "points", pointCount, [&]()
+		{
+			ProjectToScreen(screenPoints.data(), nullptr, viewProjection, viewport, points.data(), pointCount);
+			return screenPoints[pointCount - 1].x;
+		});
+		Run("Project to screen (batch, clip flags)", "points", pointCount, [&]()
+		{
+			ProjectToScreen(screenPoints.data(), clipFlags.data(), viewProjection, viewport, points.data(), pointCount);
+			return screenPoints[pointCount - 1].x;
+		});
+	}
+}
@@ -0,0 +1,108 @@
+#include "Benchmark.h"
+#include <PWMath/Matrix4x4.h>
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	// "8 KiB", "2 MiB", ...
+	static std::string SizeName(size_t bytes)
+	{
+		if (bytes >= (size_t{ 1 } << 20))
+			return std::to_string(bytes >> 20) + " MiB";
+		return std::to_string(bytes >> 10) + " KiB";
+	}
+
+	// Runs the Vector and Matrix kernels on arrays from L1 sized to DRAM sized
+	// Notes:
+	//  - The working set is the total size of the arrays a kernel reads and writes, the bytes per item are what it moves at that size
+	//  - Where items per second drop as the working set grows, the kernel has gone from compute bound to bandwidth bound for that cache level
+	//  - Run with --counters to see the L1 and last level cache misses per item rise at the same points
+	void RunWorkingSetBenchmarks()
+	{
+		using namespace PWMath;
+		using Vector3Packed = Vector3<float, PackingMode::Packed>;
+		using Vector4Fast = Vector4<float, PackingMode::Fast>;
+		using Matrix4x4Fast = Matrix4x4<float, PackingMode::Fast>;
+
+		std::mt19937 random{ 14 };
+		std::uniform_real_distribution<float> value{ 1.0f, 2.0f };
+		const auto randomVector4 = [&]() { return Vector4Fast{ value(random), value(random), value(random), value(random) }; };
+
+		const Matrix4x4Fast transform{ randomVector4(), randomVector4(), randomVector4(), randomVector4() };
+
+		for (size_t workingSet = size_t{ 8 } << 10; workingSet <= (size_t{ 128 } << 20); workingSet *= 4)
+		{
+			const std::string prefix = "Working set " + SizeName(workingSet) + ": ";
+
+			// a + b, two vectors read and one written
+			{
+				const size_t count = workingSet / (3 * sizeof(Vector4Fast));
+				std::vector<Vector4Fast> a(count), b(count), sums(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					a[i] = randomVector4();
+					b[i] = randomVector4();
+				}
+				Run((prefix + "Vector4<float, Fast> a + b").c_str(), "vectors", count, [&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						sums[i] = a[i] + b[i];
+					return sums[count - 1].x;
+				}, 0.25, 3.0 * sizeof(Vector4Fast));
+
+				// Dot, read only
+				Run((prefix + "Vector4<float, Fast> Dot (sum)").c_str(), "vectors", count, [&]()
+				{
+					float sum = 0.0f;
+					for (size_t i = 0; i < count; ++i)
+						sum += Dot(a[i], b[i]);
+					return sum;
+				}, 0.25, 2.0 * sizeof(Vector4Fast));
+
+				// v * matrix, one vector read and one written, the matrix stays in registers
+				Run((prefix + "Vector4<float, Fast> v * Matrix4x4").c_str(), "vectors", count, [&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						sums[i] = a[i] * transform;
+					return sums[count - 1].x;
+				}, 0.25, 2.0 * sizeof(Vector4Fast));
+			}
+
+			// Normalize in place, each vector read and written back
+			{
+				const size_t count = workingSet / sizeof(Vector3Packed);
+				std::vector<Vector3Packed> vectors(count);
+				for (auto& vector : vectors)
+					vector = Vector3Packed{ value(random), value(random), value(random) };
+				Run((prefix + "Vector3<float, Packed> Normalize").c_str(), "vectors", count, [&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						vectors[i] = Normalize(vectors[i]);
+					return vectors[count - 1].x;
+				}, 0.25, 2.0 * sizeof(Vector3Packed));
+			}
+
+			// a * b, two matrices read and one written
+			{
+				const size_t count = workingSet / (3 * sizeof(Matrix4x4Fast));
+				std::vector<Matrix4x4Fast> a(count), b(count), products(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					a[i] = Matrix4x4Fast{ randomVector4(), randomVector4(), randomVector4(), randomVector4() };
+					b[i] = Matrix4x4Fast{ randomVector4(), randomVector4(), randomVector4(), randomVector4() };
+				}
+				Run((prefix + "Matrix4x4<float, Fast> a * b").c_str(), "matrices", count, [&]()
+				{
+					for (size_t i = 0; i < count; ++i)
+						products[i] = a[i] * b[i];
+					return products[count - 1][0][0];
+				}, 0.25, 3.0 * sizeof(Matrix4x4Fast));
+			}
+		}
+	}
+}
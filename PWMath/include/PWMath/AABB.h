@@ -0,0 +1,94 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/Matrix4x4.h>
+#include <PWMath/Stream.h>
+
+#include <type_traits>
+
+namespace PWMath
+{
+	// Axis aligned bounding box
+	// Notes:
+	//  - Meant for floating point T, Center, Extent and Transform halve the size, which would round odd integer boxes down
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct AABB
+	{
+		using Type = T;
+		using VectorType = Vector3<T, P>;
+		static constexpr PackingMode packingMode = P;
+
+		Vector3<T, P> min, max;
+
+		// Default constructors
+		AABB() = default;
+		AABB(const AABB&) = default;
+		~AABB() = default;
+
+		// Special constructors
+		constexpr AABB(const Vector3<T, P>& min, const Vector3<T, P>& max) noexcept :min{ min }, max{ max } {}
+
+		// A box that contains nothing, merging anything into it gives back what was merged
+		static constexpr AABB Empty();
+
+		AABB& operator=(const AABB&) = default;
+
+		bool operator==(const AABB&) const = default;
+
+		constexpr Vector3<T, P> Center() const;
+		// Half of the size
+		constexpr Vector3<T, P> Extent() const;
+	};
+
+	// Smallest box containing both boxes
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Merge(const AABB<T, P>& lhs, const AABB<T, P>& rhs);
+
+	// Smallest box containing the box and the point
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Merge(const AABB<T, P>& box, const Vector3<T, P>& point);
+
+	// Box where both boxes overlap
+	// Notes:
+	//  - When the boxes don't overlap, the result has a min greater than its max on at least one axis
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Intersection(const AABB<T, P>& lhs, const AABB<T, P>& rhs);
+
+	// Tests if two boxes overlap (touching counts)
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const AABB<T, P>& lhs, const AABB<T, P>& rhs);
+
+	// Tests if a point is inside the box (on the surface counts)
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const AABB<T, P>& box, const Vector3<T, P>& point);
+
+	// Tests if a box is completely inside the other box
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const AABB<T, P>& box, const AABB<T, P>& inner);
+
+	// Transforms a box by a matrix and gives the box around the result
+	// Notes:
+	//  - Uses Arvo's method: the center is transformed and the extent is transformed with the absolute value of the matrix,
+	//    about the cost of one matrix-vector multiplication instead of transforming all 8 corners
+	//  - The matrix is expected to be affine (last column of 0, 0, 0, 1)
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Transform(const AABB<T, P>& box, const Matrix4x4<T, P>& matrix);
+
+	// Transforms count boxes, each by its own matrix
+	// Notes:
+	//  - transformed[i] is Transform(boxes[i], matrices[i])
+	template<typename T, PackingMode P>
+	void Transform(AABB<T, P>* transformed, const AABB<T, P>* boxes, const Matrix4x4<T, P>* matrices, size_t count);
+
+	// Transforms count boxes stored as SoA min and max streams, each by its own matrix
+	// Notes:
+	//  - The output streams can be passed straight to CullBoxes
+	//  - Float boxes are transformed Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	void Transform(std::type_identity_t<Vector3Stream<T>> transformedMins, std::type_identity_t<Vector3Stream<T>> transformedMaxs,
+		std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, const Matrix4x4<T, P>* matrices, size_t count);
+
+	using AABBF32 = AABB<float>;
+	using AABBF64 = AABB<double>;
+}
+
+#include <PWMath/Impl/AABB.inl>
@@ -0,0 +1,87 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/AABB.h>
+#include <PWMath/Ray.h>
+#include <PWMath/Simd.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace PWMath
+{
+	// Bounding volume hierarchy over axis aligned boxes, with wide nodes
+	// Notes:
+	//  - Each node holds the boxes of up to nodeWidth children as SoA arrays, so they are all tested at once
+	//  - A child is either another node or a leaf, a leaf being a range of primitiveIndices
+	//  - Only indices are stored, the boxes given to BuildBVH and Refit stay owned by the caller
+	//  - nodes[0] is the root and children always come after their parent
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct BVH
+	{
+		using Type = T;
+		using BoxType = AABB<T, P>;
+		static constexpr PackingMode packingMode = P;
+
+		// 8 children per node with AVX and up, 4 otherwise
+		static constexpr size_t nodeWidth = Simd::Lanes::width >= 8 ? 8 : 4;
+		// Ranges of primitives this size or smaller become leaves
+		static constexpr size_t maxLeafSize = 4;
+		// Deepest a node can be, the builder switches to median splits to stay under it
+		static constexpr size_t maxDepth = 64;
+
+		struct Node
+		{
+			T minX[nodeWidth], minY[nodeWidth], minZ[nodeWidth];
+			T maxX[nodeWidth], maxY[nodeWidth], maxZ[nodeWidth];
+			// Node index of inner children, first index into primitiveIndices for leaves
+			uint32_t children[nodeWidth];
+			// Primitive count of leaves, 0 for inner children
+			uint32_t counts[nodeWidth];
+			// Only the first childCount children are used
+			uint32_t childCount;
+
+			AABB<T, P> ChildBounds(size_t child) const;
+			void SetChildBounds(size_t child, const AABB<T, P>& box);
+			// Box around all the children
+			AABB<T, P> Bounds() const;
+		};
+
+		std::vector<Node> nodes;
+		std::vector<uint32_t> primitiveIndices;
+		AABB<T, P> bounds = AABB<T, P>::Empty();
+	};
+
+	// Builds a BVH over count boxes with the binned surface area heuristic (SAH)
+	// Notes:
+	//  - Each node is filled by repeatedly splitting its largest child until there are nodeWidth of them
+	//  - Large ranges are binned on all cores, and large subtrees are built on their own threads, never more of them than hardware threads
+	//  - The primitive indices given to the traversal callbacks index into boxes
+	template<typename T, PackingMode P>
+	BVH<T, P> BuildBVH(const AABB<T, P>* boxes, size_t count);
+
+	// Updates the node boxes after the primitives moved, keeping the structure of the tree
+	// Notes:
+	//  - boxes must have the same count and order as when the BVH was built
+	//  - A lot cheaper than a rebuild, but traversal gets slower as primitives move away from where they were at build time
+	template<typename T, PackingMode P>
+	void Refit(BVH<T, P>& bvh, const AABB<T, P>* boxes);
+
+	// Finds what a ray hits, calling intersector(primitiveIndex, maxDistance) for the primitives of the leaves the ray reaches
+	// Notes:
+	//  - The intersector returns true on a hit, and should lower maxDistance (a T&) to the hit distance so farther nodes get skipped
+	//  - Children are visited nearest first, returns true if the intersector returned true at least once
+	template<typename T, PackingMode P, typename Intersector>
+	bool Intersect(const BVH<T, P>& bvh, const Ray<T, P>& ray, std::type_identity_t<T> maxDistance, Intersector&& intersector);
+
+	// Calls callback(primitiveIndex) for the primitives of the leaves overlapping the box
+	// Notes:
+	//  - Leaves are tested as a whole, test the primitive boxes in the callback when exact results are needed
+	template<typename T, PackingMode P, typename Callback>
+	void Query(const BVH<T, P>& bvh, const AABB<T, P>& box, Callback&& callback);
+
+	using BVHF32 = BVH<float>;
+	using BVHF64 = BVH<double>;
+}
+
+#include <PWMath/Impl/BVH.inl>
@@ -0,0 +1,69 @@
+#pragma once
+#include <PWMath/Half.h>
+#include <PWMath/Packing.h>
+#include <PWMath/Vector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PWMath
+{
+	// How the r, g and b channels of a colour are stored, alpha is always linear
+	enum class ColorSpace
+	{
+		Linear,
+		Srgb,		// The sRGB transfer curve (IEC 61966-2-1)
+	};
+
+	// How the float colours of a conversion relate to alpha, the integer colours are always straight
+	enum class AlphaMode
+	{
+		Straight,
+		Premultiplied,	// r, g and b are multiplied by alpha (in linear space)
+	};
+
+	// The sRGB transfer curve for one channel, computed in double
+	// Notes:
+	//  - The value is clamped to [0, 1] first (NaN becomes 0)
+	//  - The batch functions below approximate these, see their error bounds
+	float SrgbToLinear(float value);
+	float LinearToSrgb(float value);
+
+	// Applies the sRGB curve to the r, g and b channels of count colours in place, alpha is unchanged
+	// Notes:
+	//  - The channels are clamped to [0, 1] first (NaN becomes 0)
+	//  - Polynomials on Simd::Lanes, max relative error 7e-7 for SrgbToLinear and max absolute error 5e-7 for LinearToSrgb
+	template<PackingMode P>
+	void SrgbToLinear(Vector4<float, P>* colors, size_t count);
+	template<PackingMode P>
+	void LinearToSrgb(Vector4<float, P>* colors, size_t count);
+
+	// Multiplies (or divides) the r, g and b channels of count colours by their alpha in place
+	// Notes:
+	//  - Unpremultiplying a colour with an alpha of 0 (or less) gives r, g and b of 0
+	template<PackingMode P>
+	void PremultiplyAlpha(Vector4<float, P>* colors, size_t count);
+	template<PackingMode P>
+	void UnpremultiplyAlpha(Vector4<float, P>* colors, size_t count);
+
+	// Converts count unorm colours (uint8_t or uint16_t channels, 0 to the type's max) to float or Half colours (0 to 1)
+	// Notes:
+	//  - With ColorSpace::Srgb r, g and b are decoded to linear, 8-bit channels through a table (same as SrgbToLinear), 16-bit ones with the batch SrgbToLinear
+	//  - With AlphaMode::Premultiplied r, g and b are multiplied by alpha after decoding
+	//  - Works on blocks of colours with Simd::Lanes, several times faster than converting each colour with the Vector4 constructor
+	template<typename TFloat, PackingMode PFloat, typename TUnorm, PackingMode PUnorm>
+	void DecodeColors(Vector4<TFloat, PFloat>* output, const Vector4<TUnorm, PUnorm>* input, size_t count,
+		ColorSpace space = ColorSpace::Linear, AlphaMode alpha = AlphaMode::Straight);
+
+	// Converts count float or Half colours to unorm colours (uint8_t or uint16_t channels), the inverse of DecodeColors
+	// Notes:
+	//  - Channels are clamped to [0, 1] (NaN becomes 0), scaled to the type's max and rounded to nearest
+	//  - With AlphaMode::Premultiplied r, g and b are divided by alpha before encoding
+	//  - With ColorSpace::Srgb r, g and b go through the batch LinearToSrgb, 8-bit results differ from rounding LinearToSrgb for about 1 in a million values (the ones within 1e-4 of halfway)
+	//  - Decoding to float then encoding gives 8-bit and 16-bit colours back unchanged with straight alpha in either colour space (8-bit ones through Half too)
+	template<typename TUnorm, PackingMode PUnorm, typename TFloat, PackingMode PFloat>
+	void EncodeColors(Vector4<TUnorm, PUnorm>* output, const Vector4<TFloat, PFloat>* input, size_t count,
+		ColorSpace space = ColorSpace::Linear, AlphaMode alpha = AlphaMode::Straight);
+}
+
+#include <PWMath/Impl/Color.inl>
@@ -0,0 +1,160 @@
+#pragma once
+#include <PWMath/Packing.h>
+#include <PWMath/Vector.h>
+#include <PWMath/Matrix.h>
+#include <PWMath/Stream.h>
+
+#if PWM_DEFINE_OSTREAM
+#include <ostream>
+#endif // PWM_DEFINE_OSTREAM
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace PWMath
+{
+	// Fixed point number, raw / 2^F stored in the signed integer I
+	// Notes:
+	//  - Every operation is integer only, the results are bit identical on every compiler, platform and instruction set (and at compile time)
+	//  - Addition, substraction, negation and integer conversion wrap on overflow (done in the unsigned type, so it's defined behaviour)
+	//  - Multiplication rounds to nearest with ties toward +infinity and wraps on overflow the same way
+	//  - Division rounds the same way and saturates on overflow and on division by zero
+	//  - Integers convert implicitly (it's exact), floating point only explicitly since the rounding is the one place the platform shows up
+	//  - Usable as T in the vectors and matrices, Rotate and ComposeTRS take a Fixed angle and use the deterministic Sin and Cos below
+	template<typename I, size_t F>
+	struct Fixed
+	{
+		static_assert(std::is_integral_v<I> && std::is_signed_v<I>, "Fixed point needs a signed integer type");
+		static_assert(F > 0 && F < sizeof(I) * 8 - 1, "Fixed point needs at least one fraction and one integer bit");
+
+		using RawType = I;
+		static constexpr size_t fractionBits = F;
+		static constexpr I one = static_cast<I>(static_cast<I>(1) << F);
+
+		I raw;
+
+		// Default constructors
+		Fixed() = default;
+		Fixed(const Fixed&) = default;
+
+		// Special constructors
+		template<typename TInt> requires std::is_integral_v<TInt>
+		constexpr Fixed(TInt value) noexcept :raw{ static_cast<I>(static_cast<std::make_unsigned_t<I>>(static_cast<I>(value)) << F) } {}
+		// NOTE: Rounds to nearest, ties toward +infinity
+		template<typename TFloat> requires std::is_floating_point_v<TFloat>
+		explicit constexpr Fixed(TFloat value) noexcept;
+
+		static constexpr Fixed FromRaw(I raw) noexcept;
+
+		// NOTE: Rounds toward -infinity
+		template<typename TInt> requires std::is_integral_v<TInt>
+		explicit constexpr operator TInt() const noexcept { return static_cast<TInt>(raw >> F); }
+		template<typename TFloat> requires std::is_floating_point_v<TFloat>
+		explicit constexpr operator TFloat() const noexcept { return static_cast<TFloat>(static_cast<double>(raw) / static_cast<double>(one)); }
+
+		Fixed& operator=(const Fixed&) = default;
+
+		auto operator<=>(const Fixed&) const = default;
+		bool operator==(const Fixed&) const = default;
+	};
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator+(Fixed<I, F> value) noexcept;
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator-(Fixed<I, F> value) noexcept;
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator+(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator-(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator*(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator/(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator+=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator-=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator*=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept;
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator/=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept;
+
+	// Overloads of the Scalar.h functions, picked over them for fixed point arguments
+	// Notes:
+	//  - Sqrt rounds to nearest and returns 0 for negative values
+	//  - Sin and Cos work in Q32.32 (any F up to 32), the result is within a few units of the last place
+	//  - Sin and Cos keep their accuracy for any angle the type can hold, the range reduction uses pi / 2 with 62 fraction bits
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Sqrt(Fixed<I, F> value);
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Sin(Fixed<I, F> angle);
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Cos(Fixed<I, F> angle);
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Tan(Fixed<I, F> angle);
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Abs(Fixed<I, F> value);
+
+	// Multiplication and dot product of 4 component vectors with 32-bit storage
+	// Notes:
+	//  - Uses pmuldq (SSE4) for Fast vectors, with the same results as the scalar code
+	//  - Other sizes and 64-bit storage go through the generic vector code, which calls the scalar operators
+	template<size_t F, PackingMode P>
+	constexpr Vector<Fixed<int32_t, F>, 4, P> operator*(const Vector<Fixed<int32_t, F>, 4, P>& lhs, const Vector<Fixed<int32_t, F>, 4, P>& rhs) noexcept;
+	template<size_t F, PackingMode P>
+	constexpr Fixed<int32_t, F> Dot(const Vector<Fixed<int32_t, F>, 4, P>& lhs, const Vector<Fixed<int32_t, F>, 4, P>& rhs);
+
+	// Dot products of count pairs of vectors, results[i] = Dot(lhs[i], rhs[i])
+	// Notes:
+	//  - 8 at a time with AVX2 and 4 at a time with SSE4 for 32-bit storage
+	//  - Each product is rounded before the sum like the single vector Dot, so the results match it bit for bit
+	template<typename I, size_t F>
+	void Dot(Fixed<I, F>* results, std::type_identity_t<Vector3Stream<const Fixed<I, F>>> lhs, std::type_identity_t<Vector3Stream<const Fixed<I, F>>> rhs, size_t count);
+
+#if PWM_DEFINE_OSTREAM
+	template<typename I, size_t F>
+	inline std::ostream& operator<<(std::ostream& stream, Fixed<I, F> value)
+	{
+		stream << static_cast<double>(value);
+		return stream;
+	}
+#endif // PWM_DEFINE_OSTREAM
+
+	using FixedQ16 = Fixed<int32_t, 16>; // Q16.16
+	using FixedQ32 = Fixed<int64_t, 32>; // Q32.32
+
+	using Vector2Q16	= Vector2<FixedQ16>;
+	using Vector2Q32	= Vector2<FixedQ32>;
+	using Vector3Q16	= Vector3<FixedQ16>;
+	using Vector3Q32	= Vector3<FixedQ32>;
+	using Vector4Q16	= Vector4<FixedQ16>;
+	using Vector4Q32	= Vector4<FixedQ32>;
+	using Vector4Q16Fast	= Vector4<FixedQ16, PackingMode::Fast>;
+
+	using Matrix2x2Q16 = Matrix2x2<FixedQ16>;
+	using Matrix2x2Q32 = Matrix2x2<FixedQ32>;
+	using Matrix3x3Q16 = Matrix3x3<FixedQ16>;
+	using Matrix3x3Q32 = Matrix3x3<FixedQ32>;
+	using Matrix4x4Q16 = Matrix4x4<FixedQ16>;
+	using Matrix4x4Q32 = Matrix4x4<FixedQ32>;
+}
+
+template<typename I, size_t F>
+class std::numeric_limits<PWMath::Fixed<I, F>>
+{
+public:
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = false;
+	static constexpr bool is_exact = true;
+
+	static constexpr PWMath::Fixed<I, F> min() noexcept { return PWMath::Fixed<I, F>::FromRaw(1); }
+	static constexpr PWMath::Fixed<I, F> lowest() noexcept { return PWMath::Fixed<I, F>::FromRaw(std::numeric_limits<I>::min()); }
+	static constexpr PWMath::Fixed<I, F> max() noexcept { return PWMath::Fixed<I, F>::FromRaw(std::numeric_limits<I>::max()); }
+	static constexpr PWMath::Fixed<I, F> epsilon() noexcept { return PWMath::Fixed<I, F>::FromRaw(1); }
+};
+
+#include <PWMath/Impl/Fixed.inl>
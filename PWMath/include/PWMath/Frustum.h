@@ -0,0 +1,90 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
+#include <PWMath/Matrix4x4.h>
+#include <PWMath/Stream.h>
+#include <PWMath/AABB.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace PWMath
+{
+	enum class FrustumPlane
+	{
+		Left,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far
+	};
+
+	// The 6 planes bounding the volume visible to a camera
+	// Notes:
+	//  - Each plane is a Vector4, xyz is the normal (pointing into the frustum) and w is the distance
+	//  - A point p is on the inside of a plane when Dot(plane.xyz, p) + plane.w >= 0
+	//  - The normals are normalized, so Dot(plane.xyz, p) + plane.w is the distance of p to the plane
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct Frustum
+	{
+		using Type = T;
+		using PlaneType = Vector4<T, P>;
+		static constexpr size_t planeCount = 6;
+		static constexpr PackingMode packingMode = P;
+
+		PlaneType planes[6];
+
+		PlaneType& operator[](FrustumPlane plane) { return planes[static_cast<size_t>(plane)]; }
+		const PlaneType& operator[](FrustumPlane plane) const { return planes[static_cast<size_t>(plane)]; }
+	};
+
+	// Extracts the frustum planes from a view * projection matrix
+	// Notes:
+	//  - For projections with the Z axis squished into a 0-1 range (ex: Perpective and Orthographic)
+	template<typename T, PackingMode P>
+	Frustum<T, P> ExtractFrustum(const Matrix4x4<T, P>& viewProjection);
+
+	// Extracts the frustum planes from a view * projection matrix
+	// Notes:
+	//  - For projections with the Z axis squished into a (-1)-1 range (ex: PerpectiveGL and OrthographicGL)
+	template<typename T, PackingMode P>
+	Frustum<T, P> ExtractFrustumGL(const Matrix4x4<T, P>& viewProjection);
+
+	// Tests if a sphere is at least partly inside of the frustum
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const Vector3<T, P>& center, T radius);
+
+	// Tests if an axis aligned box is at least partly inside of the frustum
+	// Notes:
+	//  - Conservative, boxes near the corners of the frustum may pass while being outside
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const Vector3<T, P>& min, const Vector3<T, P>& max);
+
+	// Tests if an axis aligned box is at least partly inside of the frustum
+	// Notes:
+	//  - Conservative, boxes near the corners of the frustum may pass while being outside
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const AABB<T, P>& box);
+
+	// Tests count spheres against the frustum and writes the indices of the visible ones
+	// Notes:
+	//  - visibleIndices must have room for count indices, returns the amount written
+	//  - The indices are written in increasing order
+	//  - Float spheres are tested Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	size_t CullSpheres(const Frustum<T, P>& frustum, std::type_identity_t<Vector3Stream<const T>> centers, const T* radii, size_t count, uint32_t* visibleIndices);
+
+	// Tests count axis aligned boxes against the frustum and writes the indices of the visible ones
+	// Notes:
+	//  - visibleIndices must have room for count indices, returns the amount written
+	//  - The indices are written in increasing order
+	//  - Float boxes are tested Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	size_t CullBoxes(const Frustum<T, P>& frustum, std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, size_t count, uint32_t* visibleIndices);
+
+	using FrustumF32 = Frustum<float>;
+	using FrustumF64 = Frustum<double>;
+}
+
+#include <PWMath/Impl/Frustum.inl>
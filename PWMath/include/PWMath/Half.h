@@ -0,0 +1,52 @@
+#pragma once
+#include <PWMath/Macros.h>
+#include <PWMath/Packing.h>
+#include <PWMath/Vector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PWMath
+{
+	// IEEE 754 half precision (binary16) float, a storage type
+	// Notes:
+	//  - Converts implicitly to and from float, arithmetic is done in float and rounded back when stored
+	//  - Rounds to nearest even, values past 65504 become infinity, NaNs stay NaNs (quieted)
+	//  - Uses F16C for single values at runtime when enabled, the portable conversion gives the same bits and works at compile time
+	//  - Use Convert for arrays, a Vector3<Half> is 6 bytes against 12 for a Vector3<float>
+	struct Half
+	{
+		uint16_t bits;
+
+		// Default constructors
+		Half() = default;
+		Half(const Half&) = default;
+
+		// Special constructors
+		constexpr Half(float value) noexcept;
+
+		static constexpr Half FromBits(uint16_t bits) noexcept;
+
+		constexpr operator float() const noexcept;
+
+		Half& operator=(const Half&) = default;
+	};
+
+	// Converts count values between float and half precision
+	// Notes:
+	//  - 8 at a time with F16C, the results are the same as converting one at a time
+	void Convert(Half* output, const float* input, size_t count);
+	void Convert(float* output, const Half* input, size_t count);
+
+	// Converts count vectors between float and half precision components
+	template<size_t L, PackingMode PHalf, PackingMode PFloat>
+	void Convert(Vector<Half, L, PHalf>* output, const Vector<float, L, PFloat>* input, size_t count);
+	template<size_t L, PackingMode PFloat, PackingMode PHalf>
+	void Convert(Vector<float, L, PFloat>* output, const Vector<Half, L, PHalf>* input, size_t count);
+
+	using Vector2F16 = Vector2<Half>;
+	using Vector3F16 = Vector3<Half>;
+	using Vector4F16 = Vector4<Half>;
+}
+
+#include <PWMath/Impl/Half.inl>
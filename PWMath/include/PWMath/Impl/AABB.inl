@@ -0,0 +1,153 @@
+#pragma once
+#include <PWMath/AABB.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace PWMath
+{
+#pragma region Member functions
+
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> AABB<T, P>::Empty()
+	{
+		return AABB<T, P>{ Vector3<T, P>{ std::numeric_limits<T>::max() }, Vector3<T, P>{ std::numeric_limits<T>::lowest() } };
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Vector3<T, P> AABB<T, P>::Center() const { return (min + max) / static_cast<T>(2); }
+
+	template<typename T, PackingMode P>
+	constexpr Vector3<T, P> AABB<T, P>::Extent() const { return (max - min) / static_cast<T>(2); }
+
+#pragma endregion
+
+#pragma region Functions
+
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Merge(const AABB<T, P>& lhs, const AABB<T, P>& rhs)
+	{
+		return AABB<T, P>{
+			Vector3<T, P>{ std::min(lhs.min.x, rhs.min.x), std::min(lhs.min.y, rhs.min.y), std::min(lhs.min.z, rhs.min.z) },
+			Vector3<T, P>{ std::max(lhs.max.x, rhs.max.x), std::max(lhs.max.y, rhs.max.y), std::max(lhs.max.z, rhs.max.z) }
+		};
+	}
+
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Merge(const AABB<T, P>& box, const Vector3<T, P>& point)
+	{
+		return Merge(box, AABB<T, P>{ point, point });
+	}
+
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Intersection(const AABB<T, P>& lhs, const AABB<T, P>& rhs)
+	{
+		return AABB<T, P>{
+			Vector3<T, P>{ std::max(lhs.min.x, rhs.min.x), std::max(lhs.min.y, rhs.min.y), std::max(lhs.min.z, rhs.min.z) },
+			Vector3<T, P>{ std::min(lhs.max.x, rhs.max.x), std::min(lhs.max.y, rhs.max.y), std::min(lhs.max.z, rhs.max.z) }
+		};
+	}
+
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const AABB<T, P>& lhs, const AABB<T, P>& rhs)
+	{
+		return lhs.min.x <= rhs.max.x && rhs.min.x <= lhs.max.x
+			&& lhs.min.y <= rhs.max.y && rhs.min.y <= lhs.max.y
+			&& lhs.min.z <= rhs.max.z && rhs.min.z <= lhs.max.z;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const AABB<T, P>& box, const Vector3<T, P>& point)
+	{
+		return box.min.x <= point.x && point.x <= box.max.x
+			&& box.min.y <= point.y && point.y <= box.max.y
+			&& box.min.z <= point.z && point.z <= box.max.z;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const AABB<T, P>& box, const AABB<T, P>& inner)
+	{
+		return Contains(box, inner.min) && Contains(box, inner.max);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr AABB<T, P> Transform(const AABB<T, P>& box, const Matrix4x4<T, P>& matrix)
+	{
+		const Vector3<T, P> center = box.Center(), extent = box.Extent();
+
+		// Points are row vectors, so output axis j takes column j of the matrix.
+		// The extent along an output axis is the largest the rotated and scaled extent can get, which is with all terms positive
+		Vector3<T, P> newCenter{ matrix[3][0], matrix[3][1], matrix[3][2] }, newExtent{ static_cast<T>(0) };
+		for (size_t i = 0; i < 3; ++i)
+		{
+			const Vector3<T, P> row{ matrix[i][0], matrix[i][1], matrix[i][2] };
+			newCenter += center[i] * row;
+			newExtent += extent[i] * Vector3<T, P>{ std::abs(row.x), std::abs(row.y), std::abs(row.z) };
+		}
+
+		return AABB<T, P>{ newCenter - newExtent, newCenter + newExtent };
+	}
+
+	template<typename T, PackingMode P>
+	void Transform(AABB<T, P>* transformed, const AABB<T, P>* boxes, const Matrix4x4<T, P>* matrices, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			transformed[i] = Transform(boxes[i], matrices[i]);
+	}
+
+	template<typename T, PackingMode P>
+	void Transform(std::type_identity_t<Vector3Stream<T>> transformedMins, std::type_identity_t<Vector3Stream<T>> transformedMaxs,
+		std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, const Matrix4x4<T, P>* matrices, size_t count)
+	{
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+			constexpr size_t stride = sizeof(Matrix4x4<T, P>) / sizeof(T);
+			const Lanes half = 0.5f;
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes minimum[3] = { Lanes::Load(mins.x + i), Lanes::Load(mins.y + i), Lanes::Load(mins.z + i) };
+				const Lanes maximum[3] = { Lanes::Load(maxs.x + i), Lanes::Load(maxs.y + i), Lanes::Load(maxs.z + i) };
+
+				Lanes center[3], extent[3];
+				for (size_t c = 0; c < 3; ++c)
+				{
+					center[c] = Lanes::Load(&matrices[i][3][c], stride);
+					extent[c] = 0.0f;
+				}
+
+				for (size_t r = 0; r < 3; ++r)
+				{
+					const Lanes boxCenter = (minimum[r] + maximum[r]) * half, boxExtent = (maximum[r] - minimum[r]) * half;
+					for (size_t c = 0; c < 3; ++c)
+					{
+						const Lanes element = Lanes::Load(&matrices[i][r][c], stride);
+						center[c] = MulAdd(boxCenter, element, center[c]);
+						extent[c] = MulAdd(boxExtent, Abs(element), extent[c]);
+					}
+				}
+
+				(center[0] - extent[0]).Store(transformedMins.x + i);
+				(center[1] - extent[1]).Store(transformedMins.y + i);
+				(center[2] - extent[2]).Store(transformedMins.z + i);
+				(center[0] + extent[0]).Store(transformedMaxs.x + i);
+				(center[1] + extent[1]).Store(transformedMaxs.y + i);
+				(center[2] + extent[2]).Store(transformedMaxs.z + i);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const AABB<T, P> box = Transform(AABB<T, P>{ mins.template Get<P>(i), maxs.template Get<P>(i) }, matrices[i]);
+			transformedMins.Set(i, box.min);
+			transformedMaxs.Set(i, box.max);
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,616 @@
+#pragma once
+#include <PWMath/BVH.h>
+#include <PWMath/Parallel.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <future>
+#include <limits>
+#include <utility>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		template<typename T, PackingMode P>
+		T HalfSurfaceArea(const AABB<T, P>& box)
+		{
+			const Vector3<T, P> size = box.max - box.min;
+			return size.x * size.y + size.y * size.z + size.z * size.x;
+		}
+
+		// Box held as two rows of 4 values, so growing it is one min and one max when Simd::Row is enabled (the 4th values are unused)
+		template<typename T>
+		struct BuildBox
+		{
+			T lower[4], upper[4];
+
+			static BuildBox Empty()
+			{
+				BuildBox box;
+				std::fill_n(box.lower, 4, std::numeric_limits<T>::max());
+				std::fill_n(box.upper, 4, std::numeric_limits<T>::lowest());
+				return box;
+			}
+
+			// Both pointers must have 4 readable values
+			void Grow(const T* otherLower, const T* otherUpper)
+			{
+				if constexpr (Simd::Row<T>::enabled)
+				{
+					using Row = Simd::Row<T>;
+					Row::Store(lower, Row::Min(Row::Load(lower), Row::Load(otherLower)));
+					Row::Store(upper, Row::Max(Row::Load(upper), Row::Load(otherUpper)));
+				}
+				else
+				{
+					for (size_t c = 0; c < 3; ++c)
+					{
+						lower[c] = std::min(lower[c], otherLower[c]);
+						upper[c] = std::max(upper[c], otherUpper[c]);
+					}
+				}
+			}
+
+			void Grow(const BuildBox& other) { Grow(other.lower, other.upper); }
+
+			template<PackingMode P>
+			AABB<T, P> ToAABB() const { return AABB<T, P>{ Vector3<T, P>{ lower[0], lower[1], lower[2] }, Vector3<T, P>{ upper[0], upper[1], upper[2] } }; }
+		};
+
+		template<typename T, PackingMode P>
+		class BVHBuilder
+		{
+		public:
+			using Node = typename BVH<T, P>::Node;
+
+			static constexpr size_t binCount = 16;
+			// Ranges this big have their bounds and bins computed on all cores
+			static constexpr size_t parallelBinningSize = size_t{ 1 } << 16;
+			// Subtrees this big are built on their own thread
+			static constexpr size_t parallelSubtreeSize = size_t{ 1 } << 14;
+			// Past this depth splits are made at the median, which bounds the depth of the tree
+			static constexpr size_t maxSAHDepth = BVH<T, P>::maxDepth / 2;
+
+			struct Range
+			{
+				size_t begin, end;
+				AABB<T, P> bounds;
+
+				size_t Size() const { return end - begin; }
+			};
+
+			BVHBuilder(const AABB<T, P>* boxes, size_t count)
+				:primitives(count)
+			{
+				ParallelFor(count, parallelBinningSize, [&](size_t, size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+						primitives[i] = Primitive{ boxes[i], boxes[i].Center(), static_cast<uint32_t>(i) };
+				});
+			}
+
+			AABB<T, P> Bounds(size_t begin, size_t end, bool parallel) const
+			{
+				return MergeRanges(begin, end, parallel, [](BuildBox<T>& box, const Primitive& primitive)
+				{
+					box.Grow(&primitive.box.min[0], &primitive.box.max[0]);
+				}).template ToAABB<P>();
+			}
+
+			// Writes the primitive indices in the order the leaves refer to them
+			void WriteIndices(uint32_t* indices) const
+			{
+				ParallelFor(primitives.size(), parallelBinningSize, [&](size_t, size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+						indices[i] = primitives[i].index;
+				});
+			}
+
+			// Builds the node for range into nodes, returns its index. The subtree runs on at most threads threads at once
+			uint32_t BuildNode(std::vector<Node>& nodes, const Range& range, size_t depth, bool parallel, size_t threads)
+			{
+				// Splits the largest child that is too big for a leaf until the node is full
+				Range children[BVH<T, P>::nodeWidth] = { range };
+				size_t childCount = 1;
+				while (childCount < BVH<T, P>::nodeWidth)
+				{
+					size_t largest = childCount;
+					T largestArea = static_cast<T>(-1);
+					for (size_t c = 0; c < childCount; ++c)
+					{
+						const T area = HalfSurfaceArea(children[c].bounds);
+						if (children[c].Size() > BVH<T, P>::maxLeafSize && area > largestArea)
+						{
+							largest = c;
+							largestArea = area;
+						}
+					}
+					if (largest == childCount)
+						break;
+
+					Range left, right;
+					Split(children[largest], left, right, depth, parallel);
+					children[largest] = left;
+					children[childCount++] = right;
+				}
+
+				const uint32_t index = static_cast<uint32_t>(nodes.size());
+				nodes.push_back(Node{});
+				nodes[index].childCount = static_cast<uint32_t>(childCount);
+
+				// Each child gets an equal share of the threads and children are only forked while there are threads to spare,
+				// so the thread count stays bounded however many large subtrees there are
+				const size_t childThreads = std::max<size_t>(threads / childCount, 1);
+				std::vector<std::pair<size_t, std::future<std::vector<Node>>>> subtrees;
+				for (size_t c = 0; c < childCount; ++c)
+				{
+					nodes[index].SetChildBounds(c, children[c].bounds);
+
+					if (children[c].Size() <= BVH<T, P>::maxLeafSize)
+					{
+						nodes[index].children[c] = static_cast<uint32_t>(children[c].begin);
+						nodes[index].counts[c] = static_cast<uint32_t>(children[c].Size());
+					}
+					else if (children[c].Size() >= parallelSubtreeSize && subtrees.size() + 1 < threads)
+					{
+						// The ranges don't overlap, so the subtrees can partition their part of the primitives at the same time.
+						// Binning stays on the subtree thread, the other subtrees keep the cores busy
+						subtrees.emplace_back(c, std::async(std::launch::async, [this, range = children[c], depth, childThreads]()
+						{
+							std::vector<Node> subtree;
+							BuildNode(subtree, range, depth + 1, false, childThreads);
+							return subtree;
+						}));
+					}
+					else
+					{
+						const uint32_t child = BuildNode(nodes, children[c], depth + 1, false, childThreads);
+						nodes[index].children[c] = child;
+						nodes[index].counts[c] = 0;
+					}
+				}
+
+				// Appends the subtrees, their node indices start at 0 so they get moved by where they land
+				for (auto& [c, future] : subtrees)
+				{
+					std::vector<Node> subtree = future.get();
+					const uint32_t offset = static_cast<uint32_t>(nodes.size());
+					for (auto& node : subtree)
+					{
+						for (size_t s = 0; s < node.childCount; ++s)
+						{
+							if (node.counts[s] == 0)
+								node.children[s] += offset;
+						}
+					}
+
+					nodes.insert(nodes.end(), subtree.begin(), subtree.end());
+					nodes[index].children[c] = offset;
+					nodes[index].counts[c] = 0;
+				}
+
+				return index;
+			}
+
+		private:
+			// The primitives are partitioned instead of indices to them, so binning reads memory in order.
+			// The box is followed by more members, so 4 values can be read from min, max and centroid
+			struct Primitive
+			{
+				AABB<T, P> box;
+				Vector3<T, P> centroid;
+				uint32_t index;
+			};
+
+			struct Bins
+			{
+				BuildBox<T> boxes[3][binCount];
+				size_t counts[3][binCount];
+
+				void Clear()
+				{
+					for (size_t axis = 0; axis < 3; ++axis)
+					{
+						std::fill(std::begin(boxes[axis]), std::end(boxes[axis]), BuildBox<T>::Empty());
+						std::fill(std::begin(counts[axis]), std::end(counts[axis]), size_t{ 0 });
+					}
+				}
+			};
+
+			std::vector<Primitive> primitives;
+
+			// Grows a box with grow(box, primitive) for every primitive in [begin, end)
+			template<typename Function>
+			BuildBox<T> MergeRanges(size_t begin, size_t end, bool parallel, Function&& grow) const
+			{
+				auto merge = [&](size_t first, size_t last)
+				{
+					BuildBox<T> box = BuildBox<T>::Empty();
+					for (size_t i = first; i < last; ++i)
+						grow(box, primitives[i]);
+					return box;
+				};
+				if (!parallel)
+					return merge(begin, end);
+
+				std::vector<BuildBox<T>> partial(ParallelRangeCount(end - begin, parallelBinningSize));
+				ParallelFor(end - begin, parallelBinningSize, [&](size_t range, size_t first, size_t last) { partial[range] = merge(begin + first, begin + last); });
+
+				BuildBox<T> box = BuildBox<T>::Empty();
+				for (const auto& part : partial)
+					box.Grow(part);
+				return box;
+			}
+
+			static size_t BinIndex(T centroid, T min, T scale)
+			{
+				return std::min(static_cast<size_t>((centroid - min) * scale), binCount - 1);
+			}
+
+			// Splits range in two, with the lowest SAH cost of the bin boundaries or at the median
+			void Split(const Range& range, Range& left, Range& right, size_t depth, bool parallel)
+			{
+				parallel = parallel && range.Size() >= parallelBinningSize;
+
+				const BuildBox<T> centroidBounds = MergeRanges(range.begin, range.end, parallel, [](BuildBox<T>& box, const Primitive& primitive)
+				{
+					box.Grow(&primitive.centroid[0], &primitive.centroid[0]);
+				});
+
+				T scales[3];
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					const T extent = centroidBounds.upper[axis] - centroidBounds.lower[axis];
+					scales[axis] = extent > static_cast<T>(0) ? static_cast<T>(binCount) / extent : static_cast<T>(0);
+				}
+
+				size_t bestAxis = 3, bestSplit = 0;
+				Bins bins;
+				if (depth < maxSAHDepth)
+				{
+					Bin(range, centroidBounds, scales, parallel, bins);
+
+					T bestCost = std::numeric_limits<T>::max();
+					for (size_t axis = 0; axis < 3; ++axis)
+					{
+						if (scales[axis] == static_cast<T>(0))
+							continue;
+
+						// Sweeps from the right to get the cost of everything right of each boundary, then from the left
+						T rightCosts[binCount];
+						BuildBox<T> rightBounds = BuildBox<T>::Empty();
+						size_t rightCount = 0;
+						for (size_t b = binCount - 1; b > 0; --b)
+						{
+							rightBounds.Grow(bins.boxes[axis][b]);
+							rightCount += bins.counts[axis][b];
+							rightCosts[b] = rightCount ? HalfSurfaceArea(rightBounds.template ToAABB<P>()) * static_cast<T>(rightCount) : static_cast<T>(0);
+						}
+
+						BuildBox<T> leftBounds = BuildBox<T>::Empty();
+						size_t leftCount = 0;
+						for (size_t b = 1; b < binCount; ++b)
+						{
+							leftBounds.Grow(bins.boxes[axis][b - 1]);
+							leftCount += bins.counts[axis][b - 1];
+							if (leftCount == 0 || leftCount == range.Size())
+								continue;
+
+							const T cost = HalfSurfaceArea(leftBounds.template ToAABB<P>()) * static_cast<T>(leftCount) + rightCosts[b];
+							if (cost < bestCost)
+							{
+								bestCost = cost;
+								bestAxis = axis;
+								bestSplit = b;
+							}
+						}
+					}
+				}
+
+				if (bestAxis == 3)
+				{
+					// Every centroid in the same spot, or too deep: splits in the middle of the range
+					const size_t middle = range.begin + range.Size() / 2;
+					const T extent[3] = {
+						centroidBounds.upper[0] - centroidBounds.lower[0], centroidBounds.upper[1] - centroidBounds.lower[1], centroidBounds.upper[2] - centroidBounds.lower[2]
+					};
+					const size_t axis = extent[0] >= extent[1] ? (extent[0] >= extent[2] ? 0 : 2) : (extent[1] >= extent[2] ? 1 : 2);
+					if (extent[axis] > static_cast<T>(0))
+					{
+						std::nth_element(primitives.begin() + range.begin, primitives.begin() + middle, primitives.begin() + range.end,
+							[&](const Primitive& lhs, const Primitive& rhs) { return lhs.centroid[axis] < rhs.centroid[axis]; });
+					}
+
+					left = Range{ range.begin, middle, Bounds(range.begin, middle, parallel) };
+					right = Range{ middle, range.end, Bounds(middle, range.end, parallel) };
+					return;
+				}
+
+				const T min = centroidBounds.lower[bestAxis], scale = scales[bestAxis];
+				const auto middle = std::partition(primitives.begin() + range.begin, primitives.begin() + range.end,
+					[&](const Primitive& primitive) { return BinIndex(primitive.centroid[bestAxis], min, scale) < bestSplit; });
+
+				BuildBox<T> leftBounds = BuildBox<T>::Empty(), rightBounds = BuildBox<T>::Empty();
+				for (size_t b = 0; b < binCount; ++b)
+					(b < bestSplit ? leftBounds : rightBounds).Grow(bins.boxes[bestAxis][b]);
+
+				left = Range{ range.begin, static_cast<size_t>(middle - primitives.begin()), leftBounds.template ToAABB<P>() };
+				right = Range{ left.end, range.end, rightBounds.template ToAABB<P>() };
+			}
+
+			void Bin(const Range& range, const BuildBox<T>& centroidBounds, const T scales[3], bool parallel, Bins& bins) const
+			{
+				auto bin = [&](Bins& target, size_t first, size_t last)
+				{
+					target.Clear();
+					for (size_t i = first; i < last; ++i)
+					{
+						const Primitive& primitive = primitives[i];
+						for (size_t axis = 0; axis < 3; ++axis)
+						{
+							const size_t b = BinIndex(primitive.centroid[axis], centroidBounds.lower[axis], scales[axis]);
+							target.boxes[axis][b].Grow(&primitive.box.min[0], &primitive.box.max[0]);
+							++target.counts[axis][b];
+						}
+					}
+				};
+				if (!parallel)
+				{
+					bin(bins, range.begin, range.end);
+					return;
+				}
+
+				std::vector<Bins> partial(ParallelRangeCount(range.Size(), parallelBinningSize));
+				ParallelFor(range.Size(), parallelBinningSize, [&](size_t part, size_t first, size_t last) { bin(partial[part], range.begin + first, range.begin + last); });
+
+				bins.Clear();
+				for (const auto& part : partial)
+				{
+					for (size_t axis = 0; axis < 3; ++axis)
+					{
+						for (size_t b = 0; b < binCount; ++b)
+						{
+							bins.boxes[axis][b].Grow(part.boxes[axis][b]);
+							bins.counts[axis][b] += part.counts[axis][b];
+						}
+					}
+				}
+			}
+		};
+
+		// Loads the first values of a node array, or the whole array when it is narrower than the lanes
+		template<size_t nodeWidth>
+		Simd::Lanes LoadChildren(const float* values, size_t first)
+		{
+			if constexpr (Simd::Lanes::width > nodeWidth)
+				return Simd::Lanes::LoadPartial(values, nodeWidth);
+			else
+				return Simd::Lanes::Load(values + first);
+		}
+	}
+
+#pragma region Member functions
+
+	template<typename T, PackingMode P>
+	AABB<T, P> BVH<T, P>::Node::ChildBounds(size_t child) const
+	{
+		return AABB<T, P>{ Vector3<T, P>{ minX[child], minY[child], minZ[child] }, Vector3<T, P>{ maxX[child], maxY[child], maxZ[child] } };
+	}
+
+	template<typename T, PackingMode P>
+	void BVH<T, P>::Node::SetChildBounds(size_t child, const AABB<T, P>& box)
+	{
+		minX[child] = box.min.x, minY[child] = box.min.y, minZ[child] = box.min.z;
+		maxX[child] = box.max.x, maxY[child] = box.max.y, maxZ[child] = box.max.z;
+	}
+
+	template<typename T, PackingMode P>
+	AABB<T, P> BVH<T, P>::Node::Bounds() const
+	{
+		AABB<T, P> box = AABB<T, P>::Empty();
+		for (size_t c = 0; c < childCount; ++c)
+			box = Merge(box, ChildBounds(c));
+		return box;
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	template<typename T, PackingMode P>
+	BVH<T, P> BuildBVH(const AABB<T, P>* boxes, size_t count)
+	{
+		BVH<T, P> bvh;
+		if (count == 0)
+			return bvh;
+
+		Detail::BVHBuilder<T, P> builder{ boxes, count };
+
+		bvh.bounds = builder.Bounds(0, count, true);
+		builder.BuildNode(bvh.nodes, { 0, count, bvh.bounds }, 0, true, HardwareThreadCount());
+
+		bvh.primitiveIndices.resize(count);
+		builder.WriteIndices(bvh.primitiveIndices.data());
+		return bvh;
+	}
+
+	template<typename T, PackingMode P>
+	void Refit(BVH<T, P>& bvh, const AABB<T, P>* boxes)
+	{
+		// Children come after their parent, so going backwards every child node is refitted before its parent
+		for (size_t n = bvh.nodes.size(); n-- > 0;)
+		{
+			auto& node = bvh.nodes[n];
+			for (size_t c = 0; c < node.childCount; ++c)
+			{
+				AABB<T, P> box = AABB<T, P>::Empty();
+				if (node.counts[c])
+				{
+					for (size_t i = node.children[c]; i < node.children[c] + node.counts[c]; ++i)
+						box = Merge(box, boxes[bvh.primitiveIndices[i]]);
+				}
+				else
+				{
+					box = bvh.nodes[node.children[c]].Bounds();
+				}
+				node.SetChildBounds(c, box);
+			}
+		}
+
+		bvh.bounds = bvh.nodes.empty() ? AABB<T, P>::Empty() : bvh.nodes[0].Bounds();
+	}
+
+	template<typename T, PackingMode P, typename Intersector>
+	bool Intersect(const BVH<T, P>& bvh, const Ray<T, P>& ray, std::type_identity_t<T> maxDistance, Intersector&& intersector)
+	{
+		constexpr size_t nodeWidth = BVH<T, P>::nodeWidth;
+		if (bvh.nodes.empty())
+			return false;
+
+		struct Entry
+		{
+			uint32_t child, count;
+			T distance;
+		};
+
+		// Each level adds at most nodeWidth - 1 entries
+		Entry stack[BVH<T, P>::maxDepth * (nodeWidth - 1) + 1];
+		size_t stackSize = 0;
+		stack[stackSize++] = Entry{ 0, 0, static_cast<T>(0) };
+
+		[[maybe_unused]] Simd::Lanes origin[3], inverseDirection[3];
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (size_t c = 0; c < 3; ++c)
+			{
+				origin[c] = ray.origin[c];
+				inverseDirection[c] = ray.inverseDirection[c];
+			}
+		}
+
+		bool hit = false;
+		while (stackSize)
+		{
+			const Entry entry = stack[--stackSize];
+			if (entry.distance > maxDistance)
+				continue;
+
+			if (entry.count)
+			{
+				for (uint32_t i = entry.child; i < entry.child + entry.count; ++i)
+				{
+					if (intersector(bvh.primitiveIndices[i], maxDistance))
+						hit = true;
+				}
+				continue;
+			}
+
+			const auto& node = bvh.nodes[entry.child];
+			T entries[std::max(nodeWidth, Simd::Lanes::width)];
+			uint32_t bits = 0;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+				for (size_t c = 0; c < nodeWidth; c += Lanes::width)
+				{
+					const Lanes min[3] = {
+						Detail::LoadChildren<nodeWidth>(node.minX, c), Detail::LoadChildren<nodeWidth>(node.minY, c), Detail::LoadChildren<nodeWidth>(node.minZ, c)
+					};
+					const Lanes max[3] = {
+						Detail::LoadChildren<nodeWidth>(node.maxX, c), Detail::LoadChildren<nodeWidth>(node.maxY, c), Detail::LoadChildren<nodeWidth>(node.maxZ, c)
+					};
+
+					Lanes distance;
+					bits |= Detail::IntersectSlabs(origin, inverseDirection, min, max, maxDistance, distance).Bits() << c;
+					distance.Store(entries + c);
+				}
+				bits &= (1u << node.childCount) - 1;
+			}
+			else
+			{
+				for (size_t c = 0; c < node.childCount; ++c)
+					bits |= static_cast<uint32_t>(Intersects(ray, node.ChildBounds(c), maxDistance, entries[c])) << c;
+			}
+
+			// Pushes the hit children farthest first, so the nearest one is popped next
+			const size_t first = stackSize;
+			for (; bits; bits &= bits - 1)
+			{
+				const size_t c = static_cast<size_t>(std::countr_zero(bits));
+				const Entry child{ node.children[c], node.counts[c], entries[c] };
+
+				size_t slot = stackSize++;
+				for (; slot > first && stack[slot - 1].distance < child.distance; --slot)
+					stack[slot] = stack[slot - 1];
+				stack[slot] = child;
+			}
+		}
+		return hit;
+	}
+
+	template<typename T, PackingMode P, typename Callback>
+	void Query(const BVH<T, P>& bvh, const AABB<T, P>& box, Callback&& callback)
+	{
+		constexpr size_t nodeWidth = BVH<T, P>::nodeWidth;
+		if (bvh.nodes.empty())
+			return;
+
+		uint32_t stack[BVH<T, P>::maxDepth * (nodeWidth - 1) + 1];
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		[[maybe_unused]] Simd::Lanes boxMin[3], boxMax[3];
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (size_t c = 0; c < 3; ++c)
+			{
+				boxMin[c] = box.min[c];
+				boxMax[c] = box.max[c];
+			}
+		}
+
+		while (stackSize)
+		{
+			const auto& node = bvh.nodes[stack[--stackSize]];
+			uint32_t bits = 0;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+				for (size_t c = 0; c < nodeWidth; c += Lanes::width)
+				{
+					const auto overlap = (Detail::LoadChildren<nodeWidth>(node.minX, c) <= boxMax[0]) & (Detail::LoadChildren<nodeWidth>(node.maxX, c) >= boxMin[0])
+						& (Detail::LoadChildren<nodeWidth>(node.minY, c) <= boxMax[1]) & (Detail::LoadChildren<nodeWidth>(node.maxY, c) >= boxMin[1])
+						& (Detail::LoadChildren<nodeWidth>(node.minZ, c) <= boxMax[2]) & (Detail::LoadChildren<nodeWidth>(node.maxZ, c) >= boxMin[2]);
+					bits |= overlap.Bits() << c;
+				}
+				bits &= (1u << node.childCount) - 1;
+			}
+			else
+			{
+				for (size_t c = 0; c < node.childCount; ++c)
+					bits |= static_cast<uint32_t>(Intersects(node.ChildBounds(c), box)) << c;
+			}
+
+			for (; bits; bits &= bits - 1)
+			{
+				const size_t c = static_cast<size_t>(std::countr_zero(bits));
+				if (node.counts[c])
+				{
+					for (uint32_t i = node.children[c]; i < node.children[c] + node.counts[c]; ++i)
+						callback(bvh.primitiveIndices[i]);
+				}
+				else
+				{
+					stack[stackSize++] = node.children[c];
+				}
+			}
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,323 @@
+#pragma once
+#include <PWMath/Color.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		inline double SrgbToLinearExact(double value)
+		{
+			const double srgb = value > 0.0 ? (value < 1.0 ? value : 1.0) : 0.0;
+			return srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4);
+		}
+
+		inline double LinearToSrgbExact(double value)
+		{
+			const double linear = value > 0.0 ? (value < 1.0 ? value : 1.0) : 0.0;
+			return linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+		}
+
+		// SrgbToLinear of every 8-bit value
+		inline const float* SrgbToLinearTable()
+		{
+			static const std::array<float, 256> table = []
+			{
+				std::array<float, 256> values{};
+				for (size_t i = 0; i < values.size(); i++)
+					values[i] = static_cast<float>(SrgbToLinearExact(static_cast<double>(i) / 255.0));
+				return values;
+			}();
+			return table.data();
+		}
+
+		// Clamps to [0, 1], NaN becomes 0 (Max returns its second operand for NaNs)
+		inline Simd::Lanes Saturate(Simd::Lanes value) { return Simd::Min(Simd::Max(value, 0.0f), 1.0f); }
+
+		// Evaluates c[0] + c[1] * t + ... + c[5] * t^5
+		inline Simd::Lanes Polynomial5(Simd::Lanes t, const float (&c)[6])
+		{
+			using Simd::MulAdd;
+			return MulAdd(MulAdd(MulAdd(MulAdd(MulAdd(c[5], t, c[4]), t, c[3]), t, c[2]), t, c[1]), t, c[0]);
+		}
+
+		// sRGB to linear for values in [0, 1]
+		// Notes:
+		//  - Above the linear segment the curve is x^2.4 for x = (srgb + 0.055) / 1.055, written as x^2 * u^1.6 for u = x^(1/4)
+		//  - u only spans [0.548, 1] where u^1.6 is smooth, a degree 5 polynomial in t = 4.429 * u - 3.429 is within 3e-7 of it
+		inline Simd::Lanes SrgbToLinear(Simd::Lanes srgb)
+		{
+			using Simd::Lanes;
+			constexpr float coefficients[6] = { 6.640255451e-01f, 3.098279834e-01f, 2.710417844e-02f, -1.052521053e-03f, 1.113834878e-04f, -1.669131598e-05f };
+
+			const Lanes x = (srgb + 0.055f) * (1.0f / 1.055f);
+			const Lanes u = Simd::Sqrt(Simd::Sqrt(x));
+			const Lanes curve = (x * x) * Polynomial5(Simd::MulAdd(u, 4.429127693f, -3.429127693f), coefficients);
+			return Simd::Select(srgb <= 0.04045f, srgb * (1.0f / 12.92f), curve);
+		}
+
+		// Linear to sRGB for values in [0, 1]
+		// Notes:
+		//  - Above the linear segment the curve is 1.055 * linear^(1/2.4) - 0.055, written as 1.055 * u^(10/3) - 0.055 for u = linear^(1/8)
+		//  - u only spans [0.486, 1], a degree 5 polynomial in t = 3.894 * u - 2.894 is within 3e-7 of the curve
+		inline Simd::Lanes LinearToSrgb(Simd::Lanes linear)
+		{
+			using Simd::Lanes;
+			constexpr float coefficients[6] = { 3.372518122e-01f, 4.518346190e-01f, 1.821618527e-01f, 2.797853947e-02f, 8.111763163e-04f, -3.810169073e-05f };
+
+			const Lanes u = Simd::Sqrt(Simd::Sqrt(Simd::Sqrt(linear)));
+			const Lanes curve = Polynomial5(Simd::MulAdd(u, 3.893769741f, -2.893769741f), coefficients);
+			return Simd::Select(linear <= 0.0031308f, linear * 12.92f, curve);
+		}
+
+		// Colours per block of the conversions, the block lives on the stack
+		inline constexpr size_t colorBlockSize = 256;
+
+		// Runs kernel(r, g, b, a) on count rgba colours in place, Simd::Lanes::width colours at a time
+		template<typename F>
+		void ForEachColorLanes(float* colors, size_t count, F&& kernel)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			size_t i = 0;
+			for (; i + width <= count; i += width)
+			{
+				Lanes r, g, b, a;
+				Lanes::LoadXYZW(colors + i * 4, r, g, b, a);
+				kernel(r, g, b, a);
+				Lanes::StoreXYZW(colors + i * 4, r, g, b, a);
+			}
+
+			if (i < count)
+			{
+				float tail[width * 4] = {};
+				std::copy_n(colors + i * 4, (count - i) * 4, tail);
+
+				Lanes r, g, b, a;
+				Lanes::LoadXYZW(tail, r, g, b, a);
+				kernel(r, g, b, a);
+				Lanes::StoreXYZW(tail, r, g, b, a);
+
+				std::copy_n(tail, (count - i) * 4, colors + i * 4);
+			}
+		}
+
+		// output[i] = input[i] * scale for count channels
+		template<typename TUnorm>
+		void UnormToFloat(float* output, const TUnorm* input, size_t count, float scale)
+		{
+			using Simd::Lanes;
+
+			size_t i = 0;
+			for (; i + Lanes::width <= count; i += Lanes::width)
+				(Lanes::Load(input + i) * scale).Store(output + i);
+			for (; i < count; i++)
+				output[i] = static_cast<float>(input[i]) * scale;
+		}
+
+		// output[i] = input[i] clamped to [0, 1] (NaN becomes 0), scaled to TUnorm's max and rounded to nearest, for count channels
+		template<typename TUnorm>
+		void FloatToUnorm(TUnorm* output, const float* input, size_t count)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			// Adding 1.5 * 2^23 leaves no fraction bits, so the addition rounds to nearest
+			const Lanes max = static_cast<float>(std::numeric_limits<TUnorm>::max()), round = 12582912.0f;
+			const auto quantize = [&](Lanes value) { return (Saturate(value) * max + round) - round; };
+
+			size_t i = 0;
+			for (; i + width <= count; i += width)
+				quantize(Lanes::Load(input + i)).Store(output + i);
+
+			if (i < count)
+			{
+				float tail[width] = {};
+				TUnorm encoded[width];
+				std::copy_n(input + i, count - i, tail);
+				quantize(Lanes::Load(tail)).Store(encoded);
+				std::copy_n(encoded, count - i, output + i);
+			}
+		}
+
+		template<typename TUnorm, typename TFloat, PackingMode PUnorm, PackingMode PFloat>
+		constexpr void CheckColorTypes()
+		{
+			static_assert(std::is_same_v<TUnorm, uint8_t> || std::is_same_v<TUnorm, uint16_t>, "Unorm colours have uint8_t or uint16_t channels");
+			static_assert(std::is_same_v<TFloat, float> || std::is_same_v<TFloat, Half>, "Float colours have float or Half channels");
+			static_assert(sizeof(Vector4<TUnorm, PUnorm>) == 4 * sizeof(TUnorm) && sizeof(Vector4<TFloat, PFloat>) == 4 * sizeof(TFloat),
+				"The conversions treat colours as one long array of channels");
+		}
+	}
+
+	inline float SrgbToLinear(float value)
+	{
+		return static_cast<float>(Detail::SrgbToLinearExact(value));
+	}
+
+	inline float LinearToSrgb(float value)
+	{
+		return static_cast<float>(Detail::LinearToSrgbExact(value));
+	}
+
+	template<PackingMode P>
+	void SrgbToLinear(Vector4<float, P>* colors, size_t count)
+	{
+		static_assert(sizeof(Vector4<float, P>) == 4 * sizeof(float));
+
+		Detail::ForEachColorLanes(reinterpret_cast<float*>(colors), count, [](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes&)
+			{
+				r = Detail::SrgbToLinear(Detail::Saturate(r));
+				g = Detail::SrgbToLinear(Detail::Saturate(g));
+				b = Detail::SrgbToLinear(Detail::Saturate(b));
+			});
+	}
+
+	template<PackingMode P>
+	void LinearToSrgb(Vector4<float, P>* colors, size_t count)
+	{
+		static_assert(sizeof(Vector4<float, P>) == 4 * sizeof(float));
+
+		Detail::ForEachColorLanes(reinterpret_cast<float*>(colors), count, [](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes&)
+			{
+				r = Detail::LinearToSrgb(Detail::Saturate(r));
+				g = Detail::LinearToSrgb(Detail::Saturate(g));
+				b = Detail::LinearToSrgb(Detail::Saturate(b));
+			});
+	}
+
+	template<PackingMode P>
+	void PremultiplyAlpha(Vector4<float, P>* colors, size_t count)
+	{
+		static_assert(sizeof(Vector4<float, P>) == 4 * sizeof(float));
+
+		Detail::ForEachColorLanes(reinterpret_cast<float*>(colors), count, [](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes& a)
+			{
+				r = r * a;
+				g = g * a;
+				b = b * a;
+			});
+	}
+
+	template<PackingMode P>
+	void UnpremultiplyAlpha(Vector4<float, P>* colors, size_t count)
+	{
+		static_assert(sizeof(Vector4<float, P>) == 4 * sizeof(float));
+
+		Detail::ForEachColorLanes(reinterpret_cast<float*>(colors), count, [](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes& a)
+			{
+				const Simd::LaneMask opaque = a > 0.0f;
+				r = Simd::Select(opaque, r / a, 0.0f);
+				g = Simd::Select(opaque, g / a, 0.0f);
+				b = Simd::Select(opaque, b / a, 0.0f);
+			});
+	}
+
+	template<typename TFloat, PackingMode PFloat, typename TUnorm, PackingMode PUnorm>
+	void DecodeColors(Vector4<TFloat, PFloat>* output, const Vector4<TUnorm, PUnorm>* input, size_t count, ColorSpace space, AlphaMode alpha)
+	{
+		Detail::CheckColorTypes<TUnorm, TFloat, PUnorm, PFloat>();
+
+		constexpr float scale = 1.0f / static_cast<float>(std::numeric_limits<TUnorm>::max());
+		// 8-bit sRGB goes through the table, 16-bit sRGB through the polynomial with the premultiplication
+		const float* table = (std::is_same_v<TUnorm, uint8_t> && space == ColorSpace::Srgb) ? Detail::SrgbToLinearTable() : nullptr;
+		const bool srgbCurve = !table && space == ColorSpace::Srgb, premultiply = alpha == AlphaMode::Premultiplied;
+
+		float block[Detail::colorBlockSize * 4];
+		for (size_t first = 0; first < count; first += Detail::colorBlockSize)
+		{
+			const size_t blockCount = std::min(Detail::colorBlockSize, count - first);
+			const TUnorm* channels = reinterpret_cast<const TUnorm*>(input + first);
+			// Float colours are decoded in place, Half ones in the block then converted
+			float* colors = block;
+			if constexpr (std::is_same_v<TFloat, float>)
+				colors = reinterpret_cast<float*>(output + first);
+
+			if (table)
+			{
+				for (size_t i = 0; i < blockCount * 4; i += 4)
+				{
+					colors[i] = table[channels[i]];
+					colors[i + 1] = table[channels[i + 1]];
+					colors[i + 2] = table[channels[i + 2]];
+					colors[i + 3] = static_cast<float>(channels[i + 3]) * scale;
+				}
+			}
+			else
+				Detail::UnormToFloat(colors, channels, blockCount * 4, scale);
+
+			if (srgbCurve || premultiply)
+			{
+				Detail::ForEachColorLanes(colors, blockCount, [srgbCurve, premultiply](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes& a)
+					{
+						if (srgbCurve)
+						{
+							r = Detail::SrgbToLinear(r);
+							g = Detail::SrgbToLinear(g);
+							b = Detail::SrgbToLinear(b);
+						}
+						if (premultiply)
+						{
+							r = r * a;
+							g = g * a;
+							b = b * a;
+						}
+					});
+			}
+
+			if constexpr (std::is_same_v<TFloat, Half>)
+				Convert(reinterpret_cast<Half*>(output + first), block, blockCount * 4);
+		}
+	}
+
+	template<typename TUnorm, PackingMode PUnorm, typename TFloat, PackingMode PFloat>
+	void EncodeColors(Vector4<TUnorm, PUnorm>* output, const Vector4<TFloat, PFloat>* input, size_t count, ColorSpace space, AlphaMode alpha)
+	{
+		Detail::CheckColorTypes<TUnorm, TFloat, PUnorm, PFloat>();
+
+		const bool srgb = space == ColorSpace::Srgb, unpremultiply = alpha == AlphaMode::Premultiplied;
+
+		float block[Detail::colorBlockSize * 4];
+		for (size_t first = 0; first < count; first += Detail::colorBlockSize)
+		{
+			const size_t blockCount = std::min(Detail::colorBlockSize, count - first);
+			// Float colours are read in place unless the curve or alpha has to be applied first, Half ones are converted to the block
+			const float* colors = block;
+			if constexpr (std::is_same_v<TFloat, Half>)
+				Convert(block, reinterpret_cast<const Half*>(input + first), blockCount * 4);
+			else if (srgb || unpremultiply)
+				std::copy_n(reinterpret_cast<const float*>(input + first), blockCount * 4, block);
+			else
+				colors = reinterpret_cast<const float*>(input + first);
+
+			if (srgb || unpremultiply)
+			{
+				Detail::ForEachColorLanes(block, blockCount, [srgb, unpremultiply](Simd::Lanes& r, Simd::Lanes& g, Simd::Lanes& b, Simd::Lanes& a)
+					{
+						if (unpremultiply)
+						{
+							const Simd::LaneMask opaque = a > 0.0f;
+							r = Simd::Select(opaque, r / a, 0.0f);
+							g = Simd::Select(opaque, g / a, 0.0f);
+							b = Simd::Select(opaque, b / a, 0.0f);
+						}
+						if (srgb)
+						{
+							r = Detail::LinearToSrgb(Detail::Saturate(r));
+							g = Detail::LinearToSrgb(Detail::Saturate(g));
+							b = Detail::LinearToSrgb(Detail::Saturate(b));
+						}
+					});
+			}
+
+			Detail::FloatToUnorm(reinterpret_cast<TUnorm*>(output + first), colors, blockCount * 4);
+		}
+	}
+}
@@ -0,0 +1,493 @@
+#pragma once
+#include <PWMath/Fixed.h>
+#include <PWMath/Simd.h>
+
+#include <cmath>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// 128-bit integer for the intermediates of the 64-bit fixed point types
+		// Notes:
+		//  - Holds either an unsigned value or a two's complement signed one, addition, substraction and left shifts are the same for both
+		//  - Uses the compiler's 128-bit integer when it has one, the portable code gives the same results
+		struct UInt128
+		{
+			uint64_t high;
+			uint64_t low;
+
+			constexpr UInt128() :high{ 0 }, low{ 0 } {}
+			constexpr UInt128(uint64_t low) :high{ 0 }, low{ low } {}
+			constexpr UInt128(uint64_t high, uint64_t low) :high{ high }, low{ low } {}
+
+			constexpr UInt128 operator+(UInt128 rhs) const { const uint64_t sum = low + rhs.low; return { high + rhs.high + (sum < low ? 1 : 0), sum }; }
+			constexpr UInt128 operator-(UInt128 rhs) const { return { high - rhs.high - (low < rhs.low ? 1 : 0), low - rhs.low }; }
+			constexpr UInt128 operator<<(size_t shift) const
+			{
+				if (shift == 0)
+					return *this;
+				if (shift >= 64)
+					return { low << (shift - 64), 0 };
+				return { (high << shift) | (low >> (64 - shift)), low << shift };
+			}
+			constexpr UInt128 operator>>(size_t shift) const
+			{
+				if (shift == 0)
+					return *this;
+				if (shift >= 64)
+					return { 0, high >> (shift - 64) };
+				return { high >> shift, (low >> shift) | (high << (64 - shift)) };
+			}
+
+			auto operator<=>(const UInt128&) const = default;
+			bool operator==(const UInt128&) const = default;
+		};
+
+		// Full 128-bit product of two unsigned 64-bit integers
+		constexpr UInt128 MultiplyWide(uint64_t lhs, uint64_t rhs)
+		{
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+			return { static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product) };
+#else
+			// Schoolbook multiplication on 32-bit halves
+			const uint64_t lhsLow = lhs & 0xFFFFFFFF, lhsHigh = lhs >> 32, rhsLow = rhs & 0xFFFFFFFF, rhsHigh = rhs >> 32;
+			const uint64_t lowLow = lhsLow * rhsLow, lowHigh = lhsLow * rhsHigh, highLow = lhsHigh * rhsLow, highHigh = lhsHigh * rhsHigh;
+			const uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+			return { highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32), (middle << 32) | (lowLow & 0xFFFFFFFF) };
+#endif
+		}
+
+		// lhs / rhs and its remainder, lhs.high has to be less than rhs so the quotient fits 64 bits
+		constexpr uint64_t DivideWide(UInt128 lhs, uint64_t rhs, uint64_t& remainder)
+		{
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 numerator = (static_cast<unsigned __int128>(lhs.high) << 64) | lhs.low;
+			remainder = static_cast<uint64_t>(numerator % rhs);
+			return static_cast<uint64_t>(numerator / rhs);
+#else
+			// Long division one bit at a time, rest stays below rhs so the only overflow is the bit shifted out of it
+			uint64_t quotient = 0, rest = lhs.high;
+			for (int bit = 63; bit >= 0; bit--)
+			{
+				const bool carry = (rest >> 63) != 0;
+				rest = (rest << 1) | ((lhs.low >> bit) & 1);
+				quotient <<= 1;
+				if (carry || rest >= rhs)
+				{
+					rest -= rhs;
+					quotient |= 1;
+				}
+			}
+			remainder = rest;
+			return quotient;
+#endif
+		}
+
+		// Exact product of two raw values, twice as wide (two's complement UInt128 for 64-bit storage)
+		constexpr int64_t ProductWide(int32_t lhs, int32_t rhs) { return static_cast<int64_t>(lhs) * rhs; }
+		constexpr UInt128 ProductWide(int64_t lhs, int64_t rhs)
+		{
+			// The unsigned product of the two's complement values, minus the other value shifted by 64 for each negative one
+			UInt128 product = MultiplyWide(static_cast<uint64_t>(lhs), static_cast<uint64_t>(rhs));
+			product.high -= (lhs < 0 ? static_cast<uint64_t>(rhs) : 0) + (rhs < 0 ? static_cast<uint64_t>(lhs) : 0);
+			return product;
+		}
+
+		// Product shifted back down by F bits, rounded to nearest with ties toward +infinity
+		template<typename I, size_t F>
+		constexpr I RoundProduct(int64_t product) { return static_cast<I>((product + (static_cast<int64_t>(1) << (F - 1))) >> F); }
+		template<typename I, size_t F>
+		constexpr I RoundProduct(UInt128 product)
+		{
+			product = product + UInt128{ static_cast<uint64_t>(1) << (F - 1) };
+			return static_cast<I>((product.high << (64 - F)) | (product.low >> F));
+		}
+
+		// Floor of the square root of value and the remainder value - root^2
+		// Notes:
+		//  - At runtime a double estimate is corrected with exact integer checks, the result is the same as the bit by bit version
+		template<typename W>
+		constexpr W SquareRootWide(W value, W& remainder)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				const auto square = [](uint64_t root) -> W
+				{
+					if constexpr (std::is_same_v<W, UInt128>)
+						return MultiplyWide(root, root);
+					else
+						return root * root;
+				};
+
+				double estimate = 0.0;
+				if constexpr (std::is_same_v<W, UInt128>)
+					estimate = std::sqrt(static_cast<double>(value.high) * 18446744073709551616.0 + static_cast<double>(value.low));
+				else
+					estimate = std::sqrt(static_cast<double>(value));
+
+				uint64_t root = static_cast<uint64_t>(estimate);
+				while (square(root) > value)
+					root--;
+				while (square(root + 1) <= value)
+					root++;
+				remainder = value - square(root);
+				return W{ root };
+			}
+
+			W root{ 0 }, bit = W{ 1 } << (sizeof(W) * 8 - 2);
+			while (bit > value)
+				bit = bit >> 2;
+
+			while (bit != W{ 0 })
+			{
+				if (value >= root + bit)
+				{
+					value = value - (root + bit);
+					root = (root >> 1) + bit;
+				}
+				else
+					root = root >> 1;
+				bit = bit >> 2;
+			}
+
+			remainder = value;
+			return root;
+		}
+
+		// 2^32 / n! rounded, the Taylor coefficients of sine and cosine in Q32.32
+		constexpr int64_t InverseFactorialQ32(uint64_t n)
+		{
+			uint64_t factorial = 1;
+			for (uint64_t i = 2; i <= n; i++)
+				factorial *= i;
+			return static_cast<int64_t>(((static_cast<uint64_t>(1) << 32) + factorial / 2) / factorial);
+		}
+
+		inline constexpr int64_t twoOverPiQ32 = 2734261102; // 2 / pi with 32 fraction bits
+		inline constexpr int64_t halfPiQ62 = 7244019458077122842; // pi / 2 with 62 fraction bits
+
+		// Sine or cosine of a Q32.32 angle as a Q32.32 raw value
+		constexpr int64_t SinCosQ32(int64_t angle, bool cosine)
+		{
+			using Q32 = Fixed<int64_t, 32>;
+
+			// Nearest number of quarter turns, then the angle minus that many quarter turns in [-pi/4, pi/4]
+			const UInt128 turns = ProductWide(angle, twoOverPiQ32) + UInt128{ static_cast<uint64_t>(1) << 63 };
+			const int64_t quadrant = static_cast<int64_t>(turns.high);
+			const Q32 reduced = Q32::FromRaw(angle - RoundProduct<int64_t, 30>(ProductWide(quadrant, halfPiQ62)));
+
+			// Each quarter turn rotates sin -> cos -> -sin -> -cos, so only one of the series is needed
+			const int64_t turn = (quadrant + (cosine ? 1 : 0)) & 3;
+
+			// Horner form of the Taylor series, the next term is below the last place on [-pi/4, pi/4]
+			const Q32 reduced2 = reduced * reduced;
+			const auto term = [](uint64_t n) { return Q32::FromRaw((n / 2) % 2 == 0 ? InverseFactorialQ32(n) : -InverseFactorialQ32(n)); };
+			const Q32 result = (turn & 1) == 0
+				? reduced * (Q32{ 1 } + reduced2 * (term(3) + reduced2 * (term(5) + reduced2 * (term(7) + reduced2 * (term(9) + reduced2 * term(11))))))
+				: Q32{ 1 } + reduced2 * (term(2) + reduced2 * (term(4) + reduced2 * (term(6) + reduced2 * (term(8) + reduced2 * (term(10) + reduced2 * term(12))))));
+			return (turn & 2) == 0 ? result.raw : (-result).raw;
+		}
+
+		template<typename I, size_t F>
+		constexpr Fixed<I, F> SinCos(Fixed<I, F> angle, bool cosine)
+		{
+			static_assert(F <= 32, "Sin and Cos work in Q32.32, more fraction bits than that aren't supported");
+
+			const int64_t result = SinCosQ32(static_cast<int64_t>(angle.raw) * (static_cast<int64_t>(1) << (32 - F)), cosine);
+			if constexpr (F == 32)
+				return Fixed<I, F>::FromRaw(static_cast<I>(result));
+			else
+				return Fixed<I, F>::FromRaw(RoundProduct<I, 32 - F>(result));
+		}
+
+#if PWM_USE_SSE4
+		// Products of 4 pairs of raw 32-bit values, rounded like RoundProduct
+		// Notes:
+		//  - pmuldq multiplies the even lanes, the odd ones are moved down for a second one
+		//  - The low 32 bits of each shifted product are the result, so a logical shift is as good as an arithmetic one
+		template<size_t F>
+		__m128i RoundProduct(__m128i lhs, __m128i rhs)
+		{
+			const __m128i round = _mm_set1_epi64x(static_cast<int64_t>(1) << (F - 1));
+			const __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(lhs, rhs), round), F);
+			const __m128i odd = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32)), round), F);
+			return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+		}
+#endif // PWM_USE_SSE4
+
+#if PWM_USE_AVX2
+		template<size_t F>
+		__m256i RoundProduct(__m256i lhs, __m256i rhs)
+		{
+			const __m256i round = _mm256_set1_epi64x(static_cast<int64_t>(1) << (F - 1));
+			const __m256i even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(lhs, rhs), round), F);
+			const __m256i odd = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(lhs, 32), _mm256_srli_epi64(rhs, 32)), round), F);
+			return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+		}
+#endif // PWM_USE_AVX2
+	}
+
+#pragma region Construction and conversion
+
+	template<typename I, size_t F>
+	template<typename TFloat> requires std::is_floating_point_v<TFloat>
+	constexpr Fixed<I, F>::Fixed(TFloat value) noexcept
+	{
+		// Scaling by a power of two is exact, only the rounding to an integer is left
+		const double scaled = static_cast<double>(value) * static_cast<double>(one);
+		I truncated = static_cast<I>(scaled);
+		const double fraction = scaled - static_cast<double>(truncated);
+		if (fraction >= 0.5)
+			truncated++;
+		else if (fraction < -0.5)
+			truncated--;
+		raw = truncated;
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Fixed<I, F>::FromRaw(I raw) noexcept
+	{
+		Fixed result{ 0 };
+		result.raw = raw;
+		return result;
+	}
+
+#pragma endregion
+
+#pragma region Arithmetic
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator+(Fixed<I, F> value) noexcept
+	{
+		return value;
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator-(Fixed<I, F> value) noexcept
+	{
+		// Negated as unsigned so the most negative value wraps to itself instead of overflowing
+		using U = std::make_unsigned_t<I>;
+		return Fixed<I, F>::FromRaw(static_cast<I>(U{ 0 } - static_cast<U>(value.raw)));
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator+(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept
+	{
+		using U = std::make_unsigned_t<I>;
+		return Fixed<I, F>::FromRaw(static_cast<I>(static_cast<U>(lhs.raw) + static_cast<U>(rhs.raw)));
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator-(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept
+	{
+		using U = std::make_unsigned_t<I>;
+		return Fixed<I, F>::FromRaw(static_cast<I>(static_cast<U>(lhs.raw) - static_cast<U>(rhs.raw)));
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator*(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept
+	{
+		return Fixed<I, F>::FromRaw(Detail::RoundProduct<I, F>(Detail::ProductWide(lhs.raw, rhs.raw)));
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> operator/(Fixed<I, F> lhs, Fixed<I, F> rhs) noexcept
+	{
+		using U = std::make_unsigned_t<I>;
+		constexpr U maxPositive = static_cast<U>(std::numeric_limits<I>::max());
+
+		const bool negative = (lhs.raw < 0) != (rhs.raw < 0);
+		if (rhs.raw == 0)
+			return Fixed<I, F>::FromRaw(lhs.raw < 0 ? std::numeric_limits<I>::min() : std::numeric_limits<I>::max());
+
+		// Divides the magnitudes (going through unsigned so the most negative value has one too)
+		const U numerator = lhs.raw < 0 ? static_cast<U>(U{ 0 } - static_cast<U>(lhs.raw)) : static_cast<U>(lhs.raw);
+		const U denominator = rhs.raw < 0 ? static_cast<U>(U{ 0 } - static_cast<U>(rhs.raw)) : static_cast<U>(rhs.raw);
+		U quotient = 0, remainder = 0;
+		bool overflow = false;
+		if constexpr (sizeof(I) <= 4)
+		{
+			const uint64_t wide = static_cast<uint64_t>(numerator) << F;
+			overflow = wide / denominator > maxPositive + 1;
+			quotient = static_cast<U>(wide / denominator);
+			remainder = static_cast<U>(wide % denominator);
+		}
+		else
+		{
+			const Detail::UInt128 wide = Detail::UInt128{ numerator } << F;
+			overflow = wide.high >= denominator;
+			if (!overflow)
+				quotient = Detail::DivideWide(wide, denominator, remainder);
+		}
+
+		// Rounds the magnitude so the signed result is rounded to nearest with ties toward +infinity,
+		// remainder >= denominator - remainder is 2 * remainder >= denominator without the overflow
+		const U rest = denominator - remainder;
+		if (!overflow && (negative ? remainder > rest : remainder >= rest))
+		{
+			quotient++;
+			overflow = quotient == 0;
+		}
+
+		if (overflow || quotient > maxPositive + (negative ? 1 : 0))
+			return Fixed<I, F>::FromRaw(negative ? std::numeric_limits<I>::min() : std::numeric_limits<I>::max());
+		return Fixed<I, F>::FromRaw(negative ? static_cast<I>(U{ 0 } - quotient) : static_cast<I>(quotient));
+	}
+
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator+=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept
+	{
+		return lhs = (lhs + rhs);
+	}
+
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator-=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept
+	{
+		return lhs = (lhs - rhs);
+	}
+
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator*=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept
+	{
+		return lhs = (lhs * rhs);
+	}
+
+	template<typename I, size_t F>
+	constexpr const Fixed<I, F>& operator/=(Fixed<I, F>& lhs, Fixed<I, F> rhs) noexcept
+	{
+		return lhs = (lhs / rhs);
+	}
+
+#pragma endregion
+
+#pragma region Scalar functions
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Sqrt(Fixed<I, F> value)
+	{
+		if (value.raw <= 0)
+			return Fixed<I, F>{ 0 };
+
+		// sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F), rounded up when the remainder is past (root + 1/2)^2 - root^2
+		if constexpr (sizeof(I) <= 4)
+		{
+			uint64_t remainder = 0;
+			uint64_t root = Detail::SquareRootWide(static_cast<uint64_t>(value.raw) << F, remainder);
+			return Fixed<I, F>::FromRaw(static_cast<I>(remainder > root ? root + 1 : root));
+		}
+		else
+		{
+			Detail::UInt128 remainder;
+			Detail::UInt128 root = Detail::SquareRootWide(Detail::UInt128{ static_cast<uint64_t>(value.raw) } << F, remainder);
+			return Fixed<I, F>::FromRaw(static_cast<I>(remainder > root ? root.low + 1 : root.low));
+		}
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Sin(Fixed<I, F> angle)
+	{
+		return Detail::SinCos(angle, false);
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Cos(Fixed<I, F> angle)
+	{
+		return Detail::SinCos(angle, true);
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Tan(Fixed<I, F> angle)
+	{
+		return Detail::SinCos(angle, false) / Detail::SinCos(angle, true);
+	}
+
+	template<typename I, size_t F>
+	constexpr Fixed<I, F> Abs(Fixed<I, F> value)
+	{
+		return value.raw < 0 ? -value : value;
+	}
+
+#pragma endregion
+
+#pragma region Vector functions
+
+	template<size_t F, PackingMode P>
+	constexpr Vector<Fixed<int32_t, F>, 4, P> operator*(const Vector<Fixed<int32_t, F>, 4, P>& lhs, const Vector<Fixed<int32_t, F>, 4, P>& rhs) noexcept
+	{
+#if PWM_USE_SSE4
+		if constexpr (P == PackingMode::Fast)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				Vector<Fixed<int32_t, F>, 4, P> result;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(result.array), Detail::RoundProduct<F>(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.array)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.array))));
+				return result;
+			}
+		}
+#endif // PWM_USE_SSE4
+
+		return Vector<Fixed<int32_t, F>, 4, P>{ lhs[0] * rhs[0], lhs[1] * rhs[1], lhs[2] * rhs[2], lhs[3] * rhs[3] };
+	}
+
+	template<size_t F, PackingMode P>
+	constexpr Fixed<int32_t, F> Dot(const Vector<Fixed<int32_t, F>, 4, P>& lhs, const Vector<Fixed<int32_t, F>, 4, P>& rhs)
+	{
+#if PWM_USE_SSE4
+		if constexpr (P == PackingMode::Fast)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				__m128i sum = Detail::RoundProduct<F>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.array)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.array)));
+				sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+				sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+				return Fixed<int32_t, F>::FromRaw(_mm_cvtsi128_si32(sum));
+			}
+		}
+#endif // PWM_USE_SSE4
+
+		return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
+	}
+
+	template<typename I, size_t F>
+	void Dot(Fixed<I, F>* results, std::type_identity_t<Vector3Stream<const Fixed<I, F>>> lhs, std::type_identity_t<Vector3Stream<const Fixed<I, F>>> rhs, size_t count)
+	{
+		size_t i = 0;
+
+#if PWM_USE_SSE4
+		if constexpr (std::is_same_v<I, int32_t>)
+		{
+			const auto* lhsX = reinterpret_cast<const int32_t*>(lhs.x), * lhsY = reinterpret_cast<const int32_t*>(lhs.y), * lhsZ = reinterpret_cast<const int32_t*>(lhs.z);
+			const auto* rhsX = reinterpret_cast<const int32_t*>(rhs.x), * rhsY = reinterpret_cast<const int32_t*>(rhs.y), * rhsZ = reinterpret_cast<const int32_t*>(rhs.z);
+			auto* output = reinterpret_cast<int32_t*>(results);
+
+#if PWM_USE_AVX2
+			const auto load = [](const int32_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); };
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256i x = Detail::RoundProduct<F>(load(lhsX + i), load(rhsX + i));
+				const __m256i y = Detail::RoundProduct<F>(load(lhsY + i), load(rhsY + i));
+				const __m256i z = Detail::RoundProduct<F>(load(lhsZ + i), load(rhsZ + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_add_epi32(_mm256_add_epi32(x, y), z));
+			}
+#endif // PWM_USE_AVX2
+
+			const auto load4 = [](const int32_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); };
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i x = Detail::RoundProduct<F>(load4(lhsX + i), load4(rhsX + i));
+				const __m128i y = Detail::RoundProduct<F>(load4(lhsY + i), load4(rhsY + i));
+				const __m128i z = Detail::RoundProduct<F>(load4(lhsZ + i), load4(rhsZ + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_add_epi32(_mm_add_epi32(x, y), z));
+			}
+		}
+#endif // PWM_USE_SSE4
+
+		for (; i < count; i++)
+			results[i] = lhs.x[i] * rhs.x[i] + lhs.y[i] * rhs.y[i] + lhs.z[i] * rhs.z[i];
+	}
+
+#pragma endregion
+}
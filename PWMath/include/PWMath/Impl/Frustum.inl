@@ -0,0 +1,161 @@
+#pragma once
+#include <PWMath/Frustum.h>
+#include <PWMath/Simd.h>
+
+#include <cmath>
+
+namespace PWMath
+{
+#pragma region Extraction
+
+	template<typename T, PackingMode P>
+	Frustum<T, P> ExtractFrustumGL(const Matrix4x4<T, P>& viewProjection)
+	{
+		// Points are transformed as row vectors, so the clip coordinates are the dot products with the columns.
+		// Each plane is where a clip coordinate meets w (ex: left is -w <= x, giving w + x >= 0)
+		const auto x = viewProjection.GetColumn(0), y = viewProjection.GetColumn(1), z = viewProjection.GetColumn(2), w = viewProjection.GetColumn(3);
+
+		Frustum<T, P> frustum{ { w + x, w - x, w + y, w - y, w + z, w - z } };
+
+		for (auto& plane : frustum.planes)
+			plane /= Length(Vector3<T, P>{ plane.x, plane.y, plane.z });
+		return frustum;
+	}
+
+	template<typename T, PackingMode P>
+	Frustum<T, P> ExtractFrustum(const Matrix4x4<T, P>& viewProjection)
+	{
+		// Same as the GL version, except that the near plane is at z = 0 instead of z = -w
+		Frustum<T, P> frustum = ExtractFrustumGL(viewProjection);
+
+		const auto z = viewProjection.GetColumn(2);
+		frustum[FrustumPlane::Near] = z / Length(Vector3<T, P>{ z.x, z.y, z.z });
+		return frustum;
+	}
+
+#pragma endregion
+
+#pragma region Single tests
+
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const Vector3<T, P>& center, T radius)
+	{
+		for (const auto& plane : frustum.planes)
+		{
+			if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const Vector3<T, P>& min, const Vector3<T, P>& max)
+	{
+		const auto center = (min + max) * static_cast<T>(0.5);
+		const auto extent = (max - min) * static_cast<T>(0.5);
+
+		for (const auto& plane : frustum.planes)
+		{
+			// Distance of the corner furthest along the normal
+			const T distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w
+				+ std::abs(plane.x) * extent.x + std::abs(plane.y) * extent.y + std::abs(plane.z) * extent.z;
+			if (distance < 0)
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, PackingMode P>
+	bool Intersects(const Frustum<T, P>& frustum, const AABB<T, P>& box)
+	{
+		return Intersects(frustum, box.min, box.max);
+	}
+
+#pragma endregion
+
+#pragma region Batch tests
+
+	template<typename T, PackingMode P>
+	size_t CullSpheres(const Frustum<T, P>& frustum, std::type_identity_t<Vector3Stream<const T>> centers, const T* radii, size_t count, uint32_t* visibleIndices)
+	{
+		size_t visible = 0, i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+
+			Lanes planes[6][4];
+			for (size_t p = 0; p < 6; ++p)
+				for (size_t c = 0; c < 4; ++c)
+					planes[p][c] = frustum.planes[p][c];
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes x = Lanes::Load(centers.x + i), y = Lanes::Load(centers.y + i), z = Lanes::Load(centers.z + i);
+				const Lanes negativeRadius = -Lanes::Load(radii + i);
+
+				auto inside = MulAdd(planes[0][0], x, MulAdd(planes[0][1], y, MulAdd(planes[0][2], z, planes[0][3]))) >= negativeRadius;
+				for (size_t p = 1; p < 6; ++p)
+					inside = inside & (MulAdd(planes[p][0], x, MulAdd(planes[p][1], y, MulAdd(planes[p][2], z, planes[p][3]))) >= negativeRadius);
+
+				visible += Simd::CompressIndices(inside.Bits(), static_cast<uint32_t>(i), visibleIndices + visible);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			if (Intersects(frustum, centers.template Get<P>(i), radii[i]))
+				visibleIndices[visible++] = static_cast<uint32_t>(i);
+		}
+		return visible;
+	}
+
+	template<typename T, PackingMode P>
+	size_t CullBoxes(const Frustum<T, P>& frustum, std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, size_t count, uint32_t* visibleIndices)
+	{
+		size_t visible = 0, i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+
+			Lanes planes[6][4], absPlanes[6][3];
+			for (size_t p = 0; p < 6; ++p)
+			{
+				for (size_t c = 0; c < 4; ++c)
+					planes[p][c] = frustum.planes[p][c];
+				for (size_t c = 0; c < 3; ++c)
+					absPlanes[p][c] = std::abs(frustum.planes[p][c]);
+			}
+
+			const Lanes half = 0.5f, zero = 0.0f;
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes minX = Lanes::Load(mins.x + i), minY = Lanes::Load(mins.y + i), minZ = Lanes::Load(mins.z + i);
+				const Lanes maxX = Lanes::Load(maxs.x + i), maxY = Lanes::Load(maxs.y + i), maxZ = Lanes::Load(maxs.z + i);
+				const Lanes centerX = (minX + maxX) * half, centerY = (minY + maxY) * half, centerZ = (minZ + maxZ) * half;
+				const Lanes extentX = (maxX - minX) * half, extentY = (maxY - minY) * half, extentZ = (maxZ - minZ) * half;
+
+				// Distance of the corner furthest along each normal
+				auto inside = MulAdd(planes[0][0], centerX, MulAdd(planes[0][1], centerY, MulAdd(planes[0][2], centerZ, planes[0][3])))
+					+ MulAdd(absPlanes[0][0], extentX, MulAdd(absPlanes[0][1], extentY, absPlanes[0][2] * extentZ)) >= zero;
+				for (size_t p = 1; p < 6; ++p)
+				{
+					inside = inside & (MulAdd(planes[p][0], centerX, MulAdd(planes[p][1], centerY, MulAdd(planes[p][2], centerZ, planes[p][3])))
+						+ MulAdd(absPlanes[p][0], extentX, MulAdd(absPlanes[p][1], extentY, absPlanes[p][2] * extentZ)) >= zero);
+				}
+
+				visible += Simd::CompressIndices(inside.Bits(), static_cast<uint32_t>(i), visibleIndices + visible);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			if (Intersects(frustum, mins.template Get<P>(i), maxs.template Get<P>(i)))
+				visibleIndices[visible++] = static_cast<uint32_t>(i);
+		}
+		return visible;
+	}
+
+#pragma endregion
+}
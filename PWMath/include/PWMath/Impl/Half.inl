@@ -0,0 +1,142 @@
+#pragma once
+#include <PWMath/Half.h>
+
+#if PWM_USE_F16C
+#include <immintrin.h>
+#endif // PWM_USE_F16C
+#include <bit>
+#include <type_traits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		constexpr uint16_t FloatToHalfBits(float value)
+		{
+			const uint32_t bits = std::bit_cast<uint32_t>(value);
+			const uint32_t sign = (bits >> 16) & 0x8000;
+			const uint32_t magnitude = bits & 0x7FFFFFFF;
+
+			// Infinity and NaN, NaNs keep the top of the payload and are quieted like F16C does
+			if (magnitude >= 0x7F800000)
+				return static_cast<uint16_t>(sign | 0x7C00 | (magnitude > 0x7F800000 ? 0x0200 | ((magnitude >> 13) & 0x03FF) : 0));
+			// 65520 and up round to infinity
+			if (magnitude >= 0x477FF000)
+				return static_cast<uint16_t>(sign | 0x7C00);
+
+			// Below the smallest normal half (2^-14) the result is the value in units of 2^-24, rounded to nearest even
+			if (magnitude < 0x38800000)
+			{
+				const uint32_t shift = 126 - (magnitude >> 23);
+				if (shift > 24)
+					return static_cast<uint16_t>(sign);
+
+				const uint32_t mantissa = (magnitude & 0x007FFFFF) | 0x00800000;
+				const uint32_t result = mantissa >> shift, rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+				return static_cast<uint16_t>(sign | (result + ((rest > halfway || (rest == halfway && (result & 1) != 0)) ? 1 : 0)));
+			}
+
+			// Rebiases the exponent (127 to 15) and rounds the mantissa from 23 to 10 bits, a carry out of the mantissa bumps the exponent as it should
+			const uint32_t rebiased = magnitude - 0x38000000;
+			return static_cast<uint16_t>(sign | ((rebiased + 0x0FFF + ((rebiased >> 13) & 1)) >> 13));
+		}
+
+		constexpr float HalfBitsToFloat(uint16_t half)
+		{
+			const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+			const uint32_t exponent = (half >> 10) & 0x1F, mantissa = half & 0x03FF;
+
+			// Infinity and NaN, NaNs are quieted like F16C does
+			if (exponent == 0x1F)
+				return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13) | (mantissa != 0 ? 0x00400000 : 0));
+			if (exponent != 0)
+				return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+
+			// Zero and subnormals, mantissa * 2^-24 is exact in float
+			const float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+			return sign != 0 ? -magnitude : magnitude;
+		}
+	}
+
+	constexpr Half::Half(float value) noexcept
+		:bits{ 0 }
+	{
+#if PWM_USE_F16C
+		if (!std::is_constant_evaluated())
+		{
+			bits = static_cast<uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+			return;
+		}
+#endif // PWM_USE_F16C
+
+		bits = Detail::FloatToHalfBits(value);
+	}
+
+	constexpr Half Half::FromBits(uint16_t bits) noexcept
+	{
+		Half result{ 0.0f };
+		result.bits = bits;
+		return result;
+	}
+
+	constexpr Half::operator float() const noexcept
+	{
+#if PWM_USE_F16C
+		if (!std::is_constant_evaluated())
+			return _cvtsh_ss(bits);
+#endif // PWM_USE_F16C
+
+		return Detail::HalfBitsToFloat(bits);
+	}
+
+	inline void Convert(Half* output, const float* input, size_t count)
+	{
+		size_t i = 0;
+
+#if PWM_USE_F16C
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT));
+#endif // PWM_USE_F16C
+
+		for (; i < count; i++)
+			output[i] = Half{ input[i] };
+	}
+
+	inline void Convert(float* output, const Half* input, size_t count)
+	{
+		size_t i = 0;
+
+#if PWM_USE_F16C
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(output + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))));
+#endif // PWM_USE_F16C
+
+		for (; i < count; i++)
+			output[i] = static_cast<float>(input[i]);
+	}
+
+	template<size_t L, PackingMode PHalf, PackingMode PFloat>
+	void Convert(Vector<Half, L, PHalf>* output, const Vector<float, L, PFloat>* input, size_t count)
+	{
+		// Without padding the vectors are one long array of components
+		if constexpr (sizeof(Vector<Half, L, PHalf>) == L * sizeof(Half) && sizeof(Vector<float, L, PFloat>) == L * sizeof(float))
+			Convert(reinterpret_cast<Half*>(output), reinterpret_cast<const float*>(input), count * L);
+		else
+		{
+			for (size_t i = 0; i < count; i++)
+				Convert(output[i].array, input[i].array, L);
+		}
+	}
+
+	template<size_t L, PackingMode PFloat, PackingMode PHalf>
+	void Convert(Vector<float, L, PFloat>* output, const Vector<Half, L, PHalf>* input, size_t count)
+	{
+		if constexpr (sizeof(Vector<Half, L, PHalf>) == L * sizeof(Half) && sizeof(Vector<float, L, PFloat>) == L * sizeof(float))
+			Convert(reinterpret_cast<float*>(output), reinterpret_cast<const Half*>(input), count * L);
+		else
+		{
+			for (size_t i = 0; i < count; i++)
+				Convert(output[i].array, input[i].array, L);
+		}
+	}
+}
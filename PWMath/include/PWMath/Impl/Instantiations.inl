@@ -0,0 +1,46 @@
+// No include guard, included once by PWMath.h with PWM_TEMPLATE defined to extern template,
+// and once by Instantiations.cpp with PWM_TEMPLATE defined to template
+#include <PWMath/PWMath.h>
+
+#ifndef PWM_TEMPLATE
+#error "Define PWM_TEMPLATE to template or extern template before including Instantiations.inl"
+#endif // PWM_TEMPLATE
+
+// The batch functions of one type and packing
+// Notes:
+//  - Only the batch functions (which aren't inline) are worth listing, an extern template doesn't stop the compiler from instantiating constexpr functions.
+//    The vector and matrix classes were listed once, which only made the files including PWMath.h slower to compile at -O0
+#define PWM_INSTANTIATE_TYPES(T, P) \
+	PWM_TEMPLATE void MakeRotation<T, P>(Matrix2x2<T, P>*, const T*, size_t); \
+	PWM_TEMPLATE void MakeRotation<T, P>(Matrix3x3<T, P>*, const T*, size_t); \
+	PWM_TEMPLATE void MakeRotation<T, P>(Matrix3x3<T, P>*, const T*, Vector3Stream<const T>, size_t); \
+	PWM_TEMPLATE void MakeRotation<T, P>(Matrix4x4<T, P>*, const T*, Vector3Stream<const T>, size_t); \
+	PWM_TEMPLATE void Rotate<T, P>(Matrix2x2<T, P>*, const T*, size_t); \
+	PWM_TEMPLATE void Rotate<T, P>(Matrix3x3<T, P>*, const T*, size_t); \
+	PWM_TEMPLATE void Rotate<T, P>(Matrix3x3<T, P>*, const T*, Vector3Stream<const T>, size_t); \
+	PWM_TEMPLATE void Rotate<T, P>(Matrix4x4<T, P>*, const T*, Vector3Stream<const T>, size_t); \
+	PWM_TEMPLATE void NormalMatrix<T, P>(Matrix3x3<T, P>*, const Matrix4x4<T, P>*, size_t); \
+	PWM_TEMPLATE void ComposeTRS<T, P>(Matrix3x3<T, P>*, Vector2Stream<const T>, const T*, Vector2Stream<const T>, size_t); \
+	PWM_TEMPLATE void ComposeTRS<T, P>(Matrix4x4<T, P>*, Vector3Stream<const T>, const T*, Vector3Stream<const T>, Vector3Stream<const T>, size_t); \
+	PWM_TEMPLATE void Project<T, ProjectionType::Perspective, P>(Vector4<T, P>*, const Vector3<T, P>*, const Projection<T, ProjectionType::Perspective>&, size_t); \
+	PWM_TEMPLATE void Project<T, ProjectionType::Perspective, P>(Vector4<T, P>*, const Vector4<T, P>*, const Projection<T, ProjectionType::Perspective>&, size_t); \
+	PWM_TEMPLATE void Project<T, ProjectionType::Orthographic, P>(Vector4<T, P>*, const Vector3<T, P>*, const Projection<T, ProjectionType::Orthographic>&, size_t); \
+	PWM_TEMPLATE void Project<T, ProjectionType::Orthographic, P>(Vector4<T, P>*, const Vector4<T, P>*, const Projection<T, ProjectionType::Orthographic>&, size_t); \
+	PWM_TEMPLATE Frustum<T, P> ExtractFrustum<T, P>(const Matrix4x4<T, P>&); \
+	PWM_TEMPLATE Frustum<T, P> ExtractFrustumGL<T, P>(const Matrix4x4<T, P>&); \
+	PWM_TEMPLATE void Transform<T, P>(AABB<T, P>*, const AABB<T, P>*, const Matrix4x4<T, P>*, size_t);
+
+namespace PWMath
+{
+	PWM_INSTANTIATE_TYPES(float, PackingMode::Packed)
+	PWM_INSTANTIATE_TYPES(float, PackingMode::Fast)
+	PWM_INSTANTIATE_TYPES(double, PackingMode::Packed)
+	PWM_INSTANTIATE_TYPES(double, PackingMode::Fast)
+
+	PWM_TEMPLATE void SinCos<float>(float*, float*, const float*, size_t);
+	PWM_TEMPLATE void SinCos<double>(double*, double*, const double*, size_t);
+	PWM_TEMPLATE void Project<float, ProjectionType::Perspective>(Vector4Stream<float>, Vector3Stream<const float>, const Projection<float, ProjectionType::Perspective>&, size_t);
+	PWM_TEMPLATE void Project<float, ProjectionType::Orthographic>(Vector4Stream<float>, Vector3Stream<const float>, const Projection<float, ProjectionType::Orthographic>&, size_t);
+}
+
+#undef PWM_INSTANTIATE_TYPES
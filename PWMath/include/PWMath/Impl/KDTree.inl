@@ -0,0 +1,271 @@
+#pragma once
+#include <PWMath/KDTree.h>
+#include <PWMath/Parallel.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <future>
+#include <limits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Subtrees this big are built on their own thread while there are hardware threads left
+		inline constexpr size_t kdTreeParallelBuildSize = size_t{ 1 } << 15;
+		// Batches of this many queries are split over all cores
+		inline constexpr size_t kdTreeParallelQueryCount = size_t{ 1 } << 10;
+
+		// Points are partitioned with their index instead of indices to them, so the build reads memory in order
+		template<typename T, size_t N, PackingMode P>
+		struct KDTreeEntry
+		{
+			Vector<T, N, P> point;
+			uint32_t index;
+		};
+
+		// Builds node over entries [begin, end), the subtree runs on at most threads threads at once
+		template<typename T, size_t N, PackingMode P>
+		void BuildKDNode(KDTree<T, N, P>& tree, KDTreeEntry<T, N, P>* entries, size_t node, size_t begin, size_t end, size_t threads)
+		{
+			if (node >= tree.InternalNodeCount())
+				return;
+
+			T min[N], max[N];
+			std::fill_n(min, N, std::numeric_limits<T>::max());
+			std::fill_n(max, N, std::numeric_limits<T>::lowest());
+			for (size_t i = begin; i < end; ++i)
+			{
+				for (size_t c = 0; c < N; ++c)
+				{
+					min[c] = std::min(min[c], entries[i].point[c]);
+					max[c] = std::max(max[c], entries[i].point[c]);
+				}
+			}
+
+			size_t axis = 0;
+			for (size_t c = 1; c < N; ++c)
+			{
+				if (max[c] - min[c] > max[axis] - min[axis])
+					axis = c;
+			}
+
+			const size_t middle = begin + (end - begin) / 2;
+			std::nth_element(entries + begin, entries + middle, entries + end,
+				[&](const KDTreeEntry<T, N, P>& lhs, const KDTreeEntry<T, N, P>& rhs) { return lhs.point[axis] < rhs.point[axis]; });
+			tree.splitValues[node] = entries[middle].point[axis];
+			tree.splitAxes[node] = static_cast<uint8_t>(axis);
+
+			// The halves split the threads, so forking stops once every thread has a subtree
+			if (threads > 1 && end - begin >= kdTreeParallelBuildSize)
+			{
+				auto first = std::async(std::launch::async, [&]() { BuildKDNode(tree, entries, 2 * node + 1, begin, middle, threads / 2); });
+				BuildKDNode(tree, entries, 2 * node + 2, middle, end, threads - threads / 2);
+				first.get();
+			}
+			else
+			{
+				BuildKDNode(tree, entries, 2 * node + 1, begin, middle, threads);
+				BuildKDNode(tree, entries, 2 * node + 2, middle, end, threads);
+			}
+		}
+
+		// Calls function(treeIndex, distance2) for the points in [begin, end) within the squared radius of center
+		template<typename T, size_t N, PackingMode P, typename Function>
+		void ForEachInLeaf(const KDTree<T, N, P>& tree, size_t begin, size_t end, const Vector<T, N, P>& center, const T& radius2, Function&& function)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+
+				Lanes centers[N];
+				for (size_t c = 0; c < N; ++c)
+					centers[c] = center[c];
+
+				for (size_t i = begin; i < end; i += Lanes::width)
+				{
+					// The last group of a leaf loads the lanes past its end as 0 and masks them out
+					const size_t count = std::min(Lanes::width, end - i);
+					Lanes distance2 = 0.0f;
+					for (size_t c = 0; c < N; ++c)
+					{
+						const float* values = tree.coordinates[c].data() + i;
+						const Lanes offset = (count == Lanes::width ? Lanes::Load(values) : Lanes::LoadPartial(values, count)) - centers[c];
+						distance2 = MulAdd(offset, offset, distance2);
+					}
+
+					uint32_t inside = (distance2 <= Lanes{ radius2 }).Bits() & ((1u << count) - 1);
+					if (inside == 0)
+						continue;
+
+					float distances2[Lanes::width];
+					distance2.Store(distances2);
+					for (; inside; inside &= inside - 1)
+					{
+						const size_t lane = static_cast<size_t>(std::countr_zero(inside));
+						function(i + lane, distances2[lane]);
+					}
+				}
+			}
+			else
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					T distance2 = static_cast<T>(0);
+					for (size_t c = 0; c < N; ++c)
+					{
+						const T offset = tree.coordinates[c][i] - center[c];
+						distance2 += offset * offset;
+					}
+					if (distance2 <= radius2)
+						function(i, distance2);
+				}
+			}
+		}
+
+		// Visits the leaves that can hold points within the squared radius of center, nearest side of each split first
+		// Notes:
+		//  - radius2 is read again before each node, so function can lower it while the tree is searched
+		template<typename T, size_t N, PackingMode P, typename Function>
+		void TraverseKDTree(const KDTree<T, N, P>& tree, const Vector<T, N, P>& center, const T& radius2, Function&& function)
+		{
+			// bound is the squared distance to the nearest split plane between center and the node
+			struct Entry
+			{
+				size_t node, begin, end;
+				T bound;
+			};
+
+			// At most one entry per level is left on the stack, and there are fewer than 64 levels
+			Entry stack[64];
+			size_t size = 0;
+			stack[size++] = Entry{ 0, 0, tree.PointCount(), static_cast<T>(0) };
+			while (size > 0)
+			{
+				const Entry entry = stack[--size];
+				if (entry.bound > radius2)
+					continue;
+
+				if (entry.node >= tree.InternalNodeCount())
+				{
+					ForEachInLeaf(tree, entry.begin, entry.end, center, radius2, function);
+					continue;
+				}
+
+				const size_t middle = entry.begin + (entry.end - entry.begin) / 2;
+				const T offset = center[tree.splitAxes[entry.node]] - tree.splitValues[entry.node];
+				const T farBound = std::max(entry.bound, offset * offset);
+
+				const Entry first{ 2 * entry.node + 1, entry.begin, middle, offset < static_cast<T>(0) ? entry.bound : farBound };
+				const Entry second{ 2 * entry.node + 2, middle, entry.end, offset < static_cast<T>(0) ? farBound : entry.bound };
+				if (offset < static_cast<T>(0))
+				{
+					stack[size++] = second;
+					stack[size++] = first;
+				}
+				else
+				{
+					stack[size++] = first;
+					stack[size++] = second;
+				}
+			}
+		}
+	}
+
+	template<typename T, size_t N, PackingMode P>
+	KDTree<T, N, P> BuildKDTree(const Vector<T, N, P>* points, size_t count)
+	{
+		using Tree = KDTree<T, N, P>;
+
+		Tree tree;
+		const size_t leafCount = std::bit_ceil(std::max<size_t>((count + Tree::leafSize - 1) / Tree::leafSize, 1));
+		tree.splitValues.resize(leafCount - 1);
+		tree.splitAxes.resize(leafCount - 1);
+
+		std::vector<Detail::KDTreeEntry<T, N, P>> entries(count);
+		for (size_t i = 0; i < count; ++i)
+			entries[i] = Detail::KDTreeEntry<T, N, P>{ points[i], static_cast<uint32_t>(i) };
+		Detail::BuildKDNode(tree, entries.data(), 0, 0, count, HardwareThreadCount());
+
+		tree.pointIndices.resize(count);
+		for (auto& coordinates : tree.coordinates)
+			coordinates.resize(count);
+		ParallelFor(count, Detail::kdTreeParallelBuildSize, [&](size_t, size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				tree.pointIndices[i] = entries[i].index;
+				for (size_t c = 0; c < N; ++c)
+					tree.coordinates[c][i] = entries[i].point[c];
+			}
+		});
+
+		return tree;
+	}
+
+	template<typename T, size_t N, PackingMode P>
+	size_t QueryNearest(const KDTree<T, N, P>& tree, const Vector<T, N, P>& point, size_t k, std::type_identity_t<T> maxDistance, uint32_t* indices, T* distances2)
+	{
+		if (k == 0 || tree.PointCount() == 0 || !(maxDistance >= static_cast<T>(0)))
+			return 0;
+
+		// Keeps the nearest points sorted, bound is the squared distance a point has to beat to get in
+		size_t found = 0;
+		T bound = maxDistance * maxDistance;
+		Detail::TraverseKDTree(tree, point, bound, [&](size_t sorted, T distance2)
+		{
+			if (found == k)
+			{
+				if (!(distance2 < distances2[k - 1]))
+					return;
+				--found;
+			}
+
+			size_t slot = found++;
+			for (; slot > 0 && distances2[slot - 1] > distance2; --slot)
+			{
+				distances2[slot] = distances2[slot - 1];
+				indices[slot] = indices[slot - 1];
+			}
+			distances2[slot] = distance2;
+			indices[slot] = tree.pointIndices[sorted];
+
+			if (found == k)
+				bound = distances2[k - 1];
+		});
+
+		return found;
+	}
+
+	template<typename T, size_t N, PackingMode P>
+	void QueryNearest(const KDTree<T, N, P>& tree, const Vector<T, N, P>* points, size_t count, size_t k, std::type_identity_t<T> maxDistance,
+		uint32_t* indices, T* distances2, uint32_t* counts)
+	{
+		ParallelFor(count, Detail::kdTreeParallelQueryCount, [&](size_t, size_t begin, size_t end)
+		{
+			for (size_t query = begin; query < end; ++query)
+				counts[query] = static_cast<uint32_t>(QueryNearest(tree, points[query], k, maxDistance, indices + query * k, distances2 + query * k));
+		});
+	}
+
+	template<typename T, size_t N, PackingMode P, typename Callback>
+	void QueryRadius(const KDTree<T, N, P>& tree, const Vector<T, N, P>& center, std::type_identity_t<T> radius, Callback&& callback)
+	{
+		if (tree.PointCount() == 0 || !(radius >= static_cast<T>(0)))
+			return;
+
+		const T radius2 = radius * radius;
+		Detail::TraverseKDTree(tree, center, radius2, [&](size_t sorted, T distance2) { callback(tree.pointIndices[sorted], distance2); });
+	}
+
+	template<typename T, size_t N, PackingMode P, typename Callback>
+	void QueryRadius(const KDTree<T, N, P>& tree, const Vector<T, N, P>* centers, size_t count, std::type_identity_t<T> radius, Callback&& callback)
+	{
+		ParallelFor(count, Detail::kdTreeParallelQueryCount, [&](size_t, size_t begin, size_t end)
+		{
+			for (size_t query = begin; query < end; ++query)
+				QueryRadius(tree, centers[query], radius, [&](uint32_t pointIndex, T distance2) { callback(static_cast<uint32_t>(query), pointIndex, distance2); });
+		});
+	}
+}
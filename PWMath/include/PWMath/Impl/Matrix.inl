@@ -0,0 +1,148 @@
+#pragma once
+#include <PWMath/Matrix.h>
+#include <PWMath/Stats.h>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Builds a matrix from function(r) for each row index r, expanded at compile time
+		template<typename TMat, typename Function, size_t... I>
+		PWM_FORCEINLINE constexpr TMat MakeMatrix(Function&& function, std::index_sequence<I...>)
+		{
+			return TMat{ function(I)... };
+		}
+
+		template<typename TMat, typename Function>
+		PWM_FORCEINLINE constexpr TMat MakeMatrix(Function&& function)
+		{
+			return MakeMatrix<TMat>(function, std::make_index_sequence<TMat::rows>{});
+		}
+	}
+
+#pragma region Unary operators
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator+(const Matrix<T, C, R, P>& rhs)
+	{
+		return rhs;
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator-(const Matrix<T, C, R, P>& rhs)
+	{
+		return Detail::MakeMatrix<Matrix<T, C, R, P>>([&](size_t r) { return -rhs[r]; });
+	}
+
+#pragma endregion
+
+#pragma region Addition and substraction
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator+(const Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		return Detail::MakeMatrix<Matrix<T, C, R, P>>([&](size_t r) { return lhs[r] + rhs[r]; });
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator-(const Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		return Detail::MakeMatrix<Matrix<T, C, R, P>>([&](size_t r) { return lhs[r] - rhs[r]; });
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator+=(Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		return lhs = (lhs + rhs);
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator-=(Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		return lhs = (lhs - rhs);
+	}
+
+#pragma endregion
+
+#pragma region Matrix-scalar multiplication
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(const Matrix<T, C, R, P>& lhs, T rhs)
+	{
+		return Detail::MakeMatrix<Matrix<T, C, R, P>>([&](size_t r) { return lhs[r] * rhs; });
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator*=(Matrix<T, C, R, P>& lhs, T rhs)
+	{
+		return lhs = (lhs * rhs);
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(T lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		return rhs * lhs;
+	}
+
+#pragma endregion
+
+#pragma region Matrix multiplication
+
+	template<typename T, size_t C, size_t N, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(const Matrix<T, N, R, P>& lhs, const Matrix<T, C, N, P>& rhs)
+	{
+		// Each row of the result is the row of lhs (a row vector) times rhs
+		PWM_STATS_COUNT(MatrixMultiply);
+		return Detail::MakeMatrix<Matrix<T, C, R, P>>([&](size_t r) { return lhs[r] * rhs; });
+	}
+
+	template<typename T, size_t C, PackingMode P>
+	constexpr const Matrix<T, C, C, P>& operator*=(Matrix<T, C, C, P>& lhs, const Matrix<T, C, C, P>& rhs)
+	{
+		return lhs = (lhs * rhs);
+	}
+
+#pragma endregion
+
+#pragma region Matrix-vector multiplication
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Vector<T, R, P> operator*(const Matrix<T, C, R, P>& lhs, const Vector<T, C, P>& rhs)
+	{
+		PWM_STATS_COUNT(MatrixVectorMultiply);
+		return Detail::MakeVector<Vector<T, R, P>>([&](size_t r) { return Dot(lhs[r], rhs); });
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Vector<T, C, P> operator*(const Vector<T, R, P>& lhs, const Matrix<T, C, R, P>& rhs)
+	{
+		// Component c is the dot product of lhs and column c of rhs, summed as scalars so it stays in registers
+		PWM_STATS_COUNT(MatrixVectorMultiply);
+		return Detail::MakeVector<Vector<T, C, P>>([&](size_t c) { return Detail::Sum<R>([&](size_t r) { return lhs[r] * rhs[r][c]; }); });
+	}
+
+	template<typename T, size_t C, PackingMode P>
+	constexpr const Vector<T, C, P>& operator*=(Vector<T, C, P>& lhs, const Matrix<T, C, C, P>& rhs)
+	{
+		return lhs = (lhs * rhs);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, R, C, P> Transpose(const Matrix<T, C, R, P>& matrix)
+	{
+		return Detail::MakeMatrix<Matrix<T, R, C, P>>([&](size_t c) { return matrix.GetColumn(c); });
+	}
+
+#pragma endregion
+
+#pragma region Member version of functions
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, R, C, P> Matrix<T, C, R, P>::Transpose() const { return PWMath::Transpose(*this); }
+
+#pragma endregion
+}
@@ -1,20 +1,21 @@
 #pragma once
 #include <PWMath/Matrix2x2.h>
+#include <PWMath/Stats.h>
 
 namespace PWMath
 {
 #pragma region Unary operators
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& rhs)
 	{
 		return rhs;
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& rhs)
 	{
-		return rhs * -1;
+		return rhs * static_cast<T>(-1);
 	}
 
 #pragma endregion
@@ -22,31 +23,31 @@ namespace PWMath
 #pragma region Addition and substraction
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		return Matrix<T, 2, 2, P>{
-			lhs.x + rhs.x,		// Using Vector2's operators to do the operation on rows at a time
-			lhs.y + rhs.y
+			lhs[0] + rhs[0],		// Using Vector2's operators to do the operation on rows at a time
+			lhs[1] + rhs[1]
 		};
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		return Matrix<T, 2, 2, P>{
-			lhs.x - rhs.x,		// Using Vector2's operators to do the operation on rows at a time
-			lhs.y - rhs.y
+			lhs[0] - rhs[0],		// Using Vector2's operators to do the operation on rows at a time
+			lhs[1] - rhs[1]
 		};
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator+=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr const Matrix<T, 2, 2, P>& operator+=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		return lhs = (lhs + rhs);
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator-=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr const Matrix<T, 2, 2, P>& operator-=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		return lhs = (lhs - rhs);
 	}
@@ -56,24 +57,24 @@ namespace PWMath
 #pragma region Matrix-scalar multiplication
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, T rhs)
+	constexpr Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, T rhs)
 	{
 		// I could've constructed an identity matrix, but I feel this is simpler and easier to understand.
 		// It may also make it easier for the compiler to optimize with less code.
 		return Matrix<T, 2, 2, P>{
-			lhs.x * rhs,		// Using Vector2's operators to do the operation on rows at a time
-			lhs.y * rhs
+			lhs[0] * rhs,		// Using Vector2's operators to do the operation on rows at a time
+			lhs[1] * rhs
 		};
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, T rhs)
+	constexpr const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, T rhs)
 	{
 		return lhs = (lhs * rhs);
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(T lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator*(T lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		// I could've constructed an identity matrix, but I feel this is simpler and easier to understand.
 		// It may also make it easier for the compiler to optimize with less code.
@@ -85,8 +86,9 @@ namespace PWMath
 #pragma region Matrix multiplication
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixMultiply);
 		return Matrix<T, 2, 2, P>{
 			Dot(lhs.GetRow(0), rhs.GetColumn(0)), Dot(lhs.GetRow(0), rhs.GetColumn(1)),
 			Dot(lhs.GetRow(1), rhs.GetColumn(0)), Dot(lhs.GetRow(1), rhs.GetColumn(1))
@@ -94,9 +96,9 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
-		return *this = *this * rhs;
+		return lhs = (lhs * rhs);
 	}
 
 #pragma endregion
@@ -104,8 +106,9 @@ namespace PWMath
 #pragma region Matrix-vector multiplication
 
 	template<typename T, PackingMode P>
-	Vector<T, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Vector<T, 2, P>& rhs)
+	constexpr Vector<T, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Vector<T, 2, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixVectorMultiply);
 		return Vector<T, 2, P>{
 			Dot(lhs[0], rhs),
 			Dot(lhs[1], rhs)
@@ -113,13 +116,14 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	Vector<T, 2, P> operator*(const Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr Vector<T, 2, P> operator*(const Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixVectorMultiply);
 		return (lhs[0] * rhs[0]) + (lhs[1] * rhs[1]);
 	}
 
 	template<typename T, PackingMode P>
-	const Vector<T, 2, P>& operator*=(Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
+	constexpr const Vector<T, 2, P>& operator*=(Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs)
 	{
 		return lhs = (lhs * rhs);
 	}
@@ -130,7 +134,7 @@ namespace PWMath
 #pragma region Functions
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P>::TransposeType Transpose(const Matrix<T, 2, 2, P>& matrix)
+	constexpr Matrix<T, 2, 2, P>::TransposeType Transpose(const Matrix<T, 2, 2, P>& matrix)
 	{
 		return typename Matrix<T, 2, 2, P>::TransposeType{
 			matrix[0][0], matrix[1][0],
@@ -139,9 +143,13 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	T Determinant(const Matrix<T, 2, 2, P>& matrix)
+	constexpr T Determinant(const Matrix<T, 2, 2, P>& matrix)
 	{
-		return (matrix[0][0] * matrix[1][1]) - (matrix[0][1] * matrix[1][0]);
+		const T determinant = (matrix[0][0] * matrix[1][1]) - (matrix[0][1] * matrix[1][0]);
+
+		PWM_STATS_COUNT(Determinant);
+		PWM_STATS_COUNT_IF(determinant == static_cast<T>(0), SingularDeterminant);
+		return determinant;
 	}
 
 #pragma endregion
@@ -149,10 +157,10 @@ namespace PWMath
 #pragma region Member version of functions
 
 	template<typename T, PackingMode P>
-	inline Matrix<T, 2, 2, P>::TransposeType Matrix<T, 2, 2, P>::Transpose() const { return PWMath::Transpose(*this); }
+	constexpr Matrix<T, 2, 2, P>::TransposeType Matrix<T, 2, 2, P>::Transpose() const { return PWMath::Transpose(*this); }
 
 	template<typename T, PackingMode P>
-	inline T Matrix<T, 2, 2, P>::Determinant() const { return PWMath::Determinant(*this); }
+	constexpr T Matrix<T, 2, 2, P>::Determinant() const { return PWMath::Determinant(*this); }
 
 #pragma endregion
 
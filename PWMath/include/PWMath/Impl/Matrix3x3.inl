@@ -1,20 +1,35 @@
 #pragma once
 #include <PWMath/Matrix3x3.h>
+#include <PWMath/Stats.h>
 
 namespace PWMath
 {
+	namespace Detail
+	{
+		// Top row of the cofactor matrix, the 2x2 determinants of the bottom two rows (signed), shared by Determinant and Cofactor
+		template<typename T, PackingMode P>
+		constexpr Vector<T, 3, P> TopCofactors(const Matrix<T, 3, 3, P>& matrix)
+		{
+			return Vector<T, 3, P>{
+				(matrix[1][1] * matrix[2][2]) - (matrix[1][2] * matrix[2][1]),
+				(matrix[1][2] * matrix[2][0]) - (matrix[1][0] * matrix[2][2]),
+				(matrix[1][0] * matrix[2][1]) - (matrix[1][1] * matrix[2][0])
+			};
+		}
+	}
+
 #pragma region Unary operators
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& rhs)
 	{
 		return rhs;
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& rhs)
 	{
-		return rhs * -1;
+		return rhs * static_cast<T>(-1);
 	}
 
 #pragma endregion
@@ -22,33 +37,33 @@ namespace PWMath
 #pragma region Addition and substraction
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		return Matrix<T, 3, 3, P>{
-			lhs.x + rhs.x,		// Using Vector3's operators to do the operation on rows at a time
-			lhs.y + rhs.y,
-			lhs.z + rhs.z
+			lhs[0] + rhs[0],		// Using Vector3's operators to do the operation on rows at a time
+			lhs[1] + rhs[1],
+			lhs[2] + rhs[2]
 		};
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		return Matrix<T, 3, 3, P>{
-			lhs.x - rhs.x,		// Using Vector3's operators to do the operation on rows at a time
-			lhs.y - rhs.y,
-			lhs.z - rhs.z
+			lhs[0] - rhs[0],		// Using Vector3's operators to do the operation on rows at a time
+			lhs[1] - rhs[1],
+			lhs[2] - rhs[2]
 		};
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator+=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr const Matrix<T, 3, 3, P>& operator+=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		return lhs = (lhs + rhs);
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator-=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr const Matrix<T, 3, 3, P>& operator-=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		return lhs = (lhs - rhs);
 	}
@@ -58,25 +73,25 @@ namespace PWMath
 #pragma region Matrix-scalar multiplication
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, T rhs)
+	constexpr Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, T rhs)
 	{
 		// I could've constructed an identity matrix, but I feel this is simpler and easier to understand.
 		// It may also make it easier for the compiler to optimize with less code.
 		return Matrix<T, 3, 3, P>{
-			lhs.x * rhs,		// Using Vector3's operators to do the operation on rows at a time
-			lhs.y * rhs,
-			lhs.z * rhs
+			lhs[0] * rhs,		// Using Vector3's operators to do the operation on rows at a time
+			lhs[1] * rhs,
+			lhs[2] * rhs
 		};
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, T rhs)
+	constexpr const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, T rhs)
 	{
 		return lhs = (lhs * rhs);
 	}
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(T lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator*(T lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		// I could've constructed an identity matrix, but I feel this is simpler and easier to understand.
 		// It may also make it easier for the compiler to optimize with less code.
@@ -88,8 +103,9 @@ namespace PWMath
 #pragma region Matrix multiplication
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixMultiply);
 		return Matrix<T, 3, 3, P>{
 			Dot(lhs.GetRow(0), rhs.GetColumn(0)), Dot(lhs.GetRow(0), rhs.GetColumn(1)), Dot(lhs.GetRow(0), rhs.GetColumn(2)),
 			Dot(lhs.GetRow(1), rhs.GetColumn(0)), Dot(lhs.GetRow(1), rhs.GetColumn(1)), Dot(lhs.GetRow(1), rhs.GetColumn(2)),
@@ -98,9 +114,9 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
-		return *this = *this * rhs;
+		return lhs = (lhs * rhs);
 	}
 
 #pragma endregion
@@ -108,8 +124,9 @@ namespace PWMath
 #pragma region Matrix-vector multiplication
 
 	template<typename T, PackingMode P>
-	Vector<T, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Vector<T, 3, P>& rhs)
+	constexpr Vector<T, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Vector<T, 3, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixVectorMultiply);
 		return Vector<T, 3, P>{
 			Dot(lhs[0], rhs),
 			Dot(lhs[1], rhs),
@@ -118,13 +135,14 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	Vector<T, 3, P> operator*(const Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr Vector<T, 3, P> operator*(const Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
+		PWM_STATS_COUNT(MatrixVectorMultiply);
 		return (lhs[0] * rhs[0]) + (lhs[1] * rhs[1]) + (lhs[2] * rhs[2]);
 	}
 
 	template<typename T, PackingMode P>
-	const Vector<T, 3, P>& operator*=(Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
+	constexpr const Vector<T, 3, P>& operator*=(Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs)
 	{
 		return lhs = (lhs * rhs);
 	}
@@ -135,7 +153,7 @@ namespace PWMath
 #pragma region Functions
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P>::TransposeType Transpose(const Matrix<T, 3, 3, P>& matrix)
+	constexpr Matrix<T, 3, 3, P>::TransposeType Transpose(const Matrix<T, 3, 3, P>& matrix)
 	{
 		return typename Matrix<T, 3, 3, P>::TransposeType{
 			matrix[0][0], matrix[1][0], matrix[2][0],
@@ -145,14 +163,46 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	T Determinant(const Matrix<T, 3, 3, P>& matrix)
+	constexpr T Determinant(const Matrix<T, 3, 3, P>& matrix)
 	{
-		// 2x2 determinants, numbers are the indexs of the columns
-		const T determinant01 = (matrix[1][0] * matrix[2][1]) - (matrix[1][1] * matrix[2][0]);
-		const T determinant02 = (matrix[1][0] * matrix[2][2]) - (matrix[1][2] * matrix[2][0]);
-		const T determinant12 = (matrix[1][1] * matrix[2][2]) - (matrix[1][2] * matrix[2][1]);
+		// Expanded along the top row
+		const T determinant = Dot(matrix[0], Detail::TopCofactors(matrix));
+
+		PWM_STATS_COUNT(Determinant);
+		PWM_STATS_COUNT_IF(determinant == static_cast<T>(0), SingularDeterminant);
+		return determinant;
+	}
 
-		return (matrix[0][0] * determinant12) - (matrix[0][1] * determinant02) + (matrix[0][2] * determinant01);
+	template<typename T, PackingMode P>
+	constexpr Matrix<T, 3, 3, P> Cofactor(const Matrix<T, 3, 3, P>& matrix)
+	{
+		// The other rows are found the same way as the top one, rotating which rows the 2x2 determinants come from
+		return Matrix<T, 3, 3, P>{
+			Detail::TopCofactors(matrix),
+			Vector<T, 3, P>{
+				(matrix[2][1] * matrix[0][2]) - (matrix[2][2] * matrix[0][1]),
+				(matrix[2][2] * matrix[0][0]) - (matrix[2][0] * matrix[0][2]),
+				(matrix[2][0] * matrix[0][1]) - (matrix[2][1] * matrix[0][0])
+			},
+			Vector<T, 3, P>{
+				(matrix[0][1] * matrix[1][2]) - (matrix[0][2] * matrix[1][1]),
+				(matrix[0][2] * matrix[1][0]) - (matrix[0][0] * matrix[1][2]),
+				(matrix[0][0] * matrix[1][1]) - (matrix[0][1] * matrix[1][0])
+			}
+		};
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Matrix<T, 3, 3, P> Inverse(const Matrix<T, 3, 3, P>& matrix)
+	{
+		// Inverse is the adjugate (transposed cofactors) over the determinant,
+		// the determinant is the dot product of the top row and the top row of cofactors
+		const Matrix<T, 3, 3, P> cofactor = Cofactor(matrix);
+		const T determinant = Dot(matrix[0], cofactor[0]);
+
+		PWM_STATS_COUNT(Inverse);
+		PWM_STATS_COUNT_IF(determinant == static_cast<T>(0), SingularInverse);
+		return Transpose(cofactor) * (static_cast<T>(1) / determinant);
 	}
 
 #pragma endregion
@@ -160,10 +210,16 @@ namespace PWMath
 #pragma region Member version of functions
 
 	template<typename T, PackingMode P>
-	inline Matrix<T, 3, 3, P>::TransposeType Matrix<T, 3, 3, P>::Transpose() const { return PWMath::Transpose(*this); }
+	constexpr Matrix<T, 3, 3, P>::TransposeType Matrix<T, 3, 3, P>::Transpose() const { return PWMath::Transpose(*this); }
+
+	template<typename T, PackingMode P>
+	constexpr T Matrix<T, 3, 3, P>::Determinant() const { return PWMath::Determinant(*this); }
+
+	template<typename T, PackingMode P>
+	constexpr Matrix<T, 3, 3, P> Matrix<T, 3, 3, P>::Cofactor() const { return PWMath::Cofactor(*this); }
 
 	template<typename T, PackingMode P>
-	inline T Matrix<T, 3, 3, P>::Determinant() const { return PWMath::Determinant(*this); }
+	constexpr Matrix<T, 3, 3, P> Matrix<T, 3, 3, P>::Inverse() const { return PWMath::Inverse(*this); }
 
 #pragma endregion
 
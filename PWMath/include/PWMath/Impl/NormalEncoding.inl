@@ -0,0 +1,282 @@
+#pragma once
+#include <PWMath/NormalEncoding.h>
+#include <PWMath/Scalar.h>
+#include <PWMath/Simd.h>
+
+#include <limits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Min and max like the minps and maxps instructions (rhs for NaNs), so the scalar code matches Simd::Lanes
+		constexpr float LaneMin(float lhs, float rhs) { return lhs < rhs ? lhs : rhs; }
+		constexpr float LaneMax(float lhs, float rhs) { return lhs > rhs ? lhs : rhs; }
+
+		// Nearest integer (ties to even) for |value| < 2^22, adding 1.5 * 2^23 leaves no fraction bits so the addition does the rounding
+		constexpr float RoundNearest(float value) { return (value + 12582912.0f) - 12582912.0f; }
+
+		template<typename I>
+		inline constexpr float snormMax = static_cast<float>(std::numeric_limits<I>::max());
+
+		// Clamped after scaling, which also keeps the compiler from fusing the multiply with the rounding addition
+		constexpr float EncodeSnorm(float value, float max) { return RoundNearest(LaneMin(LaneMax(value * max, -max), max)); }
+		constexpr float DecodeSnorm(float encoded, float max) { return LaneMax(encoded / max, -1.0f); }
+
+		// Octahedral coordinates of a direction, both in [-1, 1]
+		constexpr void EncodeOctahedral(float x, float y, float z, float& u, float& v)
+		{
+			const float length = Abs(x) + Abs(y) + Abs(z);
+			u = length > 0.0f ? x / length : 0.0f;
+			v = length > 0.0f ? y / length : 0.0f;
+			if (z < 0.0f)
+			{
+				const float foldedU = 1.0f - Abs(v), foldedV = 1.0f - Abs(u);
+				u = u >= 0.0f ? foldedU : -foldedU;
+				v = v >= 0.0f ? foldedV : -foldedV;
+			}
+		}
+
+		// Normalized direction of octahedral coordinates
+		// Notes:
+		//  - Moving u and v toward 0 by the depth below the octahedron's equator undoes the fold of the lower half
+		template<PackingMode P>
+		constexpr Vector3<float, P> DecodeOctahedral(float u, float v)
+		{
+			const float z = 1.0f - Abs(u) - Abs(v);
+			const float fold = LaneMax(-z, 0.0f);
+			const float x = u >= 0.0f ? u - fold : u + fold, y = v >= 0.0f ? v - fold : v + fold;
+			// The squares go through LaneMax (they're never below 0) so the compiler can't fuse them into the sum, the batch version does the same
+			const float length = Sqrt(LaneMax(x * x, 0.0f) + LaneMax(y * y, 0.0f) + LaneMax(z * z, 0.0f));
+			return Vector3<float, P>{ x / length, y / length, z / length };
+		}
+
+		constexpr uint32_t PackSnorm(float encoded, uint32_t shift, uint32_t mask)
+		{
+			return (static_cast<uint32_t>(static_cast<int32_t>(encoded)) & mask) << shift;
+		}
+
+		// The field of bits at shift, sign extended
+		constexpr float UnpackSnorm(uint32_t bits, uint32_t shift, uint32_t width)
+		{
+			return static_cast<float>(static_cast<int32_t>(bits << (32 - shift - width)) >> (32 - width));
+		}
+
+		constexpr PackedNormal1010102 Pack1010102(float x, float y, float z, float w)
+		{
+			return PackedNormal1010102{ PackSnorm(x, 0, 0x3FF) | PackSnorm(y, 10, 0x3FF) | PackSnorm(z, 20, 0x3FF) | PackSnorm(w, 30, 0x3) };
+		}
+
+		template<typename I>
+		void EncodeOctahedral(OctahedralNormal<I>* output, const float* normals, size_t count)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			const Lanes zero = 0.0f, one = 1.0f, max = snormMax<I>, minusMax = -snormMax<I>, round = 12582912.0f;
+			for (size_t i = 0; i < count; i += width)
+			{
+				Lanes x, y, z;
+				Lanes::LoadXYZ(normals + i * 3, x, y, z);
+
+				// Same operations as the scalar version, lane by lane
+				const Lanes length = Abs(x) + Abs(y) + Abs(z);
+				const auto nonZero = length > zero;
+				Lanes u = Select(nonZero, x / length, zero), v = Select(nonZero, y / length, zero);
+				const Lanes foldedU = one - Abs(v), foldedV = one - Abs(u);
+				const auto lower = z < zero;
+				u = Select(lower, Select(u >= zero, foldedU, -foldedU), u);
+				v = Select(lower, Select(v >= zero, foldedV, -foldedV), v);
+				u = (Min(Max(u * max, minusMax), max) + round) - round;
+				v = (Min(Max(v * max, minusMax), max) + round) - round;
+
+				float encodedU[width], encodedV[width];
+				u.Store(encodedU);
+				v.Store(encodedV);
+				for (size_t j = 0; j < width; j++)
+					output[i + j] = OctahedralNormal<I>{ static_cast<I>(encodedU[j]), static_cast<I>(encodedV[j]) };
+			}
+		}
+
+		template<typename I>
+		void DecodeOctahedral(float* normals, const OctahedralNormal<I>* input, size_t count)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width, blockSize = 64;
+
+			const Lanes zero = 0.0f, one = 1.0f, minusOne = -1.0f, max = snormMax<I>;
+			for (size_t block = 0; block < count; block += blockSize)
+			{
+				// Converted a block at a time (a loop the compiler vectorizes), the stores are done by the time the lanes load them back
+				const size_t blockCount = count - block < blockSize ? count - block : blockSize;
+				float encodedU[blockSize], encodedV[blockSize];
+				for (size_t j = 0; j < blockCount; j++)
+				{
+					encodedU[j] = static_cast<float>(input[block + j].x);
+					encodedV[j] = static_cast<float>(input[block + j].y);
+				}
+
+				for (size_t j = 0; j < blockCount; j += width)
+				{
+					const Lanes u = Max(Lanes::Load(encodedU + j) / max, minusOne), v = Max(Lanes::Load(encodedV + j) / max, minusOne);
+					const Lanes z = one - Abs(u) - Abs(v);
+					const Lanes fold = Max(-z, zero);
+					const Lanes x = Select(u >= zero, u - fold, u + fold), y = Select(v >= zero, v - fold, v + fold);
+					const Lanes length = Sqrt(Max(x * x, zero) + Max(y * y, zero) + Max(z * z, zero));
+					Lanes::StoreXYZ(normals + (block + j) * 3, x / length, y / length, z / length);
+				}
+			}
+		}
+
+		inline void Encode1010102(PackedNormal1010102* output, const float* normals, size_t count)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			const Lanes max = 511.0f, minusMax = -511.0f, round = 12582912.0f;
+			for (size_t i = 0; i < count; i += width)
+			{
+				Lanes x, y, z;
+				Lanes::LoadXYZ(normals + i * 3, x, y, z);
+
+				float encoded[3][width];
+				((Min(Max(x * max, minusMax), max) + round) - round).Store(encoded[0]);
+				((Min(Max(y * max, minusMax), max) + round) - round).Store(encoded[1]);
+				((Min(Max(z * max, minusMax), max) + round) - round).Store(encoded[2]);
+				for (size_t j = 0; j < width; j++)
+					output[i + j] = Pack1010102(encoded[0][j], encoded[1][j], encoded[2][j], 0.0f);
+			}
+		}
+
+		inline void EncodeSnorm16(int16_t* output, const float* values, size_t count)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			const Lanes max = snormMax<int16_t>, minusMax = -snormMax<int16_t>, round = 12582912.0f;
+			for (size_t i = 0; i < count; i += width)
+			{
+				float encoded[width];
+				((Min(Max(Lanes::Load(values + i) * max, minusMax), max) + round) - round).Store(encoded);
+				for (size_t j = 0; j < width; j++)
+					output[i + j] = static_cast<int16_t>(encoded[j]);
+			}
+		}
+	}
+
+#pragma region Octahedral
+
+	template<typename I>
+	template<typename T, PackingMode P>
+	constexpr OctahedralNormal<I> OctahedralNormal<I>::Encode(const Vector3<T, P>& normal)
+	{
+		float u = 0.0f, v = 0.0f;
+		Detail::EncodeOctahedral(static_cast<float>(normal[0]), static_cast<float>(normal[1]), static_cast<float>(normal[2]), u, v);
+		return OctahedralNormal{ static_cast<I>(Detail::EncodeSnorm(u, Detail::snormMax<I>)), static_cast<I>(Detail::EncodeSnorm(v, Detail::snormMax<I>)) };
+	}
+
+	template<typename I>
+	template<PackingMode P>
+	constexpr Vector3<float, P> OctahedralNormal<I>::Decode() const
+	{
+		return Detail::DecodeOctahedral<P>(Detail::DecodeSnorm(static_cast<float>(x), Detail::snormMax<I>), Detail::DecodeSnorm(static_cast<float>(y), Detail::snormMax<I>));
+	}
+
+#pragma endregion
+
+#pragma region Snorm16
+
+	template<typename T, PackingMode P>
+	constexpr SnormNormal16 SnormNormal16::Encode(const Vector3<T, P>& normal)
+	{
+		constexpr float max = Detail::snormMax<int16_t>;
+		return SnormNormal16{
+			static_cast<int16_t>(Detail::EncodeSnorm(static_cast<float>(normal[0]), max)),
+			static_cast<int16_t>(Detail::EncodeSnorm(static_cast<float>(normal[1]), max)),
+			static_cast<int16_t>(Detail::EncodeSnorm(static_cast<float>(normal[2]), max))
+		};
+	}
+
+	template<PackingMode P>
+	constexpr Vector3<float, P> SnormNormal16::Decode() const
+	{
+		constexpr float max = Detail::snormMax<int16_t>;
+		return Vector3<float, P>{ Detail::DecodeSnorm(static_cast<float>(x), max), Detail::DecodeSnorm(static_cast<float>(y), max), Detail::DecodeSnorm(static_cast<float>(z), max) };
+	}
+
+#pragma endregion
+
+#pragma region 10:10:10:2
+
+	template<typename T, PackingMode P>
+	constexpr PackedNormal1010102 PackedNormal1010102::Encode(const Vector3<T, P>& normal)
+	{
+		return Detail::Pack1010102(Detail::EncodeSnorm(static_cast<float>(normal[0]), 511.0f), Detail::EncodeSnorm(static_cast<float>(normal[1]), 511.0f),
+			Detail::EncodeSnorm(static_cast<float>(normal[2]), 511.0f), 0.0f);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr PackedNormal1010102 PackedNormal1010102::Encode(const Vector4<T, P>& tangent)
+	{
+		return Detail::Pack1010102(Detail::EncodeSnorm(static_cast<float>(tangent[0]), 511.0f), Detail::EncodeSnorm(static_cast<float>(tangent[1]), 511.0f),
+			Detail::EncodeSnorm(static_cast<float>(tangent[2]), 511.0f), Detail::EncodeSnorm(static_cast<float>(tangent[3]), 1.0f));
+	}
+
+	template<PackingMode P>
+	constexpr Vector3<float, P> PackedNormal1010102::Decode() const
+	{
+		return Vector3<float, P>{ Detail::DecodeSnorm(Detail::UnpackSnorm(bits, 0, 10), 511.0f), Detail::DecodeSnorm(Detail::UnpackSnorm(bits, 10, 10), 511.0f),
+			Detail::DecodeSnorm(Detail::UnpackSnorm(bits, 20, 10), 511.0f) };
+	}
+
+	template<PackingMode P>
+	constexpr Vector4<float, P> PackedNormal1010102::DecodeTangent() const
+	{
+		return Vector4<float, P>{ Decode<P>(), Detail::DecodeSnorm(Detail::UnpackSnorm(bits, 30, 2), 1.0f) };
+	}
+
+#pragma endregion
+
+#pragma region Batch
+
+	template<typename TEncoded, PackingMode P>
+	void Encode(TEncoded* output, const Vector3<float, P>* normals, size_t count)
+	{
+		static_assert(sizeof(Vector3<float, P>) == 3 * sizeof(float), "The batch functions read the vectors as one array of components");
+
+		const float* values = reinterpret_cast<const float*>(normals);
+		const size_t blockCount = count - count % Simd::Lanes::width;
+		if constexpr (std::is_same_v<TEncoded, OctahedralNormal<int16_t>> || std::is_same_v<TEncoded, OctahedralNormal<int8_t>>)
+			Detail::EncodeOctahedral(output, values, blockCount);
+		else if constexpr (std::is_same_v<TEncoded, PackedNormal1010102>)
+			Detail::Encode1010102(output, values, blockCount);
+		else if constexpr (std::is_same_v<TEncoded, SnormNormal16>)
+		{
+			// Every component is encoded the same way, so the vectors are one long array of them
+			static_assert(sizeof(SnormNormal16) == 3 * sizeof(int16_t));
+			Detail::EncodeSnorm16(reinterpret_cast<int16_t*>(output), values, blockCount * 3);
+		}
+
+		for (size_t i = blockCount; i < count; i++)
+			output[i] = TEncoded::Encode(normals[i]);
+	}
+
+	template<typename TEncoded, PackingMode P>
+	void Decode(Vector3<float, P>* normals, const TEncoded* input, size_t count)
+	{
+		static_assert(sizeof(Vector3<float, P>) == 3 * sizeof(float), "The batch functions read the vectors as one array of components");
+
+		size_t i = 0;
+		if constexpr (std::is_same_v<TEncoded, OctahedralNormal<int16_t>> || std::is_same_v<TEncoded, OctahedralNormal<int8_t>>)
+		{
+			i = count - count % Simd::Lanes::width;
+			Detail::DecodeOctahedral(reinterpret_cast<float*>(normals), input, i);
+		}
+
+		// The other decodings are a conversion and a multiply per component, straight line code the compiler vectorizes on its own
+		for (; i < count; i++)
+			normals[i] = input[i].template Decode<P>();
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <PWMath/Parallel.h>
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace PWMath
+{
+	inline size_t HardwareThreadCount()
+	{
+		return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	}
+
+	inline size_t ParallelRangeCount(size_t count, size_t minRange)
+	{
+		return std::clamp<size_t>(count / std::max<size_t>(minRange, 1), 1, HardwareThreadCount());
+	}
+
+	template<typename Function>
+	void ParallelFor(size_t count, size_t minRange, Function&& function)
+	{
+		const size_t ranges = ParallelRangeCount(count, minRange);
+		if (ranges == 1)
+		{
+			function(size_t{ 0 }, size_t{ 0 }, count);
+			return;
+		}
+
+		// Spreads the remainder over the first ranges so they differ by at most one element
+		const size_t rangeSize = count / ranges, remainder = count % ranges;
+		auto rangeBegin = [&](size_t range) { return range * rangeSize + std::min(range, remainder); };
+
+		std::vector<std::thread> threads;
+		threads.reserve(ranges - 1);
+		for (size_t range = 0; range + 1 < ranges; ++range)
+			threads.emplace_back([&function, range, begin = rangeBegin(range), end = rangeBegin(range + 1)]() { function(range, begin, end); });
+
+		function(ranges - 1, rangeBegin(ranges - 1), count);
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	template<typename Function, typename Merge>
+	auto ParallelReduce(size_t count, size_t minRange, Function&& function, Merge&& merge)
+	{
+		using Result = std::decay_t<decltype(function(size_t{ 0 }, size_t{ 0 }))>;
+
+		const size_t ranges = ParallelRangeCount(count, minRange);
+		if (ranges == 1)
+			return Result{ function(size_t{ 0 }, count) };
+
+		std::vector<std::optional<Result>> results(ranges);
+		ParallelFor(count, minRange, [&](size_t range, size_t begin, size_t end) { results[range].emplace(function(begin, end)); });
+
+		Result result = std::move(*results[0]);
+		for (size_t range = 1; range < ranges; ++range)
+			result = merge(result, *results[range]);
+		return result;
+	}
+}
@@ -1,59 +1,213 @@
 #pragma once
 #include <PWMath/Projection.h>
+#include <PWMath/Scalar.h>
+#include <PWMath/Simd.h>
+#include <PWMath/Stats.h>
 #include <cmath>
 #include <algorithm>
+#include <type_traits>
 
 namespace PWMath
 {
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Orthographic(float screenSize, float aspectRatio, float near, float far)
 	{
-		float width = screenSize * std::max(aspectRatio, 1.0f), height = screenSize / std::min(aspectRatio, 1.0f);
-
-		return Matrix4x4<T, P>{
-			2 / width,	0,			0,						0,
-			0,			2 / height,	0,						0,
-			0,			0,			1 / (far - near),		0,
-			0,			0,			-near / (far - near),	1
-		};
+		return OrthographicProjection<T>::Create(screenSize, aspectRatio, near, far).template ToMatrix<P>();
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> OrthographicGL(float screenSize, float aspectRatio, float near, float far)
 	{
-		float width = screenSize * std::max(aspectRatio, 1.0f), height = screenSize / std::min(aspectRatio, 1.0f);
-
-		return Matrix4x4<T, P>{
-			2 / width,	0,			0,								0,
-			0,			2 / height,	0,								0,
-			0,			0,			2 / (far - near),				0,
-			0,			0,			-(2 * near) / (far - near) - 1,	1
-		};
+		return OrthographicProjection<T>::CreateGL(screenSize, aspectRatio, near, far).template ToMatrix<P>();
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Perpective(float fov, float aspectRatio, float near, float far)
 	{
-		float tX = std::tan(0.5f * fov * std::max(aspectRatio, 1.0f)), tY = std::tan(0.5f * fov / std::min(aspectRatio, 1.0f));
-
-		return Matrix4x4<T, P>{
-			1 / tX,	0,		0,								0,
-			0,		1 / tY,	0,								0,
-			0,		0,		far / (far-near),				1,
-			0,		0,		-(far * near) / (far - near),	0
-		};
+		return PerspectiveProjection<T>::Create(fov, aspectRatio, near, far).template ToMatrix<P>();
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> PerpectiveGL(float fov, float aspectRatio, float near, float far)
 	{
-		float tX = std::tan(0.5f * fov * std::max(aspectRatio, 1.0f)), tY = std::tan(0.5f * fov / std::min(aspectRatio, 1.0f));
+		return PerspectiveProjection<T>::CreateGL(fov, aspectRatio, near, far).template ToMatrix<P>();
+	}
+
+#pragma region Projection
+
+	namespace Detail
+	{
+		// The projection as two rows, a point projects to point * scale + point.Swizzle<0, 0, 3, 2>() * offset
+		// Notes:
+		//  - The swizzle moves w to the depth component and z to the w component, offset picks z for a perspective projection
+		//  - Built with Set, going through memory would stall on the store of the separate values
+		template<typename T, ProjectionType K>
+		void ProjectionRows(const Projection<T, K>& projection, typename Simd::Row<T>::Type& scale, typename Simd::Row<T>::Type& offset)
+		{
+			constexpr T perspective = static_cast<T>(K == ProjectionType::Perspective ? 1 : 0);
+			scale = Simd::Row<T>::Set(projection.scaleX, projection.scaleY, projection.depthScale, static_cast<T>(1) - perspective);
+			offset = Simd::Row<T>::Set(static_cast<T>(0), static_cast<T>(0), projection.depthOffset, perspective);
+		}
+
+		// Projects the 4 component row at values (a point or a row of a matrix) in place
+		template<typename T>
+		void ProjectRow(T* values, typename Simd::Row<T>::Type scale, typename Simd::Row<T>::Type offset)
+		{
+			using Row = Simd::Row<T>;
+			const auto row = Row::Load(values);
+			Row::Store(values, Row::MulAdd(Row::template Shuffle<0, 0, 3, 2>(row), offset, Row::Mul(row, scale)));
+		}
+	}
+
+	template<typename T, ProjectionType K>
+	constexpr Projection<T, K> Projection<T, K>::Create(float size, float aspectRatio, float near, float far)
+	{
+		if constexpr (K == ProjectionType::Perspective)
+		{
+			float tX = Tan(0.5f * size * std::max(aspectRatio, 1.0f)), tY = Tan(0.5f * size / std::min(aspectRatio, 1.0f));
+			return Projection{ static_cast<T>(1 / tX), static_cast<T>(1 / tY), static_cast<T>(far / (far - near)), static_cast<T>(-(far * near) / (far - near)) };
+		}
+		else
+		{
+			float width = size * std::max(aspectRatio, 1.0f), height = size / std::min(aspectRatio, 1.0f);
+			return Projection{ static_cast<T>(2 / width), static_cast<T>(2 / height), static_cast<T>(1 / (far - near)), static_cast<T>(-near / (far - near)) };
+		}
+	}
+
+	template<typename T, ProjectionType K>
+	constexpr Projection<T, K> Projection<T, K>::CreateGL(float size, float aspectRatio, float near, float far)
+	{
+		if constexpr (K == ProjectionType::Perspective)
+		{
+			float tX = Tan(0.5f * size * std::max(aspectRatio, 1.0f)), tY = Tan(0.5f * size / std::min(aspectRatio, 1.0f));
+			return Projection{ static_cast<T>(1 / tX), static_cast<T>(1 / tY), static_cast<T>((far + near) / (far - near)), static_cast<T>(-(2 * far * near) / (far - near)) };
+		}
+		else
+		{
+			float width = size * std::max(aspectRatio, 1.0f), height = size / std::min(aspectRatio, 1.0f);
+			return Projection{ static_cast<T>(2 / width), static_cast<T>(2 / height), static_cast<T>(2 / (far - near)), static_cast<T>(-(2 * near) / (far - near) - 1) };
+		}
+	}
+
+	template<typename T, ProjectionType K>
+	template<PackingMode P>
+	constexpr Matrix4x4<T, P> Projection<T, K>::ToMatrix() const
+	{
+		const T perspective = static_cast<T>(K == ProjectionType::Perspective ? 1 : 0);
 
 		return Matrix4x4<T, P>{
-			1 / tX,	0,		0,									0,
-			0,		1 / tY,	0,									0,
-			0,		0,		(far + near) / (far-near),			1,
-			0,		0,		-(2 * far * near) / (far - near),	0
+			scaleX,	0,		0,				0,
+			0,		scaleY,	0,				0,
+			0,		0,		depthScale,		perspective,
+			0,		0,		depthOffset,	1 - perspective
 		};
 	}
+
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Vector4<T, P> operator*(const Vector4<T, P>& point, const Projection<T, K>& projection)
+	{
+		PWM_STATS_COUNT(Project);
+		const T z = point[2], w = point[3];
+		return Vector4<T, P>{ point[0] * projection.scaleX, point[1] * projection.scaleY, z * projection.depthScale + w * projection.depthOffset,
+			K == ProjectionType::Perspective ? z : w };
+	}
+
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Vector4<T, P> Project(const Vector3<T, P>& point, const Projection<T, K>& projection)
+	{
+		return Vector4<T, P>{ point, static_cast<T>(1) } * projection;
+	}
+
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Matrix4x4<T, P> operator*(const Matrix4x4<T, P>& view, const Projection<T, K>& projection)
+	{
+		// A single result object for both paths, so it is constructed in place
+		Matrix4x4<T, P> result = view;
+		if constexpr (P == PackingMode::Fast && Simd::Row<T>::enabled)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				typename Simd::Row<T>::Type scale, offset;
+				Detail::ProjectionRows(projection, scale, offset);
+				Detail::ProjectRow(result[0].array, scale, offset);
+				Detail::ProjectRow(result[1].array, scale, offset);
+				Detail::ProjectRow(result[2].array, scale, offset);
+				Detail::ProjectRow(result[3].array, scale, offset);
+				return result;
+			}
+		}
+
+		for (size_t r = 0; r < 4; r++)
+			result[r] = result[r] * projection;
+		return result;
+	}
+
+	template<typename T, ProjectionType K, PackingMode P>
+	void Project(Vector4<T, P>* clipPoints, const Vector3<T, P>* points, const Projection<T, K>& projection, size_t count)
+	{
+		// Straight line code the compiler vectorizes on its own, w being 1 takes the multiply out of the depth
+		PWM_STATS_ADD(Project, count);
+		const T scaleX = projection.scaleX, scaleY = projection.scaleY, depthScale = projection.depthScale, depthOffset = projection.depthOffset;
+		for (size_t i = 0; i < count; i++)
+		{
+			const T x = points[i][0], y = points[i][1], z = points[i][2];
+			clipPoints[i] = Vector4<T, P>{ x * scaleX, y * scaleY, z * depthScale + depthOffset, K == ProjectionType::Perspective ? z : static_cast<T>(1) };
+		}
+	}
+
+	template<typename T, ProjectionType K, PackingMode P>
+	void Project(Vector4<T, P>* clipPoints, const Vector4<T, P>* points, const Projection<T, K>& projection, size_t count)
+	{
+		if constexpr (Simd::Row<T>::enabled)
+		{
+			typename Simd::Row<T>::Type scale, offset;
+			Detail::ProjectionRows(projection, scale, offset);
+			PWM_STATS_ADD(Project, count);
+			for (size_t i = 0; i < count; i++)
+			{
+				clipPoints[i] = points[i];
+				Detail::ProjectRow(clipPoints[i].array, scale, offset);
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < count; i++)
+				clipPoints[i] = points[i] * projection;
+		}
+	}
+
+	template<typename T, ProjectionType K>
+	void Project(std::type_identity_t<Vector4Stream<T>> clipPoints, std::type_identity_t<Vector3Stream<const T>> points, const Projection<T, K>& projection, size_t count)
+	{
+		PWM_STATS_ADD(Project, count);
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+
+			const Lanes scaleX = projection.scaleX, scaleY = projection.scaleY, depthScale = projection.depthScale, depthOffset = projection.depthOffset;
+			const Lanes one = 1.0f;
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes z = Lanes::Load(points.z + i);
+				(Lanes::Load(points.x + i) * scaleX).Store(clipPoints.x + i);
+				(Lanes::Load(points.y + i) * scaleY).Store(clipPoints.y + i);
+				MulAdd(z, depthScale, depthOffset).Store(clipPoints.z + i);
+				(K == ProjectionType::Perspective ? z : one).Store(clipPoints.w + i);
+			}
+		}
+
+		for (; i < count; i++)
+		{
+			const T z = points.z[i];
+			clipPoints.x[i] = points.x[i] * projection.scaleX;
+			clipPoints.y[i] = points.y[i] * projection.scaleY;
+			clipPoints.z[i] = z * projection.depthScale + projection.depthOffset;
+			clipPoints.w[i] = K == ProjectionType::Perspective ? z : static_cast<T>(1);
+		}
+	}
+
+#pragma endregion
 }
@@ -0,0 +1,136 @@
+#pragma once
+#include <PWMath/Ray.h>
+#include <PWMath/Simd.h>
+
+#include <cassert>
+#include <limits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Same NaN handling as Simd::Min and Simd::Max, so the single and packet tests agree when a ray lies on a slab plane
+		template<typename T>
+		constexpr T SlabMin(T lhs, T rhs) { return lhs < rhs ? lhs : rhs; }
+
+		template<typename T>
+		constexpr T SlabMax(T lhs, T rhs) { return lhs > rhs ? lhs : rhs; }
+
+		// Slab test shared by the packet functions, entry is infinity where there is no hit
+		inline Simd::LaneMask IntersectSlabs(const Simd::Lanes origin[3], const Simd::Lanes inverseDirection[3],
+			const Simd::Lanes min[3], const Simd::Lanes max[3], Simd::Lanes maxDistance, Simd::Lanes& entry)
+		{
+			using Simd::Lanes;
+
+			// The distances on each axis go first in Min and Max, so a NaN from 0 * infinity is dropped
+			Lanes tEntry = 0.0f, tExit = maxDistance;
+			for (size_t c = 0; c < 3; ++c)
+			{
+				const Lanes t0 = (min[c] - origin[c]) * inverseDirection[c];
+				const Lanes t1 = (max[c] - origin[c]) * inverseDirection[c];
+				tEntry = Max(Min(t0, t1), tEntry);
+				tExit = Min(Max(t0, t1), tExit);
+			}
+
+			const auto hit = tEntry <= tExit;
+			entry = Select(hit, tEntry, std::numeric_limits<float>::infinity());
+			return hit;
+		}
+	}
+
+#pragma region Single tests
+
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const Ray<T, P>& ray, const AABB<T, P>& box, T maxDistance, T& entry)
+	{
+		T tEntry = static_cast<T>(0), tExit = maxDistance;
+		for (size_t c = 0; c < 3; ++c)
+		{
+			const T t0 = (box.min[c] - ray.origin[c]) * ray.inverseDirection[c];
+			const T t1 = (box.max[c] - ray.origin[c]) * ray.inverseDirection[c];
+			tEntry = Detail::SlabMax(Detail::SlabMin(t0, t1), tEntry);
+			tExit = Detail::SlabMin(Detail::SlabMax(t0, t1), tExit);
+		}
+
+		entry = tEntry;
+		return tEntry <= tExit;
+	}
+
+#pragma endregion
+
+#pragma region Packet tests
+
+	template<PackingMode P>
+	uint32_t IntersectPacket(const Ray<float, P>& ray, Vector3Stream<const float> mins, Vector3Stream<const float> maxs, float maxDistance, float* entries)
+	{
+		using Simd::Lanes;
+
+		const Lanes origin[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+		const Lanes inverseDirection[3] = { ray.inverseDirection.x, ray.inverseDirection.y, ray.inverseDirection.z };
+		const Lanes min[3] = { Lanes::Load(mins.x), Lanes::Load(mins.y), Lanes::Load(mins.z) };
+		const Lanes max[3] = { Lanes::Load(maxs.x), Lanes::Load(maxs.y), Lanes::Load(maxs.z) };
+
+		Lanes entry;
+		const auto hit = Detail::IntersectSlabs(origin, inverseDirection, min, max, maxDistance, entry);
+		entry.Store(entries);
+		return hit.Bits();
+	}
+
+	template<PackingMode P>
+	uint32_t IntersectPacket(RayStream<const float> rays, const AABB<float, P>& box, const float* maxDistances, float* entries)
+	{
+		using Simd::Lanes;
+
+		const Lanes origin[3] = { Lanes::Load(rays.origins.x), Lanes::Load(rays.origins.y), Lanes::Load(rays.origins.z) };
+		const Lanes inverseDirection[3] = {
+			Lanes::Load(rays.inverseDirections.x), Lanes::Load(rays.inverseDirections.y), Lanes::Load(rays.inverseDirections.z)
+		};
+		const Lanes min[3] = { box.min.x, box.min.y, box.min.z };
+		const Lanes max[3] = { box.max.x, box.max.y, box.max.z };
+
+		Lanes entry;
+		const auto hit = Detail::IntersectSlabs(origin, inverseDirection, min, max, Lanes::Load(maxDistances), entry);
+		entry.Store(entries);
+		return hit.Bits();
+	}
+
+#pragma endregion
+
+#pragma region Batch tests
+
+	template<typename T, PackingMode P>
+	size_t Intersect(const Ray<T, P>& ray, std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, size_t count,
+		T maxDistance, uint32_t* hitIndices, T* entries)
+	{
+		assert(count <= UINT32_MAX && "The box indices are written as uint32_t");
+		size_t hits = 0, i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			float packetEntries[rayPacketSize];
+			for (; i + rayPacketSize <= count; i += rayPacketSize)
+			{
+				const uint32_t bits = IntersectPacket(ray,
+					Vector3Stream<const float>{ mins.x + i, mins.y + i, mins.z + i }, Vector3Stream<const float>{ maxs.x + i, maxs.y + i, maxs.z + i },
+					maxDistance, packetEntries);
+
+				const size_t packetHits = Simd::CompressIndices(bits, static_cast<uint32_t>(i), hitIndices + hits);
+				for (size_t h = hits; h < hits + packetHits; ++h)
+					entries[h] = packetEntries[hitIndices[h] - i];
+				hits += packetHits;
+			}
+		}
+
+		// Counted in uint32_t like the indices, so the loop can't run past the 2^32 boxes they can address.
+		// hits only grows when a box is hit, so it stays below the index and inside the count values of room
+		const uint32_t end = static_cast<uint32_t>(count);
+		for (uint32_t index = static_cast<uint32_t>(i); index < end; ++index)
+		{
+			if (Intersects(ray, AABB<T, P>{ mins.template Get<P>(index), maxs.template Get<P>(index) }, maxDistance, entries[hits]))
+				hitIndices[hits++] = index;
+		}
+		return hits;
+	}
+
+#pragma endregion
+}
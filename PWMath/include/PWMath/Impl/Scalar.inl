@@ -0,0 +1,182 @@
+#pragma once
+#include <PWMath/Scalar.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// The compile time versions work in long double and are rounded to the result type once at the end
+
+		constexpr long double ConstexprSqrt(long double value)
+		{
+			if (!(value >= 0.0L))
+				return std::numeric_limits<long double>::quiet_NaN();
+			if (value == 0.0L || value == std::numeric_limits<long double>::infinity())
+				return value;
+
+			// Newton's method converges from above once the guess is past the root,
+			// so the guess starts above it and iterates until it stops shrinking
+			long double guess = value > 1.0L ? value : 1.0L;
+			while (true)
+			{
+				const long double next = 0.5L * (guess + value / guess);
+				if (!(next < guess))
+					return guess;
+				guess = next;
+			}
+		}
+
+		inline constexpr long double constexprPi = 3.141592653589793238462643383279502884L;
+
+		// Sine and cosine of an angle in [-pi/4, pi/4], the Taylor series is within long double precision after 12 terms there
+		constexpr long double ConstexprSinReduced(long double angle)
+		{
+			const long double angle2 = angle * angle;
+			long double term = angle, sum = angle;
+			for (int i = 1; i < 12; ++i)
+			{
+				term *= -angle2 / static_cast<long double>((2 * i) * (2 * i + 1));
+				sum += term;
+			}
+			return sum;
+		}
+
+		constexpr long double ConstexprCosReduced(long double angle)
+		{
+			const long double angle2 = angle * angle;
+			long double term = 1.0L, sum = 1.0L;
+			for (int i = 1; i < 12; ++i)
+			{
+				term *= -angle2 / static_cast<long double>((2 * i - 1) * (2 * i));
+				sum += term;
+			}
+			return sum;
+		}
+
+		// Reduces the angle to a quarter turn and the number of quarter turns (mod 4) that were taken off
+		constexpr long double ReduceAngle(long double angle, int& quadrant)
+		{
+			const long double turns = angle / (constexprPi / 2.0L);
+			const long double nearest = turns < 0.0L ? static_cast<long double>(static_cast<long long>(turns - 0.5L)) : static_cast<long double>(static_cast<long long>(turns + 0.5L));
+			quadrant = static_cast<int>(static_cast<long long>(nearest) & 3);
+			return angle - nearest * (constexprPi / 2.0L);
+		}
+
+		constexpr long double ConstexprSin(long double angle)
+		{
+			if (angle != angle || angle == std::numeric_limits<long double>::infinity() || angle == -std::numeric_limits<long double>::infinity())
+				return std::numeric_limits<long double>::quiet_NaN();
+
+			int quadrant = 0;
+			const long double reduced = ReduceAngle(angle, quadrant);
+			switch (quadrant)
+			{
+			case 0: return ConstexprSinReduced(reduced);
+			case 1: return ConstexprCosReduced(reduced);
+			case 2: return -ConstexprSinReduced(reduced);
+			default: return -ConstexprCosReduced(reduced);
+			}
+		}
+
+		constexpr long double ConstexprCos(long double angle)
+		{
+			if (angle != angle || angle == std::numeric_limits<long double>::infinity() || angle == -std::numeric_limits<long double>::infinity())
+				return std::numeric_limits<long double>::quiet_NaN();
+
+			int quadrant = 0;
+			const long double reduced = ReduceAngle(angle, quadrant);
+			switch (quadrant)
+			{
+			case 0: return ConstexprCosReduced(reduced);
+			case 1: return -ConstexprSinReduced(reduced);
+			case 2: return -ConstexprCosReduced(reduced);
+			default: return ConstexprSinReduced(reduced);
+			}
+		}
+	}
+
+	template<typename T>
+	constexpr T Sqrt(T value)
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<T>(Detail::ConstexprSqrt(static_cast<long double>(value)));
+		return static_cast<T>(std::sqrt(value));
+	}
+
+	template<typename T>
+	constexpr T Sin(T angle)
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<T>(Detail::ConstexprSin(static_cast<long double>(angle)));
+		return static_cast<T>(std::sin(angle));
+	}
+
+	template<typename T>
+	constexpr T Cos(T angle)
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<T>(Detail::ConstexprCos(static_cast<long double>(angle)));
+		return static_cast<T>(std::cos(angle));
+	}
+
+	template<typename T>
+	constexpr void SinCos(T angle, T& sine, T& cosine)
+	{
+		sine = Sin(angle);
+		cosine = Cos(angle);
+	}
+
+	template<typename T>
+	void SinCos(T* sines, T* cosines, const T* angles, size_t count)
+	{
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+			constexpr size_t width = Lanes::width;
+
+			for (; i + width <= count; i += width)
+			{
+				Lanes sine, cosine;
+				Simd::SinCos(Lanes::Load(angles + i), sine, cosine);
+				sine.Store(sines + i);
+				cosine.Store(cosines + i);
+			}
+
+			// The rest goes through the same polynomials so every result has the same accuracy
+			if (i < count)
+			{
+				float tailSines[width], tailCosines[width];
+				Lanes sine, cosine;
+				Simd::SinCos(Lanes::LoadPartial(angles + i, count - i), sine, cosine);
+				sine.Store(tailSines);
+				cosine.Store(tailCosines);
+				std::copy_n(tailSines, count - i, sines + i);
+				std::copy_n(tailCosines, count - i, cosines + i);
+				i = count;
+			}
+		}
+
+		for (; i < count; ++i)
+			SinCos(angles[i], sines[i], cosines[i]);
+	}
+
+	template<typename T>
+	constexpr T Tan(T angle)
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<T>(Detail::ConstexprSin(static_cast<long double>(angle)) / Detail::ConstexprCos(static_cast<long double>(angle)));
+		return static_cast<T>(std::tan(angle));
+	}
+
+	template<typename T>
+	constexpr T Abs(T value)
+	{
+		return value < static_cast<T>(0) ? -value : value;
+	}
+}
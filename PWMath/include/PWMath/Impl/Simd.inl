@@ -0,0 +1,502 @@
+#pragma once
+#include <PWMath/Simd.h>
+
+namespace PWMath::Simd
+{
+#if PWM_USE_AVX512
+
+#pragma region AVX-512 lanes
+
+	inline Lanes::Type Lanes::Broadcast(float value) { return _mm512_set1_ps(value); }
+
+	inline Lanes Lanes::Load(const float* values) { return _mm512_loadu_ps(values); }
+	inline Lanes Lanes::Load(const uint8_t* values) { return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)))); }
+	inline Lanes Lanes::Load(const uint16_t* values) { return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)))); }
+	inline Lanes Lanes::Load(const float* values, size_t stride)
+	{
+		const __m512i indices = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(static_cast<int>(stride)));
+		return _mm512_i32gather_ps(indices, values, sizeof(float));
+	}
+	inline Lanes Lanes::LoadPartial(const float* values, size_t count) { return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1u << count) - 1), values); }
+	inline void Lanes::LoadXYZ(const float* values, Lanes& x, Lanes& y, Lanes& z)
+	{
+		// Each component takes its values out of the first two registers, then the third
+		const __m512 a = _mm512_loadu_ps(values), b = _mm512_loadu_ps(values + 16), c = _mm512_loadu_ps(values + 32);
+		x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0), b),
+			_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29), c);
+		y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0), b),
+			_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30), c);
+		z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0), b),
+			_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31), c);
+	}
+	inline void Lanes::StoreXYZ(float* values, Lanes x, Lanes y, Lanes z)
+	{
+		// Each block of 16 values takes its x and y values first, then its z values
+		const __m512 a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x.value, _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5), y.value),
+			_mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15), z.value);
+		const __m512 b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x.value, _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26), y.value),
+			_mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15), z.value);
+		const __m512 c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x.value, _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0), y.value),
+			_mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31), z.value);
+		_mm512_storeu_ps(values, a);
+		_mm512_storeu_ps(values + 16, b);
+		_mm512_storeu_ps(values + 32, c);
+	}
+	inline void Lanes::LoadXYZW(const float* values, Lanes& x, Lanes& y, Lanes& z, Lanes& w)
+	{
+		// A 4x4 transpose in each 128-bit block leaves component c of quadruple 4 * j + i in block i, element j of register c, the permutes put them in order
+		const __m512 a = _mm512_loadu_ps(values), b = _mm512_loadu_ps(values + 16), c = _mm512_loadu_ps(values + 32), d = _mm512_loadu_ps(values + 48);
+		const __m512 ab01 = _mm512_unpacklo_ps(a, b), ab23 = _mm512_unpackhi_ps(a, b), cd01 = _mm512_unpacklo_ps(c, d), cd23 = _mm512_unpackhi_ps(c, d);
+		const __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+		x = _mm512_permutexvar_ps(order, _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(ab01), _mm512_castps_pd(cd01))));
+		y = _mm512_permutexvar_ps(order, _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(ab01), _mm512_castps_pd(cd01))));
+		z = _mm512_permutexvar_ps(order, _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(ab23), _mm512_castps_pd(cd23))));
+		w = _mm512_permutexvar_ps(order, _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(ab23), _mm512_castps_pd(cd23))));
+	}
+	inline void Lanes::StoreXYZW(float* values, Lanes x, Lanes y, Lanes z, Lanes w)
+	{
+		// The inverse of LoadXYZW, the permutes put component c of quadruple 4 * j + i in block i, element j of register c, then a 4x4 transpose per block
+		const __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+		const __m512 px = _mm512_permutexvar_ps(order, x.value), py = _mm512_permutexvar_ps(order, y.value);
+		const __m512 pz = _mm512_permutexvar_ps(order, z.value), pw = _mm512_permutexvar_ps(order, w.value);
+		const __m512 xy01 = _mm512_unpacklo_ps(px, py), xy23 = _mm512_unpackhi_ps(px, py), zw01 = _mm512_unpacklo_ps(pz, pw), zw23 = _mm512_unpackhi_ps(pz, pw);
+		_mm512_storeu_ps(values, _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(xy01), _mm512_castps_pd(zw01))));
+		_mm512_storeu_ps(values + 16, _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(xy01), _mm512_castps_pd(zw01))));
+		_mm512_storeu_ps(values + 32, _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(xy23), _mm512_castps_pd(zw23))));
+		_mm512_storeu_ps(values + 48, _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(xy23), _mm512_castps_pd(zw23))));
+	}
+	inline void Lanes::Store(float* values) const { _mm512_storeu_ps(values, value); }
+	inline void Lanes::Store(uint8_t* values) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm512_cvtepi32_epi8(_mm512_cvttps_epi32(value))); }
+	inline void Lanes::Store(uint16_t* values) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), _mm512_cvtepi32_epi16(_mm512_cvttps_epi32(value))); }
+	inline void Lanes::Store(float* values, size_t stride) const
+	{
+		const __m512i indices = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(static_cast<int>(stride)));
+		_mm512_i32scatter_ps(values, indices, value, sizeof(float));
+	}
+
+	inline uint32_t LaneMask::Bits() const { return static_cast<uint32_t>(value); }
+
+	inline Lanes operator+(Lanes lhs, Lanes rhs) { return _mm512_add_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes lhs, Lanes rhs) { return _mm512_sub_ps(lhs.value, rhs.value); }
+	inline Lanes operator*(Lanes lhs, Lanes rhs) { return _mm512_mul_ps(lhs.value, rhs.value); }
+	inline Lanes operator/(Lanes lhs, Lanes rhs) { return _mm512_div_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes value) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(value.value), _mm512_set1_epi32(INT32_MIN))); }
+
+	inline LaneMask operator<(Lanes lhs, Lanes rhs) { return LaneMask{ _mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_LT_OQ) }; }
+	inline LaneMask operator<=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_LE_OQ) }; }
+	inline LaneMask operator>(Lanes lhs, Lanes rhs) { return LaneMask{ _mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_GT_OQ) }; }
+	inline LaneMask operator>=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_GE_OQ) }; }
+	inline LaneMask operator&(LaneMask lhs, LaneMask rhs) { return LaneMask{ static_cast<__mmask16>(lhs.value & rhs.value) }; }
+	inline LaneMask operator|(LaneMask lhs, LaneMask rhs) { return LaneMask{ static_cast<__mmask16>(lhs.value | rhs.value) }; }
+
+	inline Lanes MulAdd(Lanes a, Lanes b, Lanes c) { return _mm512_fmadd_ps(a.value, b.value, c.value); }
+	inline Lanes DifferenceOfProducts(Lanes a, Lanes b, Lanes c, Lanes d)
+	{
+		const auto half = [&](int index)
+		{
+			const auto widen = [&](Lanes value) { return _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value.value), index))); };
+			return _mm512_cvtpd_ps(_mm512_sub_pd(_mm512_mul_pd(widen(a), widen(b)), _mm512_mul_pd(widen(c), widen(d))));
+		};
+		return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(half(0))), _mm256_castps_pd(half(1)), 1));
+	}
+	inline Lanes Min(Lanes lhs, Lanes rhs) { return _mm512_min_ps(lhs.value, rhs.value); }
+	inline Lanes Max(Lanes lhs, Lanes rhs) { return _mm512_max_ps(lhs.value, rhs.value); }
+	inline Lanes Abs(Lanes value) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(value.value), _mm512_set1_epi32(INT32_MAX))); }
+	inline Lanes Sqrt(Lanes value) { return _mm512_sqrt_ps(value.value); }
+	inline Lanes Reciprocal(Lanes value)
+	{
+		const Lanes estimate = _mm512_rcp14_ps(value.value);
+		return estimate * (Lanes{ 2.0f } - value * estimate);
+	}
+	inline Lanes Select(LaneMask mask, Lanes ifTrue, Lanes ifFalse) { return _mm512_mask_blend_ps(mask.value, ifFalse.value, ifTrue.value); }
+
+#pragma endregion
+
+#elif PWM_USE_AVX
+
+#pragma region AVX lanes
+
+	inline Lanes::Type Lanes::Broadcast(float value) { return _mm256_set1_ps(value); }
+
+	inline Lanes Lanes::Load(const float* values) { return _mm256_loadu_ps(values); }
+	inline Lanes Lanes::Load(const uint8_t* values)
+	{
+		// Without AVX2 the two halves are widened separately (SSE4.1)
+		const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+		return _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_cvtepu8_epi32(bytes)), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4)), 1));
+	}
+	inline Lanes Lanes::Load(const uint16_t* values)
+	{
+		const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+		return _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_cvtepu16_epi32(words)), _mm_cvtepu16_epi32(_mm_srli_si128(words, 8)), 1));
+	}
+	inline Lanes Lanes::Load(const float* values, size_t stride)
+	{
+#if PWM_USE_AVX2
+		const __m256i indices = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+		return _mm256_i32gather_ps(values, indices, sizeof(float));
+#else
+		return _mm256_setr_ps(values[0], values[stride], values[2 * stride], values[3 * stride],
+			values[4 * stride], values[5 * stride], values[6 * stride], values[7 * stride]);
+#endif // PWM_USE_AVX2
+	}
+	inline Lanes Lanes::LoadPartial(const float* values, size_t count)
+	{
+		// Integer compares need AVX2, the lane indices are small enough to compare as floats
+		const __m256 mask = _mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_ps(static_cast<float>(count)), _CMP_LT_OQ);
+		return _mm256_maskload_ps(values, _mm256_castps_si256(mask));
+	}
+	inline void Lanes::LoadXYZ(const float* values, Lanes& x, Lanes& y, Lanes& z)
+	{
+		// Triples 0-3 go in the low halves and 4-7 in the high halves, so the SSE shuffles work on both halves at once
+		const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values)), _mm_loadu_ps(values + 12), 1);
+		const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 4)), _mm_loadu_ps(values + 16), 1);
+		const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 8)), _mm_loadu_ps(values + 20), 1);
+		x = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 3, 0)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+		y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+	inline void Lanes::StoreXYZ(float* values, Lanes x, Lanes y, Lanes z)
+	{
+		// The SSE shuffles on both halves at once, the low halves hold triples 0-3 and the high halves 4-7
+		const __m256 xy01 = _mm256_unpacklo_ps(x.value, y.value), xy23 = _mm256_unpackhi_ps(x.value, y.value);
+		const __m256 a = _mm256_shuffle_ps(xy01, _mm256_shuffle_ps(z.value, x.value, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(y.value, z.value, _MM_SHUFFLE(1, 1, 1, 1)), xy23, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(z.value, xy23, _MM_SHUFFLE(3, 2, 2, 2)), _mm256_shuffle_ps(xy23, z.value, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(values, _mm256_castps256_ps128(a));
+		_mm_storeu_ps(values + 4, _mm256_castps256_ps128(b));
+		_mm_storeu_ps(values + 8, _mm256_castps256_ps128(c));
+		_mm_storeu_ps(values + 12, _mm256_extractf128_ps(a, 1));
+		_mm_storeu_ps(values + 16, _mm256_extractf128_ps(b, 1));
+		_mm_storeu_ps(values + 20, _mm256_extractf128_ps(c, 1));
+	}
+	inline void Lanes::LoadXYZW(const float* values, Lanes& x, Lanes& y, Lanes& z, Lanes& w)
+	{
+		// Quadruples 0-3 go in the low halves and 4-7 in the high halves, then a 4x4 transpose on both halves at once
+		const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values)), _mm_loadu_ps(values + 16), 1);
+		const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 4)), _mm_loadu_ps(values + 20), 1);
+		const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 8)), _mm_loadu_ps(values + 24), 1);
+		const __m256 d = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values + 12)), _mm_loadu_ps(values + 28), 1);
+		const __m256 ab01 = _mm256_unpacklo_ps(a, b), ab23 = _mm256_unpackhi_ps(a, b), cd01 = _mm256_unpacklo_ps(c, d), cd23 = _mm256_unpackhi_ps(c, d);
+		x = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(1, 0, 1, 0));
+		y = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(3, 2, 3, 2));
+		z = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(1, 0, 1, 0));
+		w = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+	inline void Lanes::StoreXYZW(float* values, Lanes x, Lanes y, Lanes z, Lanes w)
+	{
+		// A 4x4 transpose on both halves at once, the low halves hold quadruples 0-3 and the high halves 4-7
+		const __m256 xy01 = _mm256_unpacklo_ps(x.value, y.value), xy23 = _mm256_unpackhi_ps(x.value, y.value);
+		const __m256 zw01 = _mm256_unpacklo_ps(z.value, w.value), zw23 = _mm256_unpackhi_ps(z.value, w.value);
+		const __m256 a = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0)), b = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+		const __m256 c = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0)), d = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+		_mm256_storeu_ps(values, _mm256_permute2f128_ps(a, b, 0x20));
+		_mm256_storeu_ps(values + 8, _mm256_permute2f128_ps(c, d, 0x20));
+		_mm256_storeu_ps(values + 16, _mm256_permute2f128_ps(a, b, 0x31));
+		_mm256_storeu_ps(values + 24, _mm256_permute2f128_ps(c, d, 0x31));
+	}
+	inline void Lanes::Store(float* values) const { _mm256_storeu_ps(values, value); }
+	inline void Lanes::Store(uint8_t* values) const
+	{
+		const __m256i integers = _mm256_cvttps_epi32(value);
+		const __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(integers), _mm256_extractf128_si256(integers, 1));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_packus_epi16(words, words));
+	}
+	inline void Lanes::Store(uint16_t* values) const
+	{
+		const __m256i integers = _mm256_cvttps_epi32(value);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_packus_epi32(_mm256_castsi256_si128(integers), _mm256_extractf128_si256(integers, 1)));
+	}
+	inline void Lanes::Store(float* values, size_t stride) const
+	{
+		alignas(32) float lanes[8];
+		_mm256_store_ps(lanes, value);
+		for (size_t i = 0; i < 8; ++i)
+			values[i * stride] = lanes[i];
+	}
+
+	inline uint32_t LaneMask::Bits() const { return static_cast<uint32_t>(_mm256_movemask_ps(value)); }
+
+	inline Lanes operator+(Lanes lhs, Lanes rhs) { return _mm256_add_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes lhs, Lanes rhs) { return _mm256_sub_ps(lhs.value, rhs.value); }
+	inline Lanes operator*(Lanes lhs, Lanes rhs) { return _mm256_mul_ps(lhs.value, rhs.value); }
+	inline Lanes operator/(Lanes lhs, Lanes rhs) { return _mm256_div_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes value) { return _mm256_xor_ps(value.value, _mm256_set1_ps(-0.0f)); }
+
+	inline LaneMask operator<(Lanes lhs, Lanes rhs) { return LaneMask{ _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LT_OQ) }; }
+	inline LaneMask operator<=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LE_OQ) }; }
+	inline LaneMask operator>(Lanes lhs, Lanes rhs) { return LaneMask{ _mm256_cmp_ps(lhs.value, rhs.value, _CMP_GT_OQ) }; }
+	inline LaneMask operator>=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm256_cmp_ps(lhs.value, rhs.value, _CMP_GE_OQ) }; }
+	inline LaneMask operator&(LaneMask lhs, LaneMask rhs) { return LaneMask{ _mm256_and_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator|(LaneMask lhs, LaneMask rhs) { return LaneMask{ _mm256_or_ps(lhs.value, rhs.value) }; }
+
+	inline Lanes MulAdd(Lanes a, Lanes b, Lanes c)
+	{
+#if PWM_USE_FMA
+		return _mm256_fmadd_ps(a.value, b.value, c.value);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(a.value, b.value), c.value);
+#endif // PWM_USE_FMA
+	}
+	inline Lanes DifferenceOfProducts(Lanes a, Lanes b, Lanes c, Lanes d)
+	{
+		const auto half = [&](int index)
+		{
+			const auto widen = [&](Lanes value) { return _mm256_cvtps_pd(index == 0 ? _mm256_castps256_ps128(value.value) : _mm256_extractf128_ps(value.value, 1)); };
+			return _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_mul_pd(widen(a), widen(b)), _mm256_mul_pd(widen(c), widen(d))));
+		};
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(half(0)), half(1), 1);
+	}
+	inline Lanes Min(Lanes lhs, Lanes rhs) { return _mm256_min_ps(lhs.value, rhs.value); }
+	inline Lanes Max(Lanes lhs, Lanes rhs) { return _mm256_max_ps(lhs.value, rhs.value); }
+	inline Lanes Abs(Lanes value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value.value); }
+	inline Lanes Sqrt(Lanes value) { return _mm256_sqrt_ps(value.value); }
+	inline Lanes Reciprocal(Lanes value)
+	{
+		const Lanes estimate = _mm256_rcp_ps(value.value);
+		return estimate * (Lanes{ 2.0f } - value * estimate);
+	}
+	inline Lanes Select(LaneMask mask, Lanes ifTrue, Lanes ifFalse) { return _mm256_blendv_ps(ifFalse.value, ifTrue.value, mask.value); }
+
+#pragma endregion
+
+#elif PWM_USE_SSE
+
+#pragma region SSE lanes
+
+	inline Lanes::Type Lanes::Broadcast(float value) { return _mm_set1_ps(value); }
+
+	inline Lanes Lanes::Load(const float* values) { return _mm_loadu_ps(values); }
+	inline Lanes Lanes::Load(const uint8_t* values)
+	{
+		int32_t bytes;
+		std::memcpy(&bytes, values, sizeof(bytes));
+		const __m128i zero = _mm_setzero_si128();
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero));
+	}
+	inline Lanes Lanes::Load(const uint16_t* values) { return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)), _mm_setzero_si128())); }
+	inline Lanes Lanes::Load(const float* values, size_t stride) { return _mm_setr_ps(values[0], values[stride], values[2 * stride], values[3 * stride]); }
+	inline Lanes Lanes::LoadPartial(const float* values, size_t count)
+	{
+		float padded[4] = {};
+		for (size_t i = 0; i < count; ++i)
+			padded[i] = values[i];
+		return _mm_loadu_ps(padded);
+	}
+	inline void Lanes::LoadXYZ(const float* values, Lanes& x, Lanes& y, Lanes& z)
+	{
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		const __m128 a = _mm_loadu_ps(values), b = _mm_loadu_ps(values + 4), c = _mm_loadu_ps(values + 8);
+		x = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 3, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+	inline void Lanes::StoreXYZ(float* values, Lanes x, Lanes y, Lanes z)
+	{
+		// Builds a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		const __m128 xy01 = _mm_unpacklo_ps(x.value, y.value), xy23 = _mm_unpackhi_ps(x.value, y.value);
+		_mm_storeu_ps(values, _mm_shuffle_ps(xy01, _mm_shuffle_ps(z.value, x.value, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(values + 4, _mm_shuffle_ps(_mm_shuffle_ps(y.value, z.value, _MM_SHUFFLE(1, 1, 1, 1)), xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+		_mm_storeu_ps(values + 8, _mm_shuffle_ps(_mm_shuffle_ps(z.value, xy23, _MM_SHUFFLE(3, 2, 2, 2)), _mm_shuffle_ps(xy23, z.value, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+	inline void Lanes::LoadXYZW(const float* values, Lanes& x, Lanes& y, Lanes& z, Lanes& w)
+	{
+		__m128 a = _mm_loadu_ps(values), b = _mm_loadu_ps(values + 4), c = _mm_loadu_ps(values + 8), d = _mm_loadu_ps(values + 12);
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+		x = a; y = b; z = c; w = d;
+	}
+	inline void Lanes::StoreXYZW(float* values, Lanes x, Lanes y, Lanes z, Lanes w)
+	{
+		_MM_TRANSPOSE4_PS(x.value, y.value, z.value, w.value);
+		_mm_storeu_ps(values, x.value);
+		_mm_storeu_ps(values + 4, y.value);
+		_mm_storeu_ps(values + 8, z.value);
+		_mm_storeu_ps(values + 12, w.value);
+	}
+	inline void Lanes::Store(float* values) const { _mm_storeu_ps(values, value); }
+	inline void Lanes::Store(uint8_t* values) const
+	{
+		// The integers fit in 16 bits either way, so the signed saturating pack doesn't change them
+		const __m128i words = _mm_packs_epi32(_mm_cvttps_epi32(value), _mm_setzero_si128());
+		const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+		std::memcpy(values, &bytes, sizeof(bytes));
+	}
+	inline void Lanes::Store(uint16_t* values) const
+	{
+#if PWM_USE_SSE4
+		const __m128i integers = _mm_cvttps_epi32(value);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_packus_epi32(integers, integers));
+#else
+		// SSE2 only has a signed pack, the integers are moved to the signed range and back
+		const __m128i shifted = _mm_sub_epi32(_mm_cvttps_epi32(value), _mm_set1_epi32(32768));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_xor_si128(_mm_packs_epi32(shifted, shifted), _mm_set1_epi16(INT16_MIN)));
+#endif // PWM_USE_SSE4
+	}
+	inline void Lanes::Store(float* values, size_t stride) const
+	{
+		alignas(16) float lanes[4];
+		_mm_store_ps(lanes, value);
+		for (size_t i = 0; i < 4; ++i)
+			values[i * stride] = lanes[i];
+	}
+
+	inline uint32_t LaneMask::Bits() const { return static_cast<uint32_t>(_mm_movemask_ps(value)); }
+
+	inline Lanes operator+(Lanes lhs, Lanes rhs) { return _mm_add_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes lhs, Lanes rhs) { return _mm_sub_ps(lhs.value, rhs.value); }
+	inline Lanes operator*(Lanes lhs, Lanes rhs) { return _mm_mul_ps(lhs.value, rhs.value); }
+	inline Lanes operator/(Lanes lhs, Lanes rhs) { return _mm_div_ps(lhs.value, rhs.value); }
+	inline Lanes operator-(Lanes value) { return _mm_xor_ps(value.value, _mm_set1_ps(-0.0f)); }
+
+	inline LaneMask operator<(Lanes lhs, Lanes rhs) { return LaneMask{ _mm_cmplt_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator<=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm_cmple_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator>(Lanes lhs, Lanes rhs) { return LaneMask{ _mm_cmpgt_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator>=(Lanes lhs, Lanes rhs) { return LaneMask{ _mm_cmpge_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator&(LaneMask lhs, LaneMask rhs) { return LaneMask{ _mm_and_ps(lhs.value, rhs.value) }; }
+	inline LaneMask operator|(LaneMask lhs, LaneMask rhs) { return LaneMask{ _mm_or_ps(lhs.value, rhs.value) }; }
+
+	inline Lanes MulAdd(Lanes a, Lanes b, Lanes c)
+	{
+#if PWM_USE_FMA
+		return _mm_fmadd_ps(a.value, b.value, c.value);
+#else
+		return _mm_add_ps(_mm_mul_ps(a.value, b.value), c.value);
+#endif // PWM_USE_FMA
+	}
+	inline Lanes DifferenceOfProducts(Lanes a, Lanes b, Lanes c, Lanes d)
+	{
+		const auto half = [&](bool high)
+		{
+			const auto widen = [&](Lanes value) { return _mm_cvtps_pd(high ? _mm_movehl_ps(value.value, value.value) : value.value); };
+			return _mm_cvtpd_ps(_mm_sub_pd(_mm_mul_pd(widen(a), widen(b)), _mm_mul_pd(widen(c), widen(d))));
+		};
+		return _mm_movelh_ps(half(false), half(true));
+	}
+	inline Lanes Min(Lanes lhs, Lanes rhs) { return _mm_min_ps(lhs.value, rhs.value); }
+	inline Lanes Max(Lanes lhs, Lanes rhs) { return _mm_max_ps(lhs.value, rhs.value); }
+	inline Lanes Abs(Lanes value) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value.value); }
+	inline Lanes Sqrt(Lanes value) { return _mm_sqrt_ps(value.value); }
+	inline Lanes Reciprocal(Lanes value)
+	{
+		const Lanes estimate = _mm_rcp_ps(value.value);
+		return estimate * (Lanes{ 2.0f } - value * estimate);
+	}
+	inline Lanes Select(LaneMask mask, Lanes ifTrue, Lanes ifFalse)
+	{
+#if PWM_USE_SSE4
+		return _mm_blendv_ps(ifFalse.value, ifTrue.value, mask.value);
+#else
+		return _mm_or_ps(_mm_and_ps(mask.value, ifTrue.value), _mm_andnot_ps(mask.value, ifFalse.value));
+#endif // PWM_USE_SSE4
+	}
+
+#pragma endregion
+
+#else
+
+#pragma region Scalar lanes
+
+	inline Lanes::Type Lanes::Broadcast(float value) { return value; }
+
+	inline Lanes Lanes::Load(const float* values) { return values[0]; }
+	inline Lanes Lanes::Load(const uint8_t* values) { return static_cast<float>(values[0]); }
+	inline Lanes Lanes::Load(const uint16_t* values) { return static_cast<float>(values[0]); }
+	inline Lanes Lanes::Load(const float* values, size_t) { return values[0]; }
+	inline Lanes Lanes::LoadPartial(const float* values, size_t count) { return count ? values[0] : 0.0f; }
+	inline void Lanes::LoadXYZ(const float* values, Lanes& x, Lanes& y, Lanes& z) { x = values[0]; y = values[1]; z = values[2]; }
+	inline void Lanes::StoreXYZ(float* values, Lanes x, Lanes y, Lanes z) { values[0] = x.value; values[1] = y.value; values[2] = z.value; }
+	inline void Lanes::LoadXYZW(const float* values, Lanes& x, Lanes& y, Lanes& z, Lanes& w) { x = values[0]; y = values[1]; z = values[2]; w = values[3]; }
+	inline void Lanes::StoreXYZW(float* values, Lanes x, Lanes y, Lanes z, Lanes w) { values[0] = x.value; values[1] = y.value; values[2] = z.value; values[3] = w.value; }
+	inline void Lanes::Store(float* values) const { values[0] = value; }
+	inline void Lanes::Store(float* values, size_t) const { values[0] = value; }
+	inline void Lanes::Store(uint8_t* values) const { values[0] = static_cast<uint8_t>(value); }
+	inline void Lanes::Store(uint16_t* values) const { values[0] = static_cast<uint16_t>(value); }
+
+	inline uint32_t LaneMask::Bits() const { return value ? 1u : 0u; }
+
+	inline Lanes operator+(Lanes lhs, Lanes rhs) { return lhs.value + rhs.value; }
+	inline Lanes operator-(Lanes lhs, Lanes rhs) { return lhs.value - rhs.value; }
+	inline Lanes operator*(Lanes lhs, Lanes rhs) { return lhs.value * rhs.value; }
+	inline Lanes operator/(Lanes lhs, Lanes rhs) { return lhs.value / rhs.value; }
+	inline Lanes operator-(Lanes value) { return -value.value; }
+
+	inline LaneMask operator<(Lanes lhs, Lanes rhs) { return LaneMask{ lhs.value < rhs.value }; }
+	inline LaneMask operator<=(Lanes lhs, Lanes rhs) { return LaneMask{ lhs.value <= rhs.value }; }
+	inline LaneMask operator>(Lanes lhs, Lanes rhs) { return LaneMask{ lhs.value > rhs.value }; }
+	inline LaneMask operator>=(Lanes lhs, Lanes rhs) { return LaneMask{ lhs.value >= rhs.value }; }
+	inline LaneMask operator&(LaneMask lhs, LaneMask rhs) { return LaneMask{ lhs.value && rhs.value }; }
+	inline LaneMask operator|(LaneMask lhs, LaneMask rhs) { return LaneMask{ lhs.value || rhs.value }; }
+
+	inline Lanes MulAdd(Lanes a, Lanes b, Lanes c) { return (a.value * b.value) + c.value; }
+	inline Lanes DifferenceOfProducts(Lanes a, Lanes b, Lanes c, Lanes d)
+	{
+		return static_cast<float>(static_cast<double>(a.value) * b.value - static_cast<double>(c.value) * d.value);
+	}
+	inline Lanes Min(Lanes lhs, Lanes rhs) { return lhs.value < rhs.value ? lhs.value : rhs.value; }
+	inline Lanes Max(Lanes lhs, Lanes rhs) { return lhs.value > rhs.value ? lhs.value : rhs.value; }
+	inline Lanes Abs(Lanes value) { return std::abs(value.value); }
+	inline Lanes Sqrt(Lanes value) { return std::sqrt(value.value); }
+	inline Lanes Reciprocal(Lanes value) { return 1.0f / value.value; }
+	inline Lanes Select(LaneMask mask, Lanes ifTrue, Lanes ifFalse) { return mask.value ? ifTrue : ifFalse; }
+
+#pragma endregion
+
+#endif // PWM_USE_AVX512
+
+	inline void SinCos(Lanes angle, Lanes& sine, Lanes& cosine)
+	{
+		// Nearest number of quarter turns, adding 1.5 * 2^23 leaves no fraction bits so the addition rounds
+		const Lanes round = 12582912.0f;
+		const Lanes quarters = (angle * 0.636619772f + round) - round;
+
+		// pi/2 split in three, the first two have few enough bits that multiplying them by quarters (up to 2^13) is exact
+		Lanes reduced = MulAdd(quarters, -1.5703125f, angle);
+		reduced = MulAdd(quarters, -4.837512969970703125e-4f, reduced);
+		reduced = MulAdd(quarters, -7.54978995489188216e-8f, reduced);
+
+		const Lanes reduced2 = reduced * reduced;
+		const Lanes reducedSin = MulAdd(MulAdd(MulAdd(reduced2, -1.9515295891e-4f, 8.3321608736e-3f), reduced2, -1.6666654611e-1f), reduced2 * reduced, reduced);
+		const Lanes reducedCos = MulAdd(MulAdd(MulAdd(MulAdd(reduced2, 2.443315711809948e-5f, -1.388731625493765e-3f), reduced2, 4.166664568298827e-2f), reduced2, -0.5f), reduced2, 1.0f);
+
+		// The quadrant (quarters mod 4) picks and negates the polynomials, done in float since the lanes have no integer operations
+		Lanes floorQuarter = (quarters * 0.25f + round) - round;
+		floorQuarter = Select(floorQuarter > quarters * 0.25f, floorQuarter - 1.0f, floorQuarter);
+		const Lanes quadrant = MulAdd(floorQuarter, -4.0f, quarters);
+
+		const LaneMask odd = ((quadrant > 0.5f) & (quadrant < 1.5f)) | (quadrant > 2.5f);
+		const Lanes sineValue = Select(odd, reducedCos, reducedSin), cosineValue = Select(odd, reducedSin, reducedCos);
+		sine = Select(quadrant > 1.5f, -sineValue, sineValue);
+		cosine = Select((quadrant > 0.5f) & (quadrant < 2.5f), -cosineValue, cosineValue);
+
+		// Past 8192 the reduction isn't exact anymore, this also catches infinities and NaNs (NaN fails the comparison)
+		const uint32_t outside = (Abs(angle) <= 8192.0f).Bits() ^ ((1u << Lanes::width) - 1);
+		if (outside != 0)
+		{
+			float angles[Lanes::width], sines[Lanes::width], cosines[Lanes::width];
+			angle.Store(angles);
+			sine.Store(sines);
+			cosine.Store(cosines);
+			for (size_t i = 0; i < Lanes::width; ++i)
+			{
+				if ((outside >> i) & 1)
+				{
+					sines[i] = std::sin(angles[i]);
+					cosines[i] = std::cos(angles[i]);
+				}
+			}
+			sine = Lanes::Load(sines);
+			cosine = Lanes::Load(cosines);
+		}
+	}
+
+	inline size_t CompressIndices(uint32_t bits, uint32_t first, uint32_t* indices)
+	{
+		size_t count = 0;
+		while (bits != 0)
+		{
+			indices[count++] = first + static_cast<uint32_t>(std::countr_zero(bits));
+			bits &= bits - 1;
+		}
+		return count;
+	}
+}
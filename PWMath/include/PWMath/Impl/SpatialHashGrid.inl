@@ -0,0 +1,345 @@
+#pragma once
+#include <PWMath/SpatialHashGrid.h>
+#include <PWMath/Parallel.h>
+#include <PWMath/Simd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Inputs this big are counted and scattered on all cores
+		inline constexpr size_t hashGridParallelSize = size_t{ 1 } << 15;
+
+		template<typename T>
+		int32_t CellCoordinate(T value, T inverseCellSize)
+		{
+			return static_cast<int32_t>(std::floor(value * inverseCellSize));
+		}
+
+		// Adds amount to value and returns what it held before, atomically when value is shared between threads
+		inline uint32_t FetchAdd(uint32_t& value, uint32_t amount, std::false_type) { return std::exchange(value, value + amount); }
+		inline uint32_t FetchAdd(uint32_t& value, uint32_t amount, std::true_type) { return std::atomic_ref<uint32_t>{ value }.fetch_add(amount, std::memory_order_relaxed); }
+
+		// Hash from Teschner et al. 2003, "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+		inline uint32_t HashCell(int32_t x, int32_t y, int32_t z, uint32_t mask)
+		{
+			return ((static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(z) * 83492791u)) & mask;
+		}
+
+		// Buckets a query has visited, so buckets shared by several cells are only searched once
+		// Notes:
+		//  - The first buckets go in an inline array, past that a bit per bucket is allocated
+		class VisitedBuckets
+		{
+		public:
+			explicit VisitedBuckets(size_t bucketCount) :bucketCount{ bucketCount } {}
+
+			// Returns true the first time a bucket is inserted
+			bool Insert(uint32_t bucket)
+			{
+				if (bits.empty())
+				{
+					if (std::find(buckets, buckets + size, bucket) != buckets + size)
+						return false;
+					if (size < inlineCapacity)
+					{
+						buckets[size++] = bucket;
+						return true;
+					}
+
+					bits.resize((bucketCount + 63) / 64);
+					for (size_t i = 0; i < size; ++i)
+						bits[buckets[i] / 64] |= uint64_t{ 1 } << (buckets[i] % 64);
+				}
+
+				const uint64_t bit = uint64_t{ 1 } << (bucket % 64);
+				if (bits[bucket / 64] & bit)
+					return false;
+				bits[bucket / 64] |= bit;
+				return true;
+			}
+
+		private:
+			static constexpr size_t inlineCapacity = 64;
+
+			size_t bucketCount, size = 0;
+			uint32_t buckets[inlineCapacity];
+			std::vector<uint64_t> bits;
+		};
+
+		// Calls function(sortedIndex, distance2) for the points of a bucket within the squared radius of center
+		// Notes:
+		//  - radius2 is read again for every group of lanes, so function can lower it while the bucket is searched
+		template<typename T, PackingMode P, typename Function>
+		void ForEachInBucket(const SpatialHashGrid<T, P>& grid, uint32_t bucket, const Vector3<T, P>& center, const T& radius2, Function&& function)
+		{
+			const size_t begin = grid.bucketStarts[bucket], end = grid.bucketStarts[bucket + 1];
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+
+				const Lanes centerX = center.x, centerY = center.y, centerZ = center.z;
+				for (size_t i = begin; i < end; i += Lanes::width)
+				{
+					// The last group of a bucket loads the lanes past its end as 0 and masks them out
+					const size_t count = std::min(Lanes::width, end - i);
+					const Lanes x = count == Lanes::width ? Lanes::Load(grid.x.data() + i) : Lanes::LoadPartial(grid.x.data() + i, count);
+					const Lanes y = count == Lanes::width ? Lanes::Load(grid.y.data() + i) : Lanes::LoadPartial(grid.y.data() + i, count);
+					const Lanes z = count == Lanes::width ? Lanes::Load(grid.z.data() + i) : Lanes::LoadPartial(grid.z.data() + i, count);
+
+					const Lanes dx = x - centerX, dy = y - centerY, dz = z - centerZ;
+					const Lanes distance2 = MulAdd(dx, dx, MulAdd(dy, dy, dz * dz));
+					uint32_t inside = (distance2 <= Lanes{ radius2 }).Bits() & ((1u << count) - 1);
+					if (inside == 0)
+						continue;
+
+					float distances2[Lanes::width];
+					distance2.Store(distances2);
+					for (; inside; inside &= inside - 1)
+					{
+						const size_t lane = static_cast<size_t>(std::countr_zero(inside));
+						function(i + lane, distances2[lane]);
+					}
+				}
+			}
+			else
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					const T dx = grid.x[i] - center.x, dy = grid.y[i] - center.y, dz = grid.z[i] - center.z;
+					const T distance2 = dx * dx + dy * dy + dz * dz;
+					if (distance2 <= radius2)
+						function(i, distance2);
+				}
+			}
+		}
+	}
+
+	template<typename T, PackingMode P>
+	void Rebuild(SpatialHashGrid<T, P>& grid, const Vector3<T, P>* points, size_t count, std::type_identity_t<T> cellSize)
+	{
+		const size_t bucketCount = std::bit_ceil(std::max<size_t>(count, 1));
+		const uint32_t mask = static_cast<uint32_t>(bucketCount - 1);
+		const T inverseCellSize = static_cast<T>(1) / cellSize;
+
+		grid.cellSize = cellSize;
+		grid.bucketStarts.assign(bucketCount + 1, 0);
+		grid.pointIndices.resize(count);
+		grid.x.resize(count);
+		grid.y.resize(count);
+		grid.z.resize(count);
+
+		// The hash is computed again when scattering instead of being stored, so the only memory is the grid's own
+		auto bucketOf = [&](size_t i)
+		{
+			const Vector3<T, P>& point = points[i];
+			return Detail::HashCell(Detail::CellCoordinate(point.x, inverseCellSize), Detail::CellCoordinate(point.y, inverseCellSize),
+				Detail::CellCoordinate(point.z, inverseCellSize), mask);
+		};
+		// The ranges share one count per bucket, the loops are compiled with atomics for when there is more than one range
+		const bool parallel = ParallelRangeCount(count, Detail::hashGridParallelSize) > 1;
+		uint32_t* bucketEnds = grid.bucketStarts.data();
+		auto countPoints = [&](auto shared)
+		{
+			ParallelFor(count, Detail::hashGridParallelSize, [&](size_t, size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+					Detail::FetchAdd(bucketEnds[bucketOf(i)], 1, shared);
+			});
+		};
+		parallel ? countPoints(std::true_type{}) : countPoints(std::false_type{});
+
+		// Turns the counts into where each bucket ends: each range of buckets sums its counts, then scans them starting from the sum of the ranges before it
+		std::vector<uint32_t> rangeSums(ParallelRangeCount(bucketCount, Detail::hashGridParallelSize));
+		ParallelFor(bucketCount, Detail::hashGridParallelSize, [&](size_t range, size_t begin, size_t end)
+		{
+			rangeSums[range] = std::accumulate(bucketEnds + begin, bucketEnds + end, uint32_t{ 0 });
+		});
+		std::exclusive_scan(rangeSums.begin(), rangeSums.end(), rangeSums.begin(), uint32_t{ 0 });
+		ParallelFor(bucketCount, Detail::hashGridParallelSize, [&](size_t range, size_t begin, size_t end)
+		{
+			std::inclusive_scan(bucketEnds + begin, bucketEnds + end, bucketEnds + begin, std::plus<>{}, rangeSums[range]);
+		});
+		grid.bucketStarts[bucketCount] = static_cast<uint32_t>(count);
+
+		// Fills each bucket from its end, which leaves bucketStarts at the start of each bucket.
+		// The points are taken backwards, so a single range writes every bucket in input order
+		auto scatterPoints = [&](auto shared)
+		{
+			ParallelFor(count, Detail::hashGridParallelSize, [&](size_t, size_t begin, size_t end)
+			{
+				for (size_t i = end; i-- > begin;)
+					grid.pointIndices[Detail::FetchAdd(bucketEnds[bucketOf(i)], ~uint32_t{ 0 }, shared) - 1] = static_cast<uint32_t>(i);
+			});
+		};
+		parallel ? scatterPoints(std::true_type{}) : scatterPoints(std::false_type{});
+
+		// Several ranges write to a bucket in whatever order their threads run, sorting it keeps every rebuild the same
+		if (parallel)
+		{
+			ParallelFor(bucketCount, Detail::hashGridParallelSize, [&](size_t, size_t begin, size_t end)
+			{
+				for (size_t bucket = begin; bucket < end; ++bucket)
+					std::sort(grid.pointIndices.begin() + grid.bucketStarts[bucket], grid.pointIndices.begin() + grid.bucketStarts[bucket + 1]);
+			});
+		}
+
+		// The positions are gathered in a pass of their own, a random read per point costs less than scattering to 3 arrays
+		ParallelFor(count, Detail::hashGridParallelSize, [&](size_t, size_t begin, size_t end)
+		{
+			for (size_t sorted = begin; sorted < end; ++sorted)
+			{
+				const Vector3<T, P>& point = points[grid.pointIndices[sorted]];
+				grid.x[sorted] = point.x;
+				grid.y[sorted] = point.y;
+				grid.z[sorted] = point.z;
+			}
+		});
+	}
+
+	template<typename T, PackingMode P, typename Callback>
+	void QueryRadius(const SpatialHashGrid<T, P>& grid, const Vector3<T, P>& center, std::type_identity_t<T> radius, Callback&& callback)
+	{
+		if (grid.PointCount() == 0 || !(radius >= static_cast<T>(0)))
+			return;
+
+		const T radius2 = radius * radius;
+		auto search = [&](uint32_t bucket)
+		{
+			Detail::ForEachInBucket(grid, bucket, center, radius2, [&](size_t sorted, T distance2) { callback(grid.pointIndices[sorted], distance2); });
+		};
+
+		// Cells the sphere overlaps, when there are more of them than buckets every bucket gets searched once instead
+		const T inverseCellSize = static_cast<T>(1) / grid.cellSize;
+		const T cellCount = (std::floor((center.x + radius) * inverseCellSize) - std::floor((center.x - radius) * inverseCellSize) + static_cast<T>(1))
+			* (std::floor((center.y + radius) * inverseCellSize) - std::floor((center.y - radius) * inverseCellSize) + static_cast<T>(1))
+			* (std::floor((center.z + radius) * inverseCellSize) - std::floor((center.z - radius) * inverseCellSize) + static_cast<T>(1));
+		if (!(cellCount < static_cast<T>(grid.BucketCount())))
+		{
+			for (size_t bucket = 0; bucket < grid.BucketCount(); ++bucket)
+				search(static_cast<uint32_t>(bucket));
+			return;
+		}
+
+		const int32_t min[3] = {
+			Detail::CellCoordinate(center.x - radius, inverseCellSize), Detail::CellCoordinate(center.y - radius, inverseCellSize), Detail::CellCoordinate(center.z - radius, inverseCellSize)
+		};
+		const int32_t max[3] = {
+			Detail::CellCoordinate(center.x + radius, inverseCellSize), Detail::CellCoordinate(center.y + radius, inverseCellSize), Detail::CellCoordinate(center.z + radius, inverseCellSize)
+		};
+
+		const uint32_t mask = static_cast<uint32_t>(grid.BucketCount() - 1);
+		Detail::VisitedBuckets visited{ grid.BucketCount() };
+		for (int32_t z = min[2]; z <= max[2]; ++z)
+		{
+			for (int32_t y = min[1]; y <= max[1]; ++y)
+			{
+				for (int32_t x = min[0]; x <= max[0]; ++x)
+				{
+					const uint32_t bucket = Detail::HashCell(x, y, z, mask);
+					if (visited.Insert(bucket))
+						search(bucket);
+				}
+			}
+		}
+	}
+
+	template<typename T, PackingMode P>
+	size_t QueryNearest(const SpatialHashGrid<T, P>& grid, const Vector3<T, P>& point, size_t k, std::type_identity_t<T> maxDistance, uint32_t* indices, T* distances2)
+	{
+		if (k == 0 || grid.PointCount() == 0 || !(maxDistance >= static_cast<T>(0)))
+			return 0;
+
+		// Keeps the nearest points sorted, bound is the squared distance a point has to beat to get in
+		size_t found = 0;
+		T bound = maxDistance * maxDistance;
+		auto add = [&](size_t sorted, T distance2)
+		{
+			if (found == k)
+			{
+				if (!(distance2 < distances2[k - 1]))
+					return;
+				--found;
+			}
+
+			size_t slot = found++;
+			for (; slot > 0 && distances2[slot - 1] > distance2; --slot)
+			{
+				distances2[slot] = distances2[slot - 1];
+				indices[slot] = indices[slot - 1];
+			}
+			distances2[slot] = distance2;
+			indices[slot] = grid.pointIndices[sorted];
+
+			if (found == k)
+				bound = distances2[k - 1];
+		};
+
+		const size_t bucketCount = grid.BucketCount();
+		const uint32_t mask = static_cast<uint32_t>(bucketCount - 1);
+		const T inverseCellSize = static_cast<T>(1) / grid.cellSize;
+		const int32_t cell[3] = {
+			Detail::CellCoordinate(point.x, inverseCellSize), Detail::CellCoordinate(point.y, inverseCellSize), Detail::CellCoordinate(point.z, inverseCellSize)
+		};
+
+		// Every point of ring r + 1 and farther is at least r cells plus the distance to the nearest face of the point's own cell away
+		T faceDistance = grid.cellSize;
+		for (size_t c = 0; c < 3; ++c)
+		{
+			const T cellMin = static_cast<T>(cell[c]) * grid.cellSize;
+			faceDistance = std::min({ faceDistance, point[c] - cellMin, cellMin + grid.cellSize - point[c] });
+		}
+		faceDistance = std::max(faceDistance, static_cast<T>(0));
+
+		// Points within maxDistance are at most this many rings away
+		const T lastRing = std::ceil(maxDistance * inverseCellSize);
+
+		Detail::VisitedBuckets visited{ bucketCount };
+		for (int32_t ring = 0; ; ++ring)
+		{
+			// Once the rings cover more cells than there are buckets, the buckets not searched yet are searched directly
+			const T side = static_cast<T>(2 * ring + 1);
+			if (!(side * side * side < static_cast<T>(bucketCount)))
+			{
+				for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+				{
+					if (visited.Insert(static_cast<uint32_t>(bucket)))
+						Detail::ForEachInBucket(grid, static_cast<uint32_t>(bucket), point, bound, add);
+				}
+				break;
+			}
+
+			// Only the shell of the ring: on the faces of the cube every cell, in between only the two ends of each row
+			for (int32_t dz = -ring; dz <= ring; ++dz)
+			{
+				for (int32_t dy = -ring; dy <= ring; ++dy)
+				{
+					const bool face = std::abs(dz) == ring || std::abs(dy) == ring;
+					for (int32_t dx = -ring; dx <= ring; dx += face ? 1 : 2 * ring)
+					{
+						const uint32_t bucket = Detail::HashCell(cell[0] + dx, cell[1] + dy, cell[2] + dz, mask);
+						if (visited.Insert(bucket))
+							Detail::ForEachInBucket(grid, bucket, point, bound, add);
+					}
+				}
+			}
+
+			const T reach = static_cast<T>(ring) * grid.cellSize + faceDistance;
+			if ((found == k && distances2[k - 1] <= reach * reach) || static_cast<T>(ring) >= lastRing)
+				break;
+		}
+
+		return found;
+	}
+}
@@ -0,0 +1,452 @@
+#pragma once
+#include <PWMath/Sphere.h>
+#include <PWMath/Parallel.h>
+#include <PWMath/Simd.h>
+#include <PWMath/Stream.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Inputs this big are split over all cores
+		inline constexpr size_t sphereParallelSize = size_t{ 1 } << 16;
+
+		template<typename T, PackingMode P>
+		AABB<T, P> PointBounds(const Vector3<T, P>* points, size_t begin, size_t end)
+		{
+			AABB<T, P> box = AABB<T, P>::Empty();
+			size_t i = begin;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+
+				Lanes min[3], max[3];
+				for (size_t c = 0; c < 3; ++c)
+				{
+					min[c] = std::numeric_limits<float>::max();
+					max[c] = std::numeric_limits<float>::lowest();
+				}
+
+				for (; i + Lanes::width <= end; i += Lanes::width)
+				{
+					Lanes point[3];
+					LoadVectors(points + i, point[0], point[1], point[2]);
+					for (size_t c = 0; c < 3; ++c)
+					{
+						min[c] = Min(min[c], point[c]);
+						max[c] = Max(max[c], point[c]);
+					}
+				}
+
+				float mins[3][Lanes::width], maxs[3][Lanes::width];
+				for (size_t c = 0; c < 3; ++c)
+				{
+					min[c].Store(mins[c]);
+					max[c].Store(maxs[c]);
+					for (size_t lane = 0; lane < Lanes::width; ++lane)
+					{
+						box.min[c] = std::min(box.min[c], mins[c][lane]);
+						box.max[c] = std::max(box.max[c], maxs[c][lane]);
+					}
+				}
+			}
+
+			for (; i < end; ++i)
+				box = Merge(box, points[i]);
+			return box;
+		}
+
+		template<typename T, PackingMode P>
+		struct FarthestPoint
+		{
+			T distance2;
+			Vector3<T, P> point;
+		};
+
+		template<typename T, PackingMode P>
+		FarthestPoint<T, P> FindFarthestPoint(const Vector3<T, P>* points, size_t begin, size_t end, const Vector3<T, P>& from)
+		{
+			FarthestPoint<T, P> farthest{ static_cast<T>(-1), from };
+			size_t i = begin;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+
+				const Lanes fromX = from.x, fromY = from.y, fromZ = from.z;
+				Lanes best = -1.0f, bestX = from.x, bestY = from.y, bestZ = from.z;
+				for (; i + Lanes::width <= end; i += Lanes::width)
+				{
+					Lanes x, y, z;
+					LoadVectors(points + i, x, y, z);
+
+					const Lanes dx = x - fromX, dy = y - fromY, dz = z - fromZ;
+					const Lanes distance2 = MulAdd(dx, dx, MulAdd(dy, dy, dz * dz));
+					const auto farther = distance2 > best;
+					best = Select(farther, distance2, best);
+					bestX = Select(farther, x, bestX);
+					bestY = Select(farther, y, bestY);
+					bestZ = Select(farther, z, bestZ);
+				}
+
+				float distances[Lanes::width], xs[Lanes::width], ys[Lanes::width], zs[Lanes::width];
+				best.Store(distances);
+				bestX.Store(xs);
+				bestY.Store(ys);
+				bestZ.Store(zs);
+				for (size_t lane = 0; lane < Lanes::width; ++lane)
+				{
+					if (distances[lane] > farthest.distance2)
+						farthest = FarthestPoint<T, P>{ distances[lane], Vector3<T, P>{ xs[lane], ys[lane], zs[lane] } };
+				}
+			}
+
+			for (; i < end; ++i)
+			{
+				const T distance2 = Length2(points[i] - from);
+				if (distance2 > farthest.distance2)
+					farthest = FarthestPoint<T, P>{ distance2, points[i] };
+			}
+			return farthest;
+		}
+
+		template<typename T, PackingMode P>
+		FarthestPoint<T, P> FindFarthestPoint(const Vector3<T, P>* points, size_t count, const Vector3<T, P>& from)
+		{
+			return ParallelReduce(count, sphereParallelSize,
+				[&](size_t begin, size_t end) { return FindFarthestPoint(points, begin, end, from); },
+				[](const FarthestPoint<T, P>& lhs, const FarthestPoint<T, P>& rhs) { return rhs.distance2 > lhs.distance2 ? rhs : lhs; });
+		}
+
+		// Projections of a point on the EPOS directions: the 3 axes and the 4 diagonals
+		// Notes:
+		//  - The diagonals aren't normalized, only the order of the points along each direction matters
+		//  - Works on T and Simd::Lanes, the same operations in the same order give the same values for both
+		template<typename V>
+		void ProjectEPOS(V x, V y, V z, V (&projections)[7])
+		{
+			const V sum = x + y, difference = x - y;
+			projections[0] = x;
+			projections[1] = y;
+			projections[2] = z;
+			projections[3] = sum + z;
+			projections[4] = sum - z;
+			projections[5] = difference + z;
+			projections[6] = difference - z;
+		}
+
+		template<typename T, PackingMode P>
+		struct ExtremalPoints
+		{
+			static constexpr size_t directionCount = 7;
+
+			T minProjections[directionCount], maxProjections[directionCount];
+			Vector3<T, P> minPoints[directionCount], maxPoints[directionCount];
+
+			static ExtremalPoints Empty()
+			{
+				ExtremalPoints extremes;
+				for (size_t d = 0; d < directionCount; ++d)
+				{
+					extremes.minProjections[d] = std::numeric_limits<T>::max();
+					extremes.maxProjections[d] = std::numeric_limits<T>::lowest();
+					extremes.minPoints[d] = extremes.maxPoints[d] = Vector3<T, P>{ static_cast<T>(0) };
+				}
+				return extremes;
+			}
+
+			// Updates the directions with a set bit in directions
+			void Add(const Vector3<T, P>& point, uint32_t directions)
+			{
+				T projections[directionCount];
+				ProjectEPOS(point.x, point.y, point.z, projections);
+				for (; directions; directions &= directions - 1)
+				{
+					const size_t d = static_cast<size_t>(std::countr_zero(directions));
+					if (projections[d] < minProjections[d])
+					{
+						minProjections[d] = projections[d];
+						minPoints[d] = point;
+					}
+					if (projections[d] > maxProjections[d])
+					{
+						maxProjections[d] = projections[d];
+						maxPoints[d] = point;
+					}
+				}
+			}
+
+			static ExtremalPoints Merge(const ExtremalPoints& lhs, const ExtremalPoints& rhs)
+			{
+				ExtremalPoints extremes = lhs;
+				for (size_t d = 0; d < directionCount; ++d)
+				{
+					if (rhs.minProjections[d] < extremes.minProjections[d])
+					{
+						extremes.minProjections[d] = rhs.minProjections[d];
+						extremes.minPoints[d] = rhs.minPoints[d];
+					}
+					if (rhs.maxProjections[d] > extremes.maxProjections[d])
+					{
+						extremes.maxProjections[d] = rhs.maxProjections[d];
+						extremes.maxPoints[d] = rhs.maxPoints[d];
+					}
+				}
+				return extremes;
+			}
+		};
+
+		template<typename T, PackingMode P>
+		ExtremalPoints<T, P> FindExtremalPoints(const Vector3<T, P>* points, size_t begin, size_t end)
+		{
+			constexpr uint32_t allDirections = (1u << ExtremalPoints<T, P>::directionCount) - 1;
+			ExtremalPoints<T, P> extremes = ExtremalPoints<T, P>::Empty();
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// Tracking which point each lane came from would need 3 selects per comparison.
+				// Instead only the projection bounds of each block are found with SIMD, and the rare blocks that move a bound are scanned again
+				using Simd::Lanes;
+				constexpr size_t blockSize = 1024;
+
+				for (size_t blockBegin = begin; blockBegin < end; blockBegin += blockSize)
+				{
+					const size_t blockEnd = std::min(blockBegin + blockSize, end);
+
+					Lanes min[7], max[7];
+					for (size_t d = 0; d < 7; ++d)
+					{
+						min[d] = std::numeric_limits<float>::max();
+						max[d] = std::numeric_limits<float>::lowest();
+					}
+
+					size_t i = blockBegin;
+					for (; i + Lanes::width <= blockEnd; i += Lanes::width)
+					{
+						Lanes x, y, z, projections[7];
+						LoadVectors(points + i, x, y, z);
+						ProjectEPOS(x, y, z, projections);
+						for (size_t d = 0; d < 7; ++d)
+						{
+							min[d] = Min(min[d], projections[d]);
+							max[d] = Max(max[d], projections[d]);
+						}
+					}
+
+					uint32_t moved = 0;
+					for (size_t d = 0; d < 7; ++d)
+					{
+						float mins[Lanes::width], maxs[Lanes::width];
+						min[d].Store(mins);
+						max[d].Store(maxs);
+						for (size_t lane = 0; lane < Lanes::width; ++lane)
+						{
+							if (mins[lane] < extremes.minProjections[d] || maxs[lane] > extremes.maxProjections[d])
+								moved |= 1u << d;
+						}
+					}
+
+					if (moved)
+					{
+						for (size_t j = blockBegin; j < i; ++j)
+							extremes.Add(points[j], moved);
+					}
+					for (; i < blockEnd; ++i)
+						extremes.Add(points[i], allDirections);
+				}
+			}
+			else
+			{
+				for (size_t i = begin; i < end; ++i)
+					extremes.Add(points[i], allDirections);
+			}
+
+			return extremes;
+		}
+
+		template<typename T, PackingMode P>
+		Sphere<T, P> GrowSphere(Sphere<T, P> sphere, const Vector3<T, P>* points, size_t begin, size_t end)
+		{
+			size_t i = begin;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// Once the sphere is close to its final size almost every point is inside, so only the lanes outside go through Merge
+				using Simd::Lanes;
+
+				Lanes centerX = sphere.center.x, centerY = sphere.center.y, centerZ = sphere.center.z, radius2 = sphere.radius * sphere.radius;
+				for (; i + Lanes::width <= end; i += Lanes::width)
+				{
+					Lanes x, y, z;
+					LoadVectors(points + i, x, y, z);
+
+					const Lanes dx = x - centerX, dy = y - centerY, dz = z - centerZ;
+					const uint32_t outside = (MulAdd(dx, dx, MulAdd(dy, dy, dz * dz)) > radius2).Bits();
+					if (outside == 0 && sphere.radius >= 0.0f)
+						continue;
+
+					for (size_t lane = 0; lane < Lanes::width; ++lane)
+						sphere = Merge(sphere, points[i + lane]);
+
+					centerX = sphere.center.x;
+					centerY = sphere.center.y;
+					centerZ = sphere.center.z;
+					radius2 = sphere.radius * sphere.radius;
+				}
+			}
+
+			for (; i < end; ++i)
+				sphere = Merge(sphere, points[i]);
+			return sphere;
+		}
+
+		// Grows the sphere over every point, each range grows its own copy when split over several cores
+		template<typename T, PackingMode P>
+		Sphere<T, P> GrowSphere(const Sphere<T, P>& sphere, const Vector3<T, P>* points, size_t count)
+		{
+			return ParallelReduce(count, sphereParallelSize,
+				[&](size_t begin, size_t end) { return GrowSphere(sphere, points, begin, end); },
+				[](const Sphere<T, P>& lhs, const Sphere<T, P>& rhs) { return Merge(lhs, rhs); });
+		}
+	}
+
+#pragma region Member functions
+
+	template<typename T, PackingMode P>
+	constexpr Sphere<T, P> Sphere<T, P>::Empty()
+	{
+		return Sphere<T, P>{ Vector3<T, P>{ static_cast<T>(0) }, static_cast<T>(-1) };
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const Sphere<T, P>& sphere, const Vector3<T, P>& point)
+	{
+		return sphere.radius >= static_cast<T>(0) && Length2(point - sphere.center) <= sphere.radius * sphere.radius;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const Sphere<T, P>& sphere, const Sphere<T, P>& inner)
+	{
+		if (inner.radius < static_cast<T>(0))
+			return true;
+		return sphere.radius >= inner.radius && Length(inner.center - sphere.center) + inner.radius <= sphere.radius;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Sphere<T, P> Merge(const Sphere<T, P>& lhs, const Sphere<T, P>& rhs)
+	{
+		if (Contains(lhs, rhs))
+			return lhs;
+		if (Contains(rhs, lhs))
+			return rhs;
+
+		// Neither contains the other, so the spheres have different centers
+		const Vector3<T, P> offset = rhs.center - lhs.center;
+		const T distance = Length(offset);
+		const T radius = (distance + lhs.radius + rhs.radius) / static_cast<T>(2);
+		return Sphere<T, P>{ lhs.center + ((radius - lhs.radius) / distance) * offset, radius };
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Sphere<T, P> Merge(const Sphere<T, P>& sphere, const Vector3<T, P>& point)
+	{
+		if (sphere.radius < static_cast<T>(0))
+			return Sphere<T, P>{ point, static_cast<T>(0) };
+
+		const Vector3<T, P> offset = point - sphere.center;
+		const T distance2 = Length2(offset);
+		if (distance2 <= sphere.radius * sphere.radius)
+			return sphere;
+
+		// The new sphere touches the point and the side of the old sphere opposite to it
+		const T distance = std::sqrt(distance2);
+		const T radius = (sphere.radius + distance) / static_cast<T>(2);
+		return Sphere<T, P>{ sphere.center + ((radius - sphere.radius) / distance) * offset, radius };
+	}
+
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereCentroid(const Vector3<T, P>* points, size_t count)
+	{
+		if (count == 0)
+			return Sphere<T, P>::Empty();
+
+		const AABB<T, P> box = ParallelReduce(count, Detail::sphereParallelSize,
+			[&](size_t begin, size_t end) { return Detail::PointBounds(points, begin, end); },
+			[](const AABB<T, P>& lhs, const AABB<T, P>& rhs) { return Merge(lhs, rhs); });
+
+		const Vector3<T, P> center = box.Center();
+		return Sphere<T, P>{ center, std::sqrt(Detail::FindFarthestPoint(points, count, center).distance2) };
+	}
+
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereRitter(const Vector3<T, P>* points, size_t count)
+	{
+		if (count == 0)
+			return Sphere<T, P>::Empty();
+
+		const Vector3<T, P> first = Detail::FindFarthestPoint(points, count, points[0]).point;
+		const Vector3<T, P> second = Detail::FindFarthestPoint(points, count, first).point;
+		return Detail::GrowSphere(Sphere<T, P>{ (first + second) / static_cast<T>(2), Length(second - first) / static_cast<T>(2) }, points, count);
+	}
+
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereEPOS(const Vector3<T, P>* points, size_t count, size_t refinementPasses)
+	{
+		using Extremes = Detail::ExtremalPoints<T, P>;
+		constexpr size_t candidateCount = 2 * Extremes::directionCount;
+
+		if (count == 0)
+			return Sphere<T, P>::Empty();
+
+		const Extremes extremes = ParallelReduce(count, Detail::sphereParallelSize,
+			[&](size_t begin, size_t end) { return Detail::FindExtremalPoints(points, begin, end); }, &Extremes::Merge);
+
+		Vector3<T, P> candidates[candidateCount];
+		std::copy(std::begin(extremes.minPoints), std::end(extremes.minPoints), candidates);
+		std::copy(std::begin(extremes.maxPoints), std::end(extremes.maxPoints), candidates + Extremes::directionCount);
+
+		// Starts from the two extremal points farthest apart and fits the sphere to the others
+		size_t first = 0, second = 0;
+		T farthest = static_cast<T>(-1);
+		for (size_t i = 0; i < candidateCount; ++i)
+		{
+			for (size_t j = i + 1; j < candidateCount; ++j)
+			{
+				const T distance2 = Length2(candidates[j] - candidates[i]);
+				if (distance2 > farthest)
+				{
+					farthest = distance2;
+					first = i;
+					second = j;
+				}
+			}
+		}
+
+		Sphere<T, P> sphere{ (candidates[first] + candidates[second]) / static_cast<T>(2), std::sqrt(farthest) / static_cast<T>(2) };
+		for (const auto& candidate : candidates)
+			sphere = Merge(sphere, candidate);
+		sphere = Detail::GrowSphere(sphere, points, count);
+
+		// Growing a slightly smaller sphere back over the points moves its center towards where it is needed
+		for (size_t pass = 0; pass < refinementPasses; ++pass)
+		{
+			const Sphere<T, P> refined = Detail::GrowSphere(Sphere<T, P>{ sphere.center, sphere.radius * static_cast<T>(0.95) }, points, count);
+			if (refined.radius < sphere.radius)
+				sphere = refined;
+		}
+		return sphere;
+	}
+
+#pragma endregion
+}
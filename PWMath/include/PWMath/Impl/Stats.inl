@@ -0,0 +1,118 @@
+#pragma once
+#include <PWMath/Stats.h>
+
+#if PWM_ENABLE_STATS
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif // PWM_ENABLE_STATS
+
+namespace PWMath
+{
+#if PWM_ENABLE_STATS
+	namespace Detail
+	{
+		struct StatsBlock;
+
+		// Every live thread's block, and the counts of the threads that have exited
+		struct StatsRegistry
+		{
+			std::mutex mutex;
+			std::vector<const StatsBlock*> blocks;
+			uint64_t exited[static_cast<size_t>(Stat::Count)] = {};
+		};
+
+		inline StatsRegistry& GetStatsRegistry()
+		{
+			static StatsRegistry registry;
+			return registry;
+		}
+
+		// One thread's counts, only that thread writes them so the increments don't need to be atomic read-modify-writes
+		struct StatsBlock
+		{
+			std::atomic<uint64_t> counts[static_cast<size_t>(Stat::Count)];
+
+			StatsBlock()
+			{
+				for (auto& count : counts)
+					count.store(0, std::memory_order_relaxed);
+
+				StatsRegistry& registry = GetStatsRegistry();
+				std::lock_guard lock{ registry.mutex };
+				registry.blocks.push_back(this);
+			}
+
+			~StatsBlock()
+			{
+				StatsRegistry& registry = GetStatsRegistry();
+				std::lock_guard lock{ registry.mutex };
+				for (size_t i = 0; i < static_cast<size_t>(Stat::Count); ++i)
+					registry.exited[i] += counts[i].load(std::memory_order_relaxed);
+				registry.blocks.erase(std::find(registry.blocks.begin(), registry.blocks.end(), this));
+			}
+
+			StatsBlock(const StatsBlock&) = delete;
+			StatsBlock& operator=(const StatsBlock&) = delete;
+		};
+
+		inline thread_local StatsBlock statsBlock;
+
+		inline void AddStat(Stat stat, uint64_t amount)
+		{
+			std::atomic<uint64_t>& count = statsBlock.counts[static_cast<size_t>(stat)];
+			count.store(count.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+		}
+	}
+#endif // PWM_ENABLE_STATS
+
+	constexpr StatsSnapshot StatsSnapshot::operator-(const StatsSnapshot& earlier) const
+	{
+		StatsSnapshot difference{};
+		for (size_t i = 0; i < static_cast<size_t>(Stat::Count); ++i)
+			difference.counts[i] = counts[i] - earlier.counts[i];
+		return difference;
+	}
+
+	inline StatsSnapshot GetStats()
+	{
+		StatsSnapshot snapshot{};
+
+#if PWM_ENABLE_STATS
+		Detail::StatsRegistry& registry = Detail::GetStatsRegistry();
+		std::lock_guard lock{ registry.mutex };
+		for (size_t i = 0; i < static_cast<size_t>(Stat::Count); ++i)
+		{
+			snapshot.counts[i] = registry.exited[i];
+			for (const Detail::StatsBlock* block : registry.blocks)
+				snapshot.counts[i] += block->counts[i].load(std::memory_order_relaxed);
+		}
+#endif // PWM_ENABLE_STATS
+
+		return snapshot;
+	}
+
+	inline const char* StatName(Stat stat)
+	{
+		switch (stat)
+		{
+		case Stat::Normalize:				return "normalize";
+		case Stat::MatrixMultiply:			return "matrix_multiply";
+		case Stat::MatrixVectorMultiply:	return "matrix_vector_multiply";
+		case Stat::Determinant:				return "determinant";
+		case Stat::Inverse:					return "inverse";
+		case Stat::Translate:				return "translate";
+		case Stat::Scale:					return "scale";
+		case Stat::Rotate:					return "rotate";
+		case Stat::Shear:					return "shear";
+		case Stat::NormalMatrix:			return "normal_matrix";
+		case Stat::ComposeTRS:				return "compose_trs";
+		case Stat::Project:					return "project";
+		case Stat::NormalizeZeroLength:		return "normalize_zero_length";
+		case Stat::SingularDeterminant:		return "singular_determinant";
+		case Stat::SingularInverse:			return "singular_inverse";
+		default:							return "unknown";
+		}
+	}
+}
@@ -1,88 +1,291 @@
 #pragma once
 #include <PWMath/Transform.h>
+#include <PWMath/Scalar.h>
+#include <PWMath/Simd.h>
+#include <PWMath/Stats.h>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace PWMath
 {
+	namespace Detail
+	{
+		// The rotation by the angle with sine s and cosine c about axis (normalized here)
+		template<typename T, PackingMode P>
+		constexpr Matrix3x3<T, P> AxisAngleRotation(T s, T c, const Vector3<T, P>& axis)
+		{
+			const auto u = axis.Normalize();
+			const auto u_1subc = u * (static_cast<T>(1) - c);
+
+			// For more info, see https://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
+			return Matrix3x3<T, P>{
+				c + u[0] * u_1subc[0],		u[0] * u_1subc[1] - u[2] * s,	u[0] * u_1subc[2] + u[1] * s,
+				u[1] * u_1subc[0] + u[2] * s,	c + u[1] * u_1subc[1],		u[1] * u_1subc[2] - u[0] * s,
+				u[2] * u_1subc[0] - u[1] * s,	u[2] * u_1subc[1] + u[0] * s,	c + u[2] * u_1subc[2]
+			};
+		}
+
+		// Lanes version of AxisAngleRotation, m[r][c] is element [r][c] of each of the matrices
+		inline void AxisAngleRotation(Simd::Lanes (&m)[3][3], Simd::Lanes s, Simd::Lanes c, Simd::Lanes x, Simd::Lanes y, Simd::Lanes z)
+		{
+			using Simd::Lanes;
+
+			const Lanes inverseLength = Lanes{ 1.0f } / Sqrt(MulAdd(x, x, MulAdd(y, y, z * z)));
+			x = x * inverseLength;
+			y = y * inverseLength;
+			z = z * inverseLength;
+
+			const Lanes oneSubC = Lanes{ 1.0f } - c;
+			const Lanes xs = x * s, ys = y * s, zs = z * s;
+			const Lanes xy = x * y * oneSubC, xz = x * z * oneSubC, yz = y * z * oneSubC;
+
+			m[0][0] = MulAdd(x * x, oneSubC, c);	m[0][1] = xy - zs;						m[0][2] = xz + ys;
+			m[1][0] = xy + zs;						m[1][1] = MulAdd(y * y, oneSubC, c);	m[1][2] = yz - xs;
+			m[2][0] = xz - ys;						m[2][1] = yz + xs;						m[2][2] = MulAdd(z * z, oneSubC, c);
+		}
+
+		// Calls function(first, n, sines, cosines) for blocks of up to 64 angles, the sines and cosines come from the batch SinCos
+		template<typename T, typename F>
+		void ForEachSinCosBlock(const T* angles, size_t count, F&& function)
+		{
+			constexpr size_t blockSize = 64;
+			T sines[blockSize], cosines[blockSize];
+
+			for (size_t first = 0; first < count; first += blockSize)
+			{
+				const size_t n = std::min(blockSize, count - first);
+				SinCos(sines, cosines, angles + first, n);
+				function(first, n, sines, cosines);
+			}
+		}
+
+		// Writes count axis-angle rotations (3D in 3x3 or 4x4 matrix), the float ones Simd::Lanes::width at a time
+		template<typename T, PackingMode P, typename M>
+		void MakeAxisAngleRotations(M* matrices, const T* angles, Vector3Stream<const T> axes, size_t count)
+		{
+			constexpr bool is4x4 = std::is_same_v<M, Matrix4x4<T, P>>;
+
+			ForEachSinCosBlock(angles, count, [&](size_t first, size_t n, const T* sines, const T* cosines)
+			{
+				size_t j = 0;
+
+				if constexpr (std::is_same_v<T, float>)
+				{
+					using Simd::Lanes;
+					constexpr size_t stride = sizeof(M) / sizeof(T);
+					const Lanes zero{ 0.0f }, one{ 1.0f };
+
+					for (; j + Lanes::width <= n; j += Lanes::width)
+					{
+						const size_t i = first + j;
+						Lanes m[3][3];
+						AxisAngleRotation(m, Lanes::Load(sines + j), Lanes::Load(cosines + j), Lanes::Load(axes.x + i), Lanes::Load(axes.y + i), Lanes::Load(axes.z + i));
+
+						for (size_t r = 0; r < 3; ++r)
+						{
+							for (size_t c = 0; c < 3; ++c)
+								m[r][c].Store(&matrices[i][r][c], stride);
+							if constexpr (is4x4)
+								zero.Store(&matrices[i][r][3], stride);
+						}
+						if constexpr (is4x4)
+						{
+							for (size_t c = 0; c < 3; ++c)
+								zero.Store(&matrices[i][3][c], stride);
+							one.Store(&matrices[i][3][3], stride);
+						}
+					}
+				}
+
+				for (; j < n; ++j)
+				{
+					const size_t i = first + j;
+					const Matrix3x3<T, P> rotation = AxisAngleRotation(sines[j], cosines[j], axes.template Get<P>(i));
+					if constexpr (is4x4)
+					{
+						matrices[i] = Matrix4x4<T, P>{
+							Vector4<T, P>{ rotation[0], static_cast<T>(0) },
+							Vector4<T, P>{ rotation[1], static_cast<T>(0) },
+							Vector4<T, P>{ rotation[2], static_cast<T>(0) },
+							Vector4<T, P>{ static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1) }
+						};
+					}
+					else
+						matrices[i] = rotation;
+				}
+			});
+		}
+
+		// Multiplies count matrices in place by the rotations MakeRotation(rotations, arguments...) makes, in blocks
+		template<typename M, typename T, typename... A>
+		void RotateInBlocks(M* matrices, const T* angles, size_t count, A... axes)
+		{
+			constexpr size_t blockSize = 64;
+			M rotations[blockSize];
+
+			for (size_t first = 0; first < count; first += blockSize)
+			{
+				const size_t n = std::min(blockSize, count - first);
+				if constexpr (sizeof...(A) == 0)
+					MakeRotation(rotations, angles + first, n);
+				else
+					MakeRotation(rotations, angles + first, Vector3Stream<const T>{ axes.x + first, axes.y + first, axes.z + first }..., n);
+
+				for (size_t j = 0; j < n; ++j)
+					matrices[first + j] = matrices[first + j] * rotations[j];
+			}
+		}
+	}
+
 	template<typename T, PackingMode P>
 	constexpr Matrix3x3<T, P> Translate(const Matrix3x3<T, P>& matrix, const Vector2<T, P>& translation)
 	{
-		// Create an identity matrix and fill the bottom row with the translation
-		Matrix3x3<T, P> transform{ 1 };
-		transform[2] = Vector3<T, P>{ translation, static_cast<T>(1) };
-		// Multiply with the previous matrix
-		return matrix * transform;
+		Matrix3x3<T, P> result = matrix;
+		return TranslateInPlace(result, translation);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Translate(const Matrix4x4<T, P>& matrix, const Vector3<T, P>& translation)
 	{
-		// Create an identity matrix and fill the bottom row with the translation
-		Matrix4x4<T, P> transform{ 1 };
-		transform[3] = Vector4<T, P>{ translation, static_cast<T>(1) };
-		// Multiply with the previous matrix
-		return matrix * transform;
+		Matrix4x4<T, P> result = matrix;
+		return TranslateInPlace(result, translation);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& TranslateInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& translation)
+	{
+		// Multiplying by a translation matrix only adds the translation, scaled by the last column, to each row
+		PWM_STATS_COUNT(Translate);
+		const Vector3<T, P> offset{ translation, static_cast<T>(0) };
+		matrix[0] += matrix[0][2] * offset;
+		matrix[1] += matrix[1][2] * offset;
+		matrix[2] += matrix[2][2] * offset;
+		return matrix;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix4x4<T, P>& TranslateInPlace(Matrix4x4<T, P>& matrix, const Vector3<T, P>& translation)
+	{
+		// Multiplying by a translation matrix only adds the translation, scaled by the last column, to each row
+		PWM_STATS_COUNT(Translate);
+		if constexpr (P == PackingMode::Fast && Simd::Row<T>::enabled)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				using Row = Simd::Row<T>;
+				const auto offset = Row::Set(translation.x, translation.y, translation.z, static_cast<T>(0));
+				for (auto& row : matrix.array)
+					Row::Store(row.array, Row::MulAdd(Row::Set(row.w), offset, Row::Load(row.array)));
+				return matrix;
+			}
+		}
+
+		const Vector4<T, P> offset{ translation, static_cast<T>(0) };
+		matrix[0] += matrix[0][3] * offset;
+		matrix[1] += matrix[1][3] * offset;
+		matrix[2] += matrix[2][3] * offset;
+		matrix[3] += matrix[3][3] * offset;
+		return matrix;
 	}
 
 
 	template<typename T, PackingMode P>
 	constexpr Matrix2x2<T, P> Scale(const Matrix2x2<T, P>& matrix, const Vector2<T, P>& scale)
 	{
-		// Create a scale matrix
-		Matrix2x2<T, P> transform{
-			scale.x,	0,
-			0,			scale.y
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix2x2<T, P> result = matrix;
+		return ScaleInPlace(result, scale);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix3x3<T, P> Scale(const Matrix3x3<T, P>& matrix, const Vector2<T, P>& scale)
 	{
-		// Create a scale matrix
-		Matrix3x3<T, P> transform{
-			scale.x,	0,			0,
-			0,			scale.y,	0,
-			0,			0,			1
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix3x3<T, P> result = matrix;
+		return ScaleInPlace(result, scale);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix3x3<T, P> Scale(const Matrix3x3<T, P>& matrix, const Vector3<T, P>& scale)
 	{
-		// Create a scale matrix
-		Matrix3x3<T, P> transform{
-			scale.x,	0,			0,
-			0,			scale.y,	0,
-			0,			0,			scale.z
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix3x3<T, P> result = matrix;
+		return ScaleInPlace(result, scale);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Scale(const Matrix4x4<T, P>& matrix, const Vector3<T, P>& scale)
 	{
-		// Create a scale matrix
-		Matrix4x4<T, P> transform{
-			scale.x,	0,			0,			0,
-			0,			scale.y,	0,			0,
-			0,			0,			scale.z,	0,
-			0,			0,			0,			1
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix4x4<T, P> result = matrix;
+		return ScaleInPlace(result, scale);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix2x2<T, P>& ScaleInPlace(Matrix2x2<T, P>& matrix, const Vector2<T, P>& scale)
+	{
+		// Multiplying by a scale matrix scales the columns, so each row gets multiplied by the scale
+		PWM_STATS_COUNT(Scale);
+		matrix[0] *= scale;
+		matrix[1] *= scale;
+		return matrix;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ScaleInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& scale)
+	{
+		// Multiplying by a scale matrix scales the columns, so each row gets multiplied by the scale
+		PWM_STATS_COUNT(Scale);
+		const Vector3<T, P> factor{ scale, static_cast<T>(1) };
+		matrix[0] *= factor;
+		matrix[1] *= factor;
+		matrix[2] *= factor;
+		return matrix;
 	}
 
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ScaleInPlace(Matrix3x3<T, P>& matrix, const Vector3<T, P>& scale)
+	{
+		// Multiplying by a scale matrix scales the columns, so each row gets multiplied by the scale
+		PWM_STATS_COUNT(Scale);
+		matrix[0] *= scale;
+		matrix[1] *= scale;
+		matrix[2] *= scale;
+		return matrix;
+	}
 
 	template<typename T, PackingMode P>
-	constexpr Matrix2x2<T, P> Rotate(const Matrix2x2<T, P>& matrix, float rotation)
+	constexpr const Matrix4x4<T, P>& ScaleInPlace(Matrix4x4<T, P>& matrix, const Vector3<T, P>& scale)
 	{
-		const auto s = std::sin(rotation), c = std::cos(rotation);
+		// Multiplying by a scale matrix scales the columns, so each row gets multiplied by the scale
+		PWM_STATS_COUNT(Scale);
+		if constexpr (P == PackingMode::Fast && Simd::Row<T>::enabled)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				using Row = Simd::Row<T>;
+				const auto factor = Row::Set(scale.x, scale.y, scale.z, static_cast<T>(1));
+				for (auto& row : matrix.array)
+					Row::Store(row.array, Row::Mul(Row::Load(row.array), factor));
+				return matrix;
+			}
+		}
+
+		const Vector4<T, P> factor{ scale, static_cast<T>(1) };
+		matrix[0] *= factor;
+		matrix[1] *= factor;
+		matrix[2] *= factor;
+		matrix[3] *= factor;
+		return matrix;
+	}
+
+
+	template<typename T, PackingMode P>
+	constexpr Matrix2x2<T, P> Rotate(const Matrix2x2<T, P>& matrix, std::type_identity_t<T> rotation)
+	{
+		PWM_STATS_COUNT(Rotate);
+		T s{}, c{};
+		SinCos(rotation, s, c);
 
 		// Create a rotation matrix
 		Matrix2x2<T, P> transform{
@@ -95,9 +298,11 @@ namespace PWMath
 
 	// Rotates a matrix (2D in 3x3 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, float rotation)
+	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, std::type_identity_t<T> rotation)
 	{
-		const auto s = std::sin(rotation), c = std::cos(rotation);
+		PWM_STATS_COUNT(Rotate);
+		T s{}, c{};
+		SinCos(rotation, s, c);
 
 		// Create a rotation matrix
 		Matrix3x3<T, P> transform{
@@ -110,93 +315,370 @@ namespace PWMath
 	}
 
 	template<typename T, PackingMode P>
-	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, float rotation, const Vector3<T, P>& axis)
+	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, std::type_identity_t<T> rotation, const Vector3<T, P>& axis)
 	{
-		const auto u = axis.Normalize();
-		const auto s = std::sin(rotation), c = std::cos(rotation);
-		const auto u_1subc = u * (1 - c);
+		PWM_STATS_COUNT(Rotate);
+		T s{}, c{};
+		SinCos(rotation, s, c);
 
-		// Create a rotation matrix
-		// For more info, see https://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
-		Matrix3x3<T, P> transform{
-			c + u.x * u_1subc.x,		u.x * u_1subc.y - u.z * s,	u.x * u_1subc.z + u.y * s,
-			u.y * u_1subc.x + u.z * s,	c + u.y * u_1subc.y,		u.y * u_1subc.z - u.x * s,
-			u.z * u_1subc.x - u.y * s,	u.z * u_1subc.y + u.x * s,	c + u.z * u_1subc.z
-		};
 		// Transform matrix
-		return matrix * transform;
+		return matrix * Detail::AxisAngleRotation(s, c, axis);
 	}
 
 	// Rotates a matrix (3D in 4x4 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix4x4<T, P> Rotate(const Matrix4x4<T, P>& matrix, float rotation, const Vector3<T, P>& axis)
+	constexpr Matrix4x4<T, P> Rotate(const Matrix4x4<T, P>& matrix, std::type_identity_t<T> rotation, const Vector3<T, P>& axis)
 	{
-		const auto u = axis.Normalize();
-		const auto s = std::sin(rotation), c = std::cos(rotation);
-		const auto u_1subc = u * (1 - c);
+		PWM_STATS_COUNT(Rotate);
+		T s{}, c{};
+		SinCos(rotation, s, c);
 
 		// Create a rotation matrix
-		// For more info, see https://en.wikipedia.org/wiki/Rotation_matrix#Rotation_matrix_from_axis_and_angle
+		const Matrix3x3<T, P> rotationMatrix = Detail::AxisAngleRotation(s, c, axis);
 		Matrix4x4<T, P> transform{
-			c + u.x * u_1subc.x,		u.x * u_1subc.y - u.z * s,	u.x * u_1subc.z + u.y * s,	0,
-			u.y * u_1subc.x + u.z * s,	c + u.y * u_1subc.y,		u.y * u_1subc.z - u.x * s,	0,
-			u.z * u_1subc.x - u.y * s,	u.z * u_1subc.y + u.x * s,	c + u.z * u_1subc.z,		0,
-			0,							0,							0,							1
+			Vector4<T, P>{ rotationMatrix[0], static_cast<T>(0) },
+			Vector4<T, P>{ rotationMatrix[1], static_cast<T>(0) },
+			Vector4<T, P>{ rotationMatrix[2], static_cast<T>(0) },
+			Vector4<T, P>{ static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1) }
 		};
 		// Transform matrix
 		return matrix * transform;
 	}
 
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix2x2<T, P>* matrices, const T* angles, size_t count)
+	{
+		PWM_STATS_ADD(Rotate, count);
+		Detail::ForEachSinCosBlock(angles, count, [&](size_t first, size_t n, const T* sines, const T* cosines)
+		{
+			for (size_t j = 0; j < n; ++j)
+			{
+				const T s = sines[j], c = cosines[j];
+				matrices[first + j] = Matrix2x2<T, P>{
+					c,-s,
+					s, c
+				};
+			}
+		});
+	}
+
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix3x3<T, P>* matrices, const T* angles, size_t count)
+	{
+		PWM_STATS_ADD(Rotate, count);
+		Detail::ForEachSinCosBlock(angles, count, [&](size_t first, size_t n, const T* sines, const T* cosines)
+		{
+			for (size_t j = 0; j < n; ++j)
+			{
+				const T s = sines[j], c = cosines[j];
+				matrices[first + j] = Matrix3x3<T, P>{
+					c,-s, 0,
+					s, c, 0,
+					0, 0, 1
+				};
+			}
+		});
+	}
+
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix3x3<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count)
+	{
+		PWM_STATS_ADD(Rotate, count);
+		Detail::MakeAxisAngleRotations<T, P>(matrices, angles, axes, count);
+	}
+
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix4x4<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count)
+	{
+		PWM_STATS_ADD(Rotate, count);
+		Detail::MakeAxisAngleRotations<T, P>(matrices, angles, axes, count);
+	}
+
+	template<typename T, PackingMode P>
+	void Rotate(Matrix2x2<T, P>* matrices, const T* angles, size_t count)
+	{
+		Detail::RotateInBlocks(matrices, angles, count);
+	}
+
+	template<typename T, PackingMode P>
+	void Rotate(Matrix3x3<T, P>* matrices, const T* angles, size_t count)
+	{
+		Detail::RotateInBlocks(matrices, angles, count);
+	}
+
+	template<typename T, PackingMode P>
+	void Rotate(Matrix3x3<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count)
+	{
+		Detail::RotateInBlocks(matrices, angles, count, axes);
+	}
+
+	template<typename T, PackingMode P>
+	void Rotate(Matrix4x4<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count)
+	{
+		Detail::RotateInBlocks(matrices, angles, count, axes);
+	}
+
 
 	template<typename T, PackingMode P>
 	constexpr Matrix2x2<T, P> Shear(const Matrix2x2<T, P>& matrix, float xShear, float yShear)
 	{
-		// Create a shear matrix
-		Matrix2x2<T, P> transform{
-			1,		xShear,
-			yShear,	1
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix2x2<T, P> result = matrix;
+		return ShearInPlace(result, xShear, yShear);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix3x3<T, P> Shear(const Matrix3x3<T, P>& matrix, float xShear, float yShear)
 	{
-		// Create a shear matrix
-		Matrix3x3<T, P> transform{
-			1,		xShear,	0,
-			yShear,	1,		0,
-			0,		0,		1
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix3x3<T, P> result = matrix;
+		return ShearInPlace(result, xShear, yShear);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix3x3<T, P> Shear(const Matrix3x3<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear)
 	{
-		// Create a shear matrix
-		Matrix3x3<T, P> transform{
-			1,			xShear.y,	xShear.x,
-			yShear.x,	1,			yShear.y,
-			zShear.x,	zShear.y,	1
-		};
-		// Transform matrix
-		return matrix * transform;
+		Matrix3x3<T, P> result = matrix;
+		return ShearInPlace(result, xShear, yShear, zShear);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Shear(const Matrix4x4<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear)
 	{
-		// Create a shear matrix
-		Matrix4x4<T, P> transform{
-			1,			xShear.y,	xShear.x,	0,
-			yShear.x,	1,			yShear.y,	0,
-			zShear.x,	zShear.y,	1,			0,
-			0,			0,			0,			1
+		Matrix4x4<T, P> result = matrix;
+		return ShearInPlace(result, xShear, yShear, zShear);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix2x2<T, P>& ShearInPlace(Matrix2x2<T, P>& matrix, float xShear, float yShear)
+	{
+		// The diagonal of a shear matrix is all ones, so only the off diagonal terms need to be multiplied
+		PWM_STATS_COUNT(Shear);
+		const T xs = static_cast<T>(xShear), ys = static_cast<T>(yShear);
+		for (auto& row : matrix.array)
+			row = Vector2<T, P>{ row[0] + row[1] * ys, row[0] * xs + row[1] };
+		return matrix;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ShearInPlace(Matrix3x3<T, P>& matrix, float xShear, float yShear)
+	{
+		// The diagonal of a shear matrix is all ones, so only the off diagonal terms need to be multiplied
+		PWM_STATS_COUNT(Shear);
+		const T xs = static_cast<T>(xShear), ys = static_cast<T>(yShear);
+		for (auto& row : matrix.array)
+			row = Vector3<T, P>{ row[0] + row[1] * ys, row[0] * xs + row[1], row[2] };
+		return matrix;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ShearInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear)
+	{
+		// The diagonal of a shear matrix is all ones, so only the off diagonal terms need to be multiplied
+		PWM_STATS_COUNT(Shear);
+		for (auto& row : matrix.array)
+		{
+			row = Vector3<T, P>{
+				row[0] + row[1] * yShear[0] + row[2] * zShear[0],
+				row[0] * xShear[1] + row[1] + row[2] * zShear[1],
+				row[0] * xShear[0] + row[1] * yShear[1] + row[2]
+			};
+		}
+		return matrix;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr const Matrix4x4<T, P>& ShearInPlace(Matrix4x4<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear)
+	{
+		// The diagonal of a shear matrix is all ones, so each row only gets the off diagonal rows of the shear matrix added to it
+		PWM_STATS_COUNT(Shear);
+		if constexpr (P == PackingMode::Fast && Simd::Row<T>::enabled)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				using Row = Simd::Row<T>;
+				const auto xRow = Row::Set(static_cast<T>(0), xShear.y, xShear.x, static_cast<T>(0));
+				const auto yRow = Row::Set(yShear.x, static_cast<T>(0), yShear.y, static_cast<T>(0));
+				const auto zRow = Row::Set(zShear.x, zShear.y, static_cast<T>(0), static_cast<T>(0));
+				for (auto& row : matrix.array)
+				{
+					auto result = Row::MulAdd(Row::Set(row.x), xRow, Row::Load(row.array));
+					result = Row::MulAdd(Row::Set(row.y), yRow, result);
+					result = Row::MulAdd(Row::Set(row.z), zRow, result);
+					Row::Store(row.array, result);
+				}
+				return matrix;
+			}
+		}
+
+		for (auto& row : matrix.array)
+		{
+			row = Vector4<T, P>{
+				row[0] + row[1] * yShear[0] + row[2] * zShear[0],
+				row[0] * xShear[1] + row[1] + row[2] * zShear[1],
+				row[0] * xShear[0] + row[1] * yShear[1] + row[2],
+				row[3]
+			};
+		}
+		return matrix;
+	}
+
+
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> NormalMatrix(const Matrix3x3<T, P>& matrix)
+	{
+		PWM_STATS_COUNT(NormalMatrix);
+
+		// Relative tolerance for the rows being orthogonal and of equal length
+		constexpr T tolerance = std::numeric_limits<T>::epsilon() * 64;
+
+		const T length0 = Length2(matrix[0]), length1 = Length2(matrix[1]), length2 = Length2(matrix[2]);
+		const T error = std::max({
+			Abs(length1 - length0), Abs(length2 - length0),
+			Abs(Dot(matrix[0], matrix[1])), Abs(Dot(matrix[0], matrix[2])), Abs(Dot(matrix[1], matrix[2]))
+		});
+
+		// A rotation with a uniform scale s has an inverse transpose of the matrix over s squared
+		if (error <= tolerance * length0)
+		{
+			PWM_STATS_COUNT_IF(length0 == static_cast<T>(0), SingularInverse);
+			return matrix * (static_cast<T>(1) / length0);
+		}
+
+		// The inverse transpose is the cofactor matrix over the determinant
+		const Matrix3x3<T, P> cofactor = Cofactor(matrix);
+		const T determinant = Dot(matrix[0], cofactor[0]);
+
+		PWM_STATS_COUNT_IF(determinant == static_cast<T>(0), SingularInverse);
+		return cofactor * (static_cast<T>(1) / determinant);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> NormalMatrix(const Matrix4x4<T, P>& matrix)
+	{
+		return NormalMatrix(Matrix3x3<T, P>{ matrix });
+	}
+
+	template<typename T, PackingMode P>
+	void NormalMatrix(Matrix3x3<T, P>* normalMatrices, const Matrix4x4<T, P>* matrices, size_t count)
+	{
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+			constexpr size_t inStride = sizeof(Matrix4x4<T, P>) / sizeof(T), outStride = sizeof(Matrix3x3<T, P>) / sizeof(T);
+			const Lanes tolerance = std::numeric_limits<T>::epsilon() * 64;
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				// Element [r][c] of each of the matrices, one matrix per lane
+				Lanes m[3][3];
+				for (size_t r = 0; r < 3; ++r)
+					for (size_t c = 0; c < 3; ++c)
+						m[r][c] = Lanes::Load(&matrices[i][r][c], inStride);
+
+				Lanes normal[3][3];
+
+				const Lanes length0 = MulAdd(m[0][0], m[0][0], MulAdd(m[0][1], m[0][1], m[0][2] * m[0][2]));
+				const Lanes length1 = MulAdd(m[1][0], m[1][0], MulAdd(m[1][1], m[1][1], m[1][2] * m[1][2]));
+				const Lanes length2 = MulAdd(m[2][0], m[2][0], MulAdd(m[2][1], m[2][1], m[2][2] * m[2][2]));
+				const Lanes dot01 = MulAdd(m[0][0], m[1][0], MulAdd(m[0][1], m[1][1], m[0][2] * m[1][2]));
+				const Lanes dot02 = MulAdd(m[0][0], m[2][0], MulAdd(m[0][1], m[2][1], m[0][2] * m[2][2]));
+				const Lanes dot12 = MulAdd(m[1][0], m[2][0], MulAdd(m[1][1], m[2][1], m[1][2] * m[2][2]));
+				const Lanes error = Max(Max(Abs(length1 - length0), Abs(length2 - length0)), Max(Max(Abs(dot01), Abs(dot02)), Abs(dot12)));
+
+				if ((error <= tolerance * length0).All())
+				{
+					// Every matrix is a rotation with a uniform scale
+					PWM_STATS_ADD(SingularInverse, std::popcount((length0 <= Lanes{ 0.0f }).Bits()));
+					const Lanes scale = Lanes{ 1.0f } / length0;
+					for (size_t r = 0; r < 3; ++r)
+						for (size_t c = 0; c < 3; ++c)
+							normal[r][c] = m[r][c] * scale;
+				}
+				else
+				{
+					// Same as Cofactor, the rows of cofactors are the cross products of the other two rows
+					for (size_t r = 0; r < 3; ++r)
+					{
+						const Lanes(&a)[3] = m[(r + 1) % 3];
+						const Lanes(&b)[3] = m[(r + 2) % 3];
+						normal[r][0] = (a[1] * b[2]) - (a[2] * b[1]);
+						normal[r][1] = (a[2] * b[0]) - (a[0] * b[2]);
+						normal[r][2] = (a[0] * b[1]) - (a[1] * b[0]);
+					}
+
+					const Lanes determinant = MulAdd(m[0][0], normal[0][0], MulAdd(m[0][1], normal[0][1], m[0][2] * normal[0][2]));
+					PWM_STATS_ADD(SingularInverse, std::popcount(((determinant <= Lanes{ 0.0f }) & (determinant >= Lanes{ 0.0f })).Bits()));
+
+					const Lanes scale = Lanes{ 1.0f } / determinant;
+					for (size_t r = 0; r < 3; ++r)
+						for (size_t c = 0; c < 3; ++c)
+							normal[r][c] = normal[r][c] * scale;
+				}
+
+				for (size_t r = 0; r < 3; ++r)
+					for (size_t c = 0; c < 3; ++c)
+						normal[r][c].Store(&normalMatrices[i][r][c], outStride);
+			}
+
+			PWM_STATS_ADD(NormalMatrix, i);
+		}
+
+		for (; i < count; ++i)
+			normalMatrices[i] = NormalMatrix(matrices[i]);
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> ComposeTRS(const Vector2<T, P>& translation, std::type_identity_t<T> rotation, const Vector2<T, P>& scale)
+	{
+		PWM_STATS_COUNT(ComposeTRS);
+		T s{}, c{};
+		SinCos(rotation, s, c);
+
+		// Translation * rotation * scale, the upper 2x2 is the rotation with its columns scaled,
+		// and the bottom row is the translation passed through the scaled rotation
+		return Matrix3x3<T, P>{
+			c * scale[0],										-s * scale[1],										0,
+			s * scale[0],										c * scale[1],										0,
+			(translation[0] * c + translation[1] * s) * scale[0],	(translation[1] * c - translation[0] * s) * scale[1],	1
 		};
-		// Transform matrix
-		return matrix * transform;
+	}
+
+	template<typename T, PackingMode P>
+	constexpr Matrix4x4<T, P> ComposeTRS(const Vector3<T, P>& translation, std::type_identity_t<T> rotation, const Vector3<T, P>& axis, const Vector3<T, P>& scale)
+	{
+		PWM_STATS_COUNT(ComposeTRS);
+		T s{}, c{};
+		SinCos(rotation, s, c);
+
+		// Same rotation as Rotate, with its columns scaled
+		const Matrix3x3<T, P> rotationMatrix = Detail::AxisAngleRotation(s, c, axis);
+		const Vector3<T, P> x = rotationMatrix[0] * scale;
+		const Vector3<T, P> y = rotationMatrix[1] * scale;
+		const Vector3<T, P> z = rotationMatrix[2] * scale;
+
+		// The bottom row is the translation passed through the scaled rotation
+		return Matrix4x4<T, P>{
+			Vector4<T, P>{ x, static_cast<T>(0) },
+			Vector4<T, P>{ y, static_cast<T>(0) },
+			Vector4<T, P>{ z, static_cast<T>(0) },
+			Vector4<T, P>{ (translation[0] * x) + (translation[1] * y) + (translation[2] * z), static_cast<T>(1) }
+		};
+	}
+
+	template<typename T, PackingMode P>
+	void ComposeTRS(Matrix3x3<T, P>* matrices, std::type_identity_t<Vector2Stream<const T>> translations, const T* rotations,
+		std::type_identity_t<Vector2Stream<const T>> scales, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			matrices[i] = ComposeTRS(translations.template Get<P>(i), rotations[i], scales.template Get<P>(i));
+	}
+
+	template<typename T, PackingMode P>
+	void ComposeTRS(Matrix4x4<T, P>* matrices, std::type_identity_t<Vector3Stream<const T>> translations, const T* rotations,
+		std::type_identity_t<Vector3Stream<const T>> axes, std::type_identity_t<Vector3Stream<const T>> scales, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+			matrices[i] = ComposeTRS(translations.template Get<P>(i), rotations[i], axes.template Get<P>(i), scales.template Get<P>(i));
 	}
 }
@@ -0,0 +1,279 @@
+#pragma once
+#include <PWMath/Triangle.h>
+#include <PWMath/Simd.h>
+
+#include <bit>
+#include <cmath>
+#include <utility>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Ray set up for the watertight test: the axes are permuted so the largest direction component is z,
+		// and the shear (sx, sy) maps the direction onto +Z with a scale of sz
+		template<typename T>
+		struct ShearedRay
+		{
+			size_t kx, ky, kz;
+			T sx, sy, sz;
+		};
+
+		template<typename T, PackingMode P>
+		ShearedRay<T> ShearRay(const Ray<T, P>& ray)
+		{
+			const T absX = std::abs(ray.direction.x), absY = std::abs(ray.direction.y), absZ = std::abs(ray.direction.z);
+
+			ShearedRay<T> sheared;
+			sheared.kz = (absX > absY) ? (absX > absZ ? 0 : 2) : (absY > absZ ? 1 : 2);
+			sheared.kx = (sheared.kz + 1) % 3;
+			sheared.ky = (sheared.kx + 1) % 3;
+
+			// Keeps the winding of the triangles when looking down -Z
+			if (ray.direction[sheared.kz] < 0)
+				std::swap(sheared.kx, sheared.ky);
+
+			sheared.sx = ray.direction[sheared.kx] / ray.direction[sheared.kz];
+			sheared.sy = ray.direction[sheared.ky] / ray.direction[sheared.kz];
+			sheared.sz = static_cast<T>(1) / ray.direction[sheared.kz];
+			return sheared;
+		}
+
+		// px * qy - py * qx for the watertight test
+		// Notes:
+		//  - Swapping p and q has to give back exactly the negated value, or a ray could miss both triangles sharing an edge.
+		//    Compilers fusing one of the products into an FMA on their own breaks that
+		//  - Floats are multiplied as doubles, where the products are exact so fusing changes nothing
+		//  - Otherwise both orders are computed and averaged: whichever product gets fused, the two halves swap and the result
+		//    negates exactly. This relies on both halves being fused the same way
+		template<typename T>
+		constexpr T EdgeFunction(T px, T py, T qx, T qy)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				return static_cast<float>(static_cast<double>(px) * qy - static_cast<double>(py) * qx);
+			}
+			else
+			{
+				const T forward = px * qy - py * qx;
+				const T backward = py * qx - px * qy;
+				return (forward - backward) * static_cast<T>(0.5);
+			}
+		}
+
+		// Same as above for floats, so the batch loop and the scalar tail give the same bits
+		inline Simd::Lanes EdgeFunction(Simd::Lanes px, Simd::Lanes py, Simd::Lanes qx, Simd::Lanes qy)
+		{
+			return DifferenceOfProducts(px, qy, py, qx);
+		}
+
+		// Picks the nearest of the lanes set in bits, ties keep the lowest index
+		inline void UpdateNearest(uint32_t bits, Simd::Lanes distance, Simd::Lanes u, Simd::Lanes v, size_t first,
+			bool& found, TriangleHit<float>& hit)
+		{
+			float distances[Simd::Lanes::width], us[Simd::Lanes::width], vs[Simd::Lanes::width];
+			distance.Store(distances);
+			u.Store(us);
+			v.Store(vs);
+
+			for (; bits; bits &= bits - 1)
+			{
+				const size_t lane = static_cast<size_t>(std::countr_zero(bits));
+				if (!found || distances[lane] < hit.distance)
+				{
+					hit = TriangleHit<float>{ distances[lane], us[lane], vs[lane], static_cast<uint32_t>(first + lane) };
+					found = true;
+				}
+			}
+		}
+	}
+
+#pragma region Single tests
+
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const Ray<T, P>& ray, const Vector3<T, P>& vertex0, const Vector3<T, P>& vertex1, const Vector3<T, P>& vertex2,
+		T maxDistance, TriangleHit<T>& hit)
+	{
+		const Vector3<T, P> edge1 = vertex1 - vertex0, edge2 = vertex2 - vertex0;
+
+		// The determinant is 0 when the ray is parallel to the triangle
+		const Vector3<T, P> p = Cross(ray.direction, edge2);
+		const T determinant = Dot(edge1, p);
+		if (determinant == static_cast<T>(0))
+			return false;
+		const T inverseDeterminant = static_cast<T>(1) / determinant;
+
+		const Vector3<T, P> s = ray.origin - vertex0;
+		const T u = Dot(s, p) * inverseDeterminant;
+		if (u < static_cast<T>(0) || u > static_cast<T>(1))
+			return false;
+
+		const Vector3<T, P> q = Cross(s, edge1);
+		const T v = Dot(ray.direction, q) * inverseDeterminant;
+		if (v < static_cast<T>(0) || u + v > static_cast<T>(1))
+			return false;
+
+		const T distance = Dot(edge2, q) * inverseDeterminant;
+		if (distance < static_cast<T>(0) || distance > maxDistance)
+			return false;
+
+		hit = TriangleHit<T>{ distance, u, v, 0 };
+		return true;
+	}
+
+	template<typename T, PackingMode P>
+	bool IntersectsWatertight(const Ray<T, P>& ray, const Vector3<T, P>& vertex0, const Vector3<T, P>& vertex1, const Vector3<T, P>& vertex2,
+		T maxDistance, TriangleHit<T>& hit)
+	{
+		const auto sheared = Detail::ShearRay(ray);
+
+		// Vertices relative to the origin, sheared so the ray is the +Z axis
+		const Vector3<T, P> a = vertex0 - ray.origin, b = vertex1 - ray.origin, c = vertex2 - ray.origin;
+		const T ax = a[sheared.kx] - sheared.sx * a[sheared.kz], ay = a[sheared.ky] - sheared.sy * a[sheared.kz];
+		const T bx = b[sheared.kx] - sheared.sx * b[sheared.kz], by = b[sheared.ky] - sheared.sy * b[sheared.kz];
+		const T cx = c[sheared.kx] - sheared.sx * c[sheared.kz], cy = c[sheared.ky] - sheared.sy * c[sheared.kz];
+
+		// Scaled barycentrics, the origin (where the ray goes) is inside when they all have the same sign.
+		// Being 0 counts as both signs, so edges and vertices are never missed
+		const T u = Detail::EdgeFunction(cx, cy, bx, by), v = Detail::EdgeFunction(ax, ay, cx, cy), w = Detail::EdgeFunction(bx, by, ax, ay);
+		const bool allPositive = u >= static_cast<T>(0) && v >= static_cast<T>(0) && w >= static_cast<T>(0);
+		const bool allNegative = u <= static_cast<T>(0) && v <= static_cast<T>(0) && w <= static_cast<T>(0);
+		if (!allPositive && !allNegative)
+			return false;
+
+		const T determinant = u + v + w;
+		if (determinant == static_cast<T>(0))
+			return false;
+		const T inverseDeterminant = static_cast<T>(1) / determinant;
+
+		const T scaledDistance = u * (sheared.sz * a[sheared.kz]) + v * (sheared.sz * b[sheared.kz]) + w * (sheared.sz * c[sheared.kz]);
+		const T distance = scaledDistance * inverseDeterminant;
+		if (distance < static_cast<T>(0) || distance > maxDistance)
+			return false;
+
+		hit = TriangleHit<T>{ distance, v * inverseDeterminant, w * inverseDeterminant, 0 };
+		return true;
+	}
+
+#pragma endregion
+
+#pragma region Batch tests
+
+	template<typename T, PackingMode P>
+	bool IntersectNearest(const Ray<T, P>& ray, std::type_identity_t<TriangleStream<const T>> triangles, size_t count, T maxDistance, TriangleHit<T>& hit)
+	{
+		bool found = false;
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+
+			const Lanes origin[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+			const Lanes direction[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+			const Lanes zero = 0.0f, one = 1.0f;
+			Lanes nearest = maxDistance;
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes v0x = Lanes::Load(triangles.vertex0.x + i), v0y = Lanes::Load(triangles.vertex0.y + i), v0z = Lanes::Load(triangles.vertex0.z + i);
+				const Lanes e1x = Lanes::Load(triangles.vertex1.x + i) - v0x, e1y = Lanes::Load(triangles.vertex1.y + i) - v0y, e1z = Lanes::Load(triangles.vertex1.z + i) - v0z;
+				const Lanes e2x = Lanes::Load(triangles.vertex2.x + i) - v0x, e2y = Lanes::Load(triangles.vertex2.y + i) - v0y, e2z = Lanes::Load(triangles.vertex2.z + i) - v0z;
+
+				const Lanes px = direction[1] * e2z - direction[2] * e2y, py = direction[2] * e2x - direction[0] * e2z, pz = direction[0] * e2y - direction[1] * e2x;
+				const Lanes determinant = MulAdd(e1x, px, MulAdd(e1y, py, e1z * pz));
+				const Lanes inverseDeterminant = one / determinant;
+
+				const Lanes sx = origin[0] - v0x, sy = origin[1] - v0y, sz = origin[2] - v0z;
+				const Lanes u = MulAdd(sx, px, MulAdd(sy, py, sz * pz)) * inverseDeterminant;
+
+				const Lanes qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+				const Lanes v = MulAdd(direction[0], qx, MulAdd(direction[1], qy, direction[2] * qz)) * inverseDeterminant;
+				const Lanes distance = MulAdd(e2x, qx, MulAdd(e2y, qy, e2z * qz)) * inverseDeterminant;
+
+				const auto hits = ((determinant < zero) | (determinant > zero)) & (u >= zero) & (v >= zero) & (u + v <= one)
+					& (distance >= zero) & (distance <= nearest);
+				if (hits.Any())
+				{
+					Detail::UpdateNearest(hits.Bits(), distance, u, v, i, found, hit);
+					nearest = hit.distance;
+				}
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			TriangleHit<T> candidate;
+			if (Intersects(ray, triangles.vertex0.template Get<P>(i), triangles.vertex1.template Get<P>(i), triangles.vertex2.template Get<P>(i),
+				found ? hit.distance : maxDistance, candidate) && (!found || candidate.distance < hit.distance))
+			{
+				hit = candidate;
+				hit.index = static_cast<uint32_t>(i);
+				found = true;
+			}
+		}
+		return found;
+	}
+
+	template<typename T, PackingMode P>
+	bool IntersectNearestWatertight(const Ray<T, P>& ray, std::type_identity_t<TriangleStream<const T>> triangles, size_t count, T maxDistance, TriangleHit<T>& hit)
+	{
+		bool found = false;
+		size_t i = 0;
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using Simd::Lanes;
+
+			const auto sheared = Detail::ShearRay(ray);
+			const float* vertex0[3] = { triangles.vertex0.x, triangles.vertex0.y, triangles.vertex0.z };
+			const float* vertex1[3] = { triangles.vertex1.x, triangles.vertex1.y, triangles.vertex1.z };
+			const float* vertex2[3] = { triangles.vertex2.x, triangles.vertex2.y, triangles.vertex2.z };
+
+			const Lanes originX = ray.origin[sheared.kx], originY = ray.origin[sheared.ky], originZ = ray.origin[sheared.kz];
+			const Lanes negativeSx = -sheared.sx, negativeSy = -sheared.sy, sz = sheared.sz;
+			const Lanes zero = 0.0f, one = 1.0f;
+			Lanes nearest = maxDistance;
+
+			for (; i + Lanes::width <= count; i += Lanes::width)
+			{
+				const Lanes az = Lanes::Load(vertex0[sheared.kz] + i) - originZ;
+				const Lanes bz = Lanes::Load(vertex1[sheared.kz] + i) - originZ;
+				const Lanes cz = Lanes::Load(vertex2[sheared.kz] + i) - originZ;
+				const Lanes ax = MulAdd(negativeSx, az, Lanes::Load(vertex0[sheared.kx] + i) - originX), ay = MulAdd(negativeSy, az, Lanes::Load(vertex0[sheared.ky] + i) - originY);
+				const Lanes bx = MulAdd(negativeSx, bz, Lanes::Load(vertex1[sheared.kx] + i) - originX), by = MulAdd(negativeSy, bz, Lanes::Load(vertex1[sheared.ky] + i) - originY);
+				const Lanes cx = MulAdd(negativeSx, cz, Lanes::Load(vertex2[sheared.kx] + i) - originX), cy = MulAdd(negativeSy, cz, Lanes::Load(vertex2[sheared.ky] + i) - originY);
+
+				const Lanes u = Detail::EdgeFunction(cx, cy, bx, by), v = Detail::EdgeFunction(ax, ay, cx, cy), w = Detail::EdgeFunction(bx, by, ax, ay);
+				const auto inside = ((u >= zero) & (v >= zero) & (w >= zero)) | ((u <= zero) & (v <= zero) & (w <= zero));
+
+				const Lanes determinant = u + v + w;
+				const Lanes inverseDeterminant = one / determinant;
+				// Summed in the same order as the scalar test
+				const Lanes distance = MulAdd(w, sz * cz, MulAdd(v, sz * bz, u * (sz * az))) * inverseDeterminant;
+
+				const auto hits = inside & ((determinant < zero) | (determinant > zero)) & (distance >= zero) & (distance <= nearest);
+				if (hits.Any())
+				{
+					Detail::UpdateNearest(hits.Bits(), distance, v * inverseDeterminant, w * inverseDeterminant, i, found, hit);
+					nearest = hit.distance;
+				}
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			TriangleHit<T> candidate;
+			if (IntersectsWatertight(ray, triangles.vertex0.template Get<P>(i), triangles.vertex1.template Get<P>(i), triangles.vertex2.template Get<P>(i),
+				found ? hit.distance : maxDistance, candidate) && (!found || candidate.distance < hit.distance))
+			{
+				hit = candidate;
+				hit.index = static_cast<uint32_t>(i);
+				found = true;
+			}
+		}
+		return found;
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,258 @@
+#pragma once
+#include <PWMath/Vector.h>
+#include <PWMath/Simd.h>
+#include <PWMath/Stats.h>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Builds a vector from function(i) for each component index i, expanded at compile time
+		template<typename TVec, typename Function, size_t... I>
+		PWM_FORCEINLINE constexpr TVec MakeVector(Function&& function, std::index_sequence<I...>)
+		{
+			return TVec{ function(I)... };
+		}
+
+		template<typename TVec, typename Function>
+		PWM_FORCEINLINE constexpr TVec MakeVector(Function&& function)
+		{
+			return MakeVector<TVec>(function, std::make_index_sequence<TVec::size>{});
+		}
+
+		// Sum of function(i) for i in [0, L), expanded at compile time
+		template<typename Function, size_t... I>
+		PWM_FORCEINLINE constexpr auto Sum(Function&& function, std::index_sequence<I...>)
+		{
+			return (function(I) + ...);
+		}
+
+		template<size_t L, typename Function>
+		PWM_FORCEINLINE constexpr auto Sum(Function&& function)
+		{
+			return Sum(function, std::make_index_sequence<L>{});
+		}
+
+		template<size_t... I, typename T, size_t L, PackingMode P>
+		constexpr Vector<T, sizeof...(I), P> Swizzle(const Vector<T, L, P>& vector)
+		{
+			static_assert(sizeof...(I) > 0, "Swizzle needs at least one index");
+			static_assert(((I < L) && ...), "Swizzle index out of range");
+
+			if constexpr (P == PackingMode::Fast && L == 4 && sizeof...(I) == 4 && Simd::Row<T>::enabled)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					using Row = Simd::Row<T>;
+					Vector<T, 4, P> result;
+					Row::Store(result.array, Row::template Shuffle<I...>(Row::Load(vector.array)));
+					return result;
+				}
+			}
+
+			return Vector<T, sizeof...(I), P>{ vector[I]... };
+		}
+	}
+
+#pragma region Unary operators
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& vector) noexcept
+	{
+		return vector;
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& vector) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return -vector[i]; });
+	}
+
+#pragma endregion
+
+#pragma region Vector and scalar
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] + rhs; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] - rhs; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(const Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] * rhs; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(const Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] / rhs; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator+=(Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return lhs = (lhs + rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator-=(Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return lhs = (lhs - rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator*=(Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return lhs = (lhs * rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator/=(Vector<T, L, P>& lhs, T rhs) noexcept
+	{
+		return lhs = (lhs / rhs);
+	}
+
+#pragma endregion
+
+#pragma region Vector and vector
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] + rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] - rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] * rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs[i] / rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator+=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return lhs = (lhs + rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator-=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return lhs = (lhs - rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator*=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return lhs = (lhs * rhs);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator/=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return lhs = (lhs / rhs);
+	}
+
+#pragma endregion
+
+#pragma region Scalar and vector
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(T lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs + rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(T lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs - rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(T lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs * rhs[i]; });
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(T lhs, const Vector<T, L, P>& rhs) noexcept
+	{
+		return Detail::MakeVector<Vector<T, L, P>>([&](size_t i) { return lhs / rhs[i]; });
+	}
+
+#pragma endregion
+
+#pragma region Other functions
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Length(const Vector<T, L, P>& vector)
+	{
+		return Sqrt(Length2(vector));
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Length2(const Vector<T, L, P>& vector)
+	{
+		return Dot(vector, vector);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> Normalize(const Vector<T, L, P>& vector)
+	{
+		PWM_STATS_COUNT(Normalize);
+		PWM_STATS_COUNT_IF(Length2(vector) == static_cast<T>(0), NormalizeZeroLength);
+		return vector / Length(vector);
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Dot(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs)
+	{
+		return static_cast<T>(Detail::Sum<L>([&](size_t i) { return lhs[i] * rhs[i]; }));
+	}
+
+#pragma endregion
+
+#pragma region Member versions of functions
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Vector<T, L, P>::Length() const { return PWMath::Length(*this); }
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Vector<T, L, P>::Length2() const { return PWMath::Length2(*this); }
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> Vector<T, L, P>::Normalize() const { return PWMath::Normalize(*this); }
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Vector<T, L, P>::Dot(const Vector<T, L, P>& rhs) const { return PWMath::Dot(*this, rhs); }
+
+	template<typename T, size_t L, PackingMode P>
+	template<size_t... I>
+	constexpr Vector<T, sizeof...(I), P> Vector<T, L, P>::Swizzle() const { return Detail::Swizzle<I...>(*this); }
+
+	template<typename T, size_t L, PackingMode P>
+	template<size_t... I>
+	constexpr Detail::SwizzleProxy<Vector<T, L, P>, I...> Vector<T, L, P>::SwizzleRef() { return { *this }; }
+
+#pragma endregion
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <PWMath/Vector3.h>
+#include <PWMath/Stats.h>
 
 namespace PWMath
 {
@@ -14,7 +15,7 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> operator-(const Vector<T, 3, P>& vector) noexcept
 	{
-		return Vector<T, 3, P>{ -vector.x, -vector.y, -vector.z };
+		return Vector<T, 3, P>{ -vector[0], -vector[1], -vector[2] };
 	}
 
 #pragma endregion
@@ -76,25 +77,25 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> operator+(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs) noexcept
 	{
-		return Vector<T, 3, P>{ lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z };
+		return Vector<T, 3, P>{ lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> operator-(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs) noexcept
 	{
-		return Vector<T, 3, P>{ lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z };
+		return Vector<T, 3, P>{ lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> operator*(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs) noexcept
 	{
-		return Vector<T, 3, P>{ lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z };
+		return Vector<T, 3, P>{ lhs[0] * rhs[0], lhs[1] * rhs[1], lhs[2] * rhs[2] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> operator/(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs) noexcept
 	{
-		return Vector<T, 3, P>{ lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z };
+		return Vector<T, 3, P>{ lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2] };
 	}
 
 	template<typename T, PackingMode P>
@@ -156,31 +157,33 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr T Length(const Vector<T, 3, P>& vector)
 	{
-		return std::sqrt(Length2(vector));
+		return Sqrt(Length2(vector));
 	}
 
 	template<typename T, PackingMode P>
 	constexpr T Length2(const Vector<T, 3, P>& vector)
 	{
-		return (vector.x * vector.x) + (vector.y * vector.y) + (vector.z * vector.z);
+		return (vector[0] * vector[0]) + (vector[1] * vector[1]) + (vector[2] * vector[2]);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> Normalize(const Vector<T, 3, P>& vector)
 	{
+		PWM_STATS_COUNT(Normalize);
+		PWM_STATS_COUNT_IF(Length2(vector) == static_cast<T>(0), NormalizeZeroLength);
 		return vector / Length(vector);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr T Dot(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs)
 	{
-		return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z);
+		return (lhs[0] * rhs[0]) + (lhs[1] * rhs[1]) + (lhs[2] * rhs[2]);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> Cross(const Vector<T, 3, P>& lhs, const Vector<T, 3, P>& rhs)
 	{
-		return Vector<T, 3, P>{ lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.z };
+		return Vector<T, 3, P>{ lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2], lhs[0] * rhs[1] - lhs[1] * rhs[0] };
 	}
 
 #pragma endregion
@@ -202,5 +205,13 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 3, P> Vector<T, 3, P>::Cross(const Vector<T, 3, P>& rhs) const { return PWMath::Cross(*this, rhs); }
 
+	template<typename T, PackingMode P>
+	template<size_t... I>
+	constexpr Vector<T, sizeof...(I), P> Vector<T, 3, P>::Swizzle() const { return Detail::Swizzle<I...>(*this); }
+
+	template<typename T, PackingMode P>
+	template<size_t... I>
+	constexpr Detail::SwizzleProxy<Vector<T, 3, P>, I...> Vector<T, 3, P>::SwizzleRef() { return { *this }; }
+
 #pragma endregion
 }
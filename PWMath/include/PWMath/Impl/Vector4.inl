@@ -1,5 +1,6 @@
 #pragma once
 #include <PWMath/Vector4.h>
+#include <PWMath/Stats.h>
 
 namespace PWMath
 {
@@ -14,7 +15,7 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> operator-(const Vector<T, 4, P>& vector) noexcept
 	{
-		return Vector<T, 4, P>{ -vector.x, -vector.y, -vector.z, -vector.w };
+		return Vector<T, 4, P>{ -vector[0], -vector[1], -vector[2], -vector[3] };
 	}
 
 #pragma endregion
@@ -76,25 +77,25 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> operator+(const Vector<T, 4, P>& lhs, const Vector<T, 4, P>& rhs) noexcept
 	{
-		return Vector<T, 4, P>{ lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w };
+		return Vector<T, 4, P>{ lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> operator-(const Vector<T, 4, P>& lhs, const Vector<T, 4, P>& rhs) noexcept
 	{
-		return Vector<T, 4, P>{ lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w };
+		return Vector<T, 4, P>{ lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> operator*(const Vector<T, 4, P>& lhs, const Vector<T, 4, P>& rhs) noexcept
 	{
-		return Vector<T, 4, P>{ lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w };
+		return Vector<T, 4, P>{ lhs[0] * rhs[0], lhs[1] * rhs[1], lhs[2] * rhs[2], lhs[3] * rhs[3] };
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> operator/(const Vector<T, 4, P>& lhs, const Vector<T, 4, P>& rhs) noexcept
 	{
-		return Vector<T, 4, P>{ lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w };
+		return Vector<T, 4, P>{ lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2], lhs[3] / rhs[3] };
 	}
 
 	template<typename T, PackingMode P>
@@ -156,25 +157,27 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr T Length(const Vector<T, 4, P>& vector)
 	{
-		return std::sqrt(Length2(vector));
+		return Sqrt(Length2(vector));
 	}
 
 	template<typename T, PackingMode P>
 	constexpr T Length2(const Vector<T, 4, P>& vector)
 	{
-		return (vector.x * vector.x) + (vector.y * vector.y) + (vector.z * vector.z) + (vector.w * vector.w);
+		return (vector[0] * vector[0]) + (vector[1] * vector[1]) + (vector[2] * vector[2]) + (vector[3] * vector[3]);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr Vector<T, 4, P> Normalize(const Vector<T, 4, P>& vector)
 	{
+		PWM_STATS_COUNT(Normalize);
+		PWM_STATS_COUNT_IF(Length2(vector) == static_cast<T>(0), NormalizeZeroLength);
 		return vector / Length(vector);
 	}
 
 	template<typename T, PackingMode P>
 	constexpr T Dot(const Vector<T, 4, P>& lhs, const Vector<T, 4, P>& rhs)
 	{
-		return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z) + (lhs.w * rhs.w);
+		return (lhs[0] * rhs[0]) + (lhs[1] * rhs[1]) + (lhs[2] * rhs[2]) + (lhs[3] * rhs[3]);
 	}
 
 #pragma endregion
@@ -193,5 +196,13 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr T Vector<T, 4, P>::Dot(const Vector<T, 4, P>& rhs) const { return PWMath::Dot(*this, rhs); }
 
+	template<typename T, PackingMode P>
+	template<size_t... I>
+	constexpr Vector<T, sizeof...(I), P> Vector<T, 4, P>::Swizzle() const { return Detail::Swizzle<I...>(*this); }
+
+	template<typename T, PackingMode P>
+	template<size_t... I>
+	constexpr Detail::SwizzleProxy<Vector<T, 4, P>, I...> Vector<T, 4, P>::SwizzleRef() { return { *this }; }
+
 #pragma endregion
 }
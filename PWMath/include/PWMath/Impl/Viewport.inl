@@ -0,0 +1,167 @@
+#pragma once
+#include <PWMath/Viewport.h>
+#include <PWMath/Simd.h>
+#include <PWMath/Stream.h>
+
+#include <type_traits>
+
+namespace PWMath
+{
+	namespace Detail
+	{
+		// Maps normalized device coordinates to the screen as ndc * scale + offset
+		template<typename T>
+		struct ScreenMapping
+		{
+			T scale[3], offset[3];
+			// A point is in front of the near plane when z + nearW * w >= 0
+			T nearW;
+		};
+
+		template<typename T>
+		ScreenMapping<T> MakeScreenMapping(const Viewport<T>& viewport, bool gl)
+		{
+			const T half = static_cast<T>(0.5);
+
+			ScreenMapping<T> mapping;
+			mapping.scale[0] = viewport.width * half;
+			mapping.offset[0] = viewport.x + viewport.width * half;
+			mapping.scale[1] = gl ? viewport.height * half : -viewport.height * half;
+			mapping.offset[1] = viewport.y + viewport.height * half;
+			if (gl)
+			{
+				mapping.scale[2] = (viewport.maxDepth - viewport.minDepth) * half;
+				mapping.offset[2] = (viewport.maxDepth + viewport.minDepth) * half;
+				mapping.nearW = static_cast<T>(1);
+			}
+			else
+			{
+				mapping.scale[2] = viewport.maxDepth - viewport.minDepth;
+				mapping.offset[2] = viewport.minDepth;
+				mapping.nearW = static_cast<T>(0);
+			}
+			return mapping;
+		}
+
+		template<typename T, PackingMode P>
+		uint8_t ClipFlags(const Vector4<T, P>& clip, T nearW)
+		{
+			return static_cast<uint8_t>((clip.x < -clip.w ? ClipFlag(FrustumPlane::Left) : 0) | (clip.x > clip.w ? ClipFlag(FrustumPlane::Right) : 0)
+				| (clip.y < -clip.w ? ClipFlag(FrustumPlane::Bottom) : 0) | (clip.y > clip.w ? ClipFlag(FrustumPlane::Top) : 0)
+				| (clip.z + nearW * clip.w < static_cast<T>(0) ? ClipFlag(FrustumPlane::Near) : 0) | (clip.z > clip.w ? ClipFlag(FrustumPlane::Far) : 0));
+		}
+
+		// Projects Vector3 (w of 1) or Vector4 points in one pass
+		template<typename T, PackingMode P, size_t L>
+		void ProjectToScreen(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const ScreenMapping<T>& mapping,
+			const Vector<T, L, P>* points, size_t count)
+		{
+			size_t i = 0;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				using Simd::Lanes;
+
+				Lanes matrix[4][4];
+				for (size_t r = 0; r < 4; ++r)
+					for (size_t c = 0; c < 4; ++c)
+						matrix[r][c] = viewProjection[r][c];
+
+				const Lanes scale[3] = { mapping.scale[0], mapping.scale[1], mapping.scale[2] };
+				const Lanes offset[3] = { mapping.offset[0], mapping.offset[1], mapping.offset[2] };
+				const Lanes nearW = mapping.nearW, zero = 0.0f;
+
+				for (; i + Lanes::width <= count; i += Lanes::width)
+				{
+					// Points are row vectors, clip coordinate c is the dot product with column c
+					Lanes point[4], clip[4];
+					if constexpr (L == 3)
+					{
+						LoadVectors(points + i, point[0], point[1], point[2]);
+						for (size_t c = 0; c < 4; ++c)
+							clip[c] = matrix[3][c];
+					}
+					else
+					{
+						constexpr size_t stride = sizeof(Vector<T, L, P>) / sizeof(T);
+						for (size_t r = 0; r < 4; ++r)
+							point[r] = Lanes::Load(points[i].array + r, stride);
+						for (size_t c = 0; c < 4; ++c)
+							clip[c] = point[3] * matrix[3][c];
+					}
+
+					for (size_t r = 0; r < 3; ++r)
+						for (size_t c = 0; c < 4; ++c)
+							clip[c] = MulAdd(point[r], matrix[r][c], clip[c]);
+
+					if (clipFlags)
+					{
+						// The flags are summed as floats, powers of 2 below 64 add up exactly
+						const Lanes negativeW = -clip[3];
+						const Lanes flags = Select(clip[0] < negativeW, static_cast<float>(ClipFlag(FrustumPlane::Left)), zero)
+							+ Select(clip[0] > clip[3], static_cast<float>(ClipFlag(FrustumPlane::Right)), zero)
+							+ Select(clip[1] < negativeW, static_cast<float>(ClipFlag(FrustumPlane::Bottom)), zero)
+							+ Select(clip[1] > clip[3], static_cast<float>(ClipFlag(FrustumPlane::Top)), zero)
+							+ Select(MulAdd(nearW, clip[3], clip[2]) < zero, static_cast<float>(ClipFlag(FrustumPlane::Near)), zero)
+							+ Select(clip[2] > clip[3], static_cast<float>(ClipFlag(FrustumPlane::Far)), zero);
+
+						float values[Lanes::width];
+						flags.Store(values);
+						for (size_t lane = 0; lane < Lanes::width; ++lane)
+							clipFlags[i + lane] = static_cast<uint8_t>(values[lane]);
+					}
+
+					const Lanes inverseW = Reciprocal(clip[3]);
+					StoreVectors(screenPoints + i, MulAdd(clip[0] * inverseW, scale[0], offset[0]), MulAdd(clip[1] * inverseW, scale[1], offset[1]),
+						MulAdd(clip[2] * inverseW, scale[2], offset[2]));
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				Vector<T, 4, P> point;
+				if constexpr (L == 3)
+					point = Vector<T, 4, P>{ points[i].x, points[i].y, points[i].z, static_cast<T>(1) };
+				else
+					point = points[i];
+
+				const Vector<T, 4, P> clip = point * viewProjection;
+				if (clipFlags)
+					clipFlags[i] = ClipFlags(clip, mapping.nearW);
+
+				const T inverseW = static_cast<T>(1) / clip.w;
+				screenPoints[i] = Vector3<T, P>{
+					clip.x * inverseW * mapping.scale[0] + mapping.offset[0], clip.y * inverseW * mapping.scale[1] + mapping.offset[1], clip.z * inverseW * mapping.scale[2] + mapping.offset[2]
+				};
+			}
+		}
+	}
+
+	template<typename T, PackingMode P>
+	void ProjectToScreen(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector3<T, P>* points, size_t count)
+	{
+		Detail::ProjectToScreen(screenPoints, clipFlags, viewProjection, Detail::MakeScreenMapping(viewport, false), points, count);
+	}
+
+	template<typename T, PackingMode P>
+	void ProjectToScreen(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector4<T, P>* points, size_t count)
+	{
+		Detail::ProjectToScreen(screenPoints, clipFlags, viewProjection, Detail::MakeScreenMapping(viewport, false), points, count);
+	}
+
+	template<typename T, PackingMode P>
+	void ProjectToScreenGL(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector3<T, P>* points, size_t count)
+	{
+		Detail::ProjectToScreen(screenPoints, clipFlags, viewProjection, Detail::MakeScreenMapping(viewport, true), points, count);
+	}
+
+	template<typename T, PackingMode P>
+	void ProjectToScreenGL(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector4<T, P>* points, size_t count)
+	{
+		Detail::ProjectToScreen(screenPoints, clipFlags, viewProjection, Detail::MakeScreenMapping(viewport, true), points, count);
+	}
+}
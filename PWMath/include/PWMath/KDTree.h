@@ -0,0 +1,90 @@
+#pragma once
+#include <PWMath/Vector2.h>
+#include <PWMath/Vector3.h>
+#include <PWMath/Simd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace PWMath
+{
+	// k-d tree over a static set of 2D or 3D points
+	// Notes:
+	//  - Balanced and stored implicitly: internal node i has children 2i + 1 and 2i + 2, the last leafCount nodes are the leaves
+	//  - Each node splits its range of points in half, so the point range of a node is found while walking down from the root
+	//  - The points are copied in tree order as SoA arrays, each leaf is a contiguous range of at most leafSize points tested Simd::Lanes::width at a time
+	template<typename T, size_t N, PackingMode P = PackingMode::Default>
+	struct KDTree
+	{
+		static_assert(N == 2 || N == 3, "KDTree only supports 2D and 3D points");
+
+		using Type = T;
+		using VectorType = Vector<T, N, P>;
+		static constexpr size_t dimensions = N;
+		static constexpr PackingMode packingMode = P;
+
+		// Two groups of lanes per leaf, at least 8 points
+		static constexpr size_t leafSize = 2 * Simd::Lanes::width < 8 ? 8 : 2 * Simd::Lanes::width;
+
+		// Split of each internal node: points of the first child are <= splitValues[i] on splitAxes[i], points of the second are >=
+		std::vector<T> splitValues;
+		std::vector<uint8_t> splitAxes;
+		// Point positions in tree order
+		std::vector<T> coordinates[N];
+		// Index of each point in tree order in the points given to BuildKDTree
+		std::vector<uint32_t> pointIndices;
+
+		size_t InternalNodeCount() const { return splitValues.size(); }
+		size_t LeafCount() const { return splitValues.size() + 1; }
+		size_t PointCount() const { return pointIndices.size(); }
+	};
+
+	// Builds a k-d tree over count points, splitting each node at the median of its widest axis
+	// Notes:
+	//  - Large subtrees are built on their own threads, they write to separate parts of the arrays so nothing is merged afterwards
+	//  - At most HardwareThreadCount() subtrees are built at once
+	template<typename T, size_t N, PackingMode P>
+	KDTree<T, N, P> BuildKDTree(const Vector<T, N, P>* points, size_t count);
+
+	// Finds the k points nearest to point, up to maxDistance away
+	// Notes:
+	//  - indices and distances2 must have room for k values, they are written nearest first and the amount written is returned
+	//  - The indices index the points given to BuildKDTree, distances2 are squared distances
+	template<typename T, size_t N, PackingMode P>
+	size_t QueryNearest(const KDTree<T, N, P>& tree, const Vector<T, N, P>& point, size_t k, std::type_identity_t<T> maxDistance, uint32_t* indices, T* distances2);
+
+	// Finds the k points nearest to each of count points, up to maxDistance away
+	// Notes:
+	//  - The results of query q are written to indices[q * k] and distances2[q * k] onwards, their amount to counts[q]
+	//  - Large batches are split over all cores
+	template<typename T, size_t N, PackingMode P>
+	void QueryNearest(const KDTree<T, N, P>& tree, const Vector<T, N, P>* points, size_t count, size_t k, std::type_identity_t<T> maxDistance,
+		uint32_t* indices, T* distances2, uint32_t* counts);
+
+	// Calls callback(pointIndex, distance2) for every point within radius of center (on the surface counts)
+	// Notes:
+	//  - The points come in tree order, not by distance
+	template<typename T, size_t N, PackingMode P, typename Callback>
+	void QueryRadius(const KDTree<T, N, P>& tree, const Vector<T, N, P>& center, std::type_identity_t<T> radius, Callback&& callback);
+
+	// Calls callback(queryIndex, pointIndex, distance2) for every point within radius of each of count centers
+	// Notes:
+	//  - Large batches are split over all cores, the callback is then called from several threads at once
+	//  - The calls for one query are made in a row from one thread
+	template<typename T, size_t N, PackingMode P, typename Callback>
+	void QueryRadius(const KDTree<T, N, P>& tree, const Vector<T, N, P>* centers, size_t count, std::type_identity_t<T> radius, Callback&& callback);
+
+	template<typename T, PackingMode P = PackingMode::Default>
+	using KDTree2 = KDTree<T, 2, P>;
+	template<typename T, PackingMode P = PackingMode::Default>
+	using KDTree3 = KDTree<T, 3, P>;
+
+	using KDTree2F32 = KDTree2<float>;
+	using KDTree2F64 = KDTree2<double>;
+	using KDTree3F32 = KDTree3<float>;
+	using KDTree3F64 = KDTree3<double>;
+}
+
+#include <PWMath/Impl/KDTree.inl>
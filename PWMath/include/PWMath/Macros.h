@@ -9,6 +9,21 @@
 #define PWM_USE_SSE2 1
 #endif // PW_ARCH_X64
 
+// AVX-512 (F, VL, BW and DQ) implies AVX2 support
+#if PWM_USE_AVX512 & !defined(PWM_USE_AVX2)
+#define PWM_USE_AVX2 1
+#endif // PWM_USE_AVX512
+
+// AVX2 implies FMA3 support (every AVX2 processor has it)
+#if PWM_USE_AVX2 & !defined(PWM_USE_FMA)
+#define PWM_USE_FMA 1
+#endif // PWM_USE_AVX2
+
+// AVX2 implies F16C support (every AVX2 processor has it)
+#if PWM_USE_AVX2 & !defined(PWM_USE_F16C)
+#define PWM_USE_F16C 1
+#endif // PWM_USE_AVX2
+
 // AVX2 implies AVX support
 #if PWM_USE_AVX2 & !defined(PWM_USE_AVX)
 #define PWM_USE_AVX 1
@@ -39,3 +54,17 @@
 #define PWM_USE_SSE 1
 #endif // PWM_USE_AVX2
 
+/////////////////////////////
+// -=- Compiler Macros -=- //
+/////////////////////////////
+
+// Forces inlining of the small helpers the compile time unrolling is built from
+// Notes:
+//  - Without it GCC stops inlining the larger expansions (ex: 6x6 matrix multiplication) and calls them per row
+#if defined(_MSC_VER)
+#define PWM_FORCEINLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define PWM_FORCEINLINE inline __attribute__((always_inline))
+#else
+#define PWM_FORCEINLINE inline
+#endif
@@ -1,9 +1,140 @@
 #pragma once
 #include <PWMath/Packing.h>
+#include <PWMath/Vector.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace PWMath
 {
-	// Template base type for vector
+	// Template base type for matrix
+	// Notes:
+	//  - Used for the sizes without a specialization (2x2, 3x3 and 4x4 have one), including the rectangular ones
+	//  - C is the number of columns and R the number of rows, the matrix is stored as R rows of C columns
+	//  - The operators are unrolled at compile time, there are no loops over the rows or columns
 	template<typename T, size_t C, size_t R, PackingMode P = PackingMode::Default>
-	struct Matrix {};
+	struct Matrix
+	{
+		static_assert(C > 0 && R > 0, "Matrix needs at least one row and column");
+
+		using Type = T;
+		using ColumnType = Vector<T, R, P>;
+		using RowType = Vector<T, C, P>;
+		using TransposeType = Matrix<T, R, C, P>;
+		static constexpr size_t colomns = C;
+		static constexpr size_t rows = R;
+		static constexpr PackingMode packingMode = P;
+
+		RowType array[R];
+
+		// Default constructors
+		Matrix() = default;
+		Matrix(const Matrix&) = default;
+		~Matrix() = default;
+
+		// Special constructors
+		// NOTE: Sets the diagonal, the rest is zero
+		template<typename TVal> requires std::is_convertible_v<TVal, T>
+		constexpr Matrix(TVal identityVal)
+			:Matrix([&](size_t r) { return Detail::MakeVector<RowType>([&](size_t c) { return static_cast<T>(r == c ? static_cast<T>(identityVal) : static_cast<T>(0)); }); },
+				std::make_index_sequence<R>{})
+		{}
+
+		// NOTE: Each parameter is a row
+		template<typename... TRows> requires (sizeof...(TRows) == R && ((Detail::vectorSize<TRows> == C) && ...))
+		constexpr Matrix(const TRows&... rows)
+			:array{ RowType{ rows }... }
+		{}
+
+		template<typename TMat, PackingMode PMat>
+		constexpr Matrix(const Matrix<TMat, C, R, PMat>& matrix)
+			:Matrix([&](size_t r) { return RowType{ matrix[r] }; }, std::make_index_sequence<R>{})
+		{}
+
+		// NOTE: Row major ordering
+		template<typename... TVals> requires (sizeof...(TVals) == C * R && C * R > 1 && (std::is_convertible_v<TVals, T> && ...))
+		constexpr Matrix(TVals... values)
+			:Matrix(std::type_identity_t<const T[C * R]>{ static_cast<T>(values)... })
+		{}
+
+		// NOTE: Row major ordering
+		template<typename TArr>
+		constexpr Matrix(TArr(&vals)[C * R])
+			:Matrix([&](size_t r) { return Detail::MakeVector<RowType>([&](size_t c) { return static_cast<T>(vals[r * C + c]); }); }, std::make_index_sequence<R>{})
+		{}
+
+		constexpr RowType GetRow(size_t index) const { return array[index]; }
+		constexpr ColumnType GetColumn(size_t index) const { return Detail::MakeVector<ColumnType>([&](size_t r) { return array[r][index]; }); }
+
+		constexpr RowType& operator[](size_t index) { return array[index]; }
+		constexpr const RowType& operator[](size_t index) const { return array[index]; }
+
+		Matrix& operator=(const Matrix&) = default;
+
+		constexpr bool operator==(const Matrix& rhs) const = default;
+
+		constexpr TransposeType Transpose() const;
+
+	private:
+		// Sets row r to function(r), expanded at compile time
+		template<typename Function, size_t... I>
+		constexpr Matrix(Function&& function, std::index_sequence<I...>)
+			:array{ function(I)... }
+		{}
+	};
+
+	// Unary plus and minus
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator+(const Matrix<T, C, R, P>& rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator-(const Matrix<T, C, R, P>& rhs);
+
+	// Addition and substraction
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator+(const Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator-(const Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator+=(Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator-=(Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs);
+
+	// Matrix-scalar multiplication
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(const Matrix<T, C, R, P>& lhs, T rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr const Matrix<T, C, R, P>& operator*=(Matrix<T, C, R, P>& lhs, T rhs);
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(T lhs, const Matrix<T, C, R, P>& rhs);
+
+	// Matrix multiplication, an R x N matrix (N columns, R rows) times an N x C one is R x C
+	// Notes:
+	//  - Also used when only one side is a specialization (ex: Matrix<T, 4, 3> * Matrix4x4<T>)
+	template<typename T, size_t C, size_t N, size_t R, PackingMode P>
+	constexpr Matrix<T, C, R, P> operator*(const Matrix<T, N, R, P>& lhs, const Matrix<T, C, N, P>& rhs);
+	template<typename T, size_t C, PackingMode P>
+	constexpr const Matrix<T, C, C, P>& operator*=(Matrix<T, C, C, P>& lhs, const Matrix<T, C, C, P>& rhs);
+
+	// Matrix-vector multiplication
+	// Notes:
+	//  - The matrix times a column vector of C components is a column vector of R components
+	//  - A row vector of R components times the matrix is a row vector of C components
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Vector<T, R, P> operator*(const Matrix<T, C, R, P>& lhs, const Vector<T, C, P>& rhs);
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Vector<T, C, P> operator*(const Vector<T, R, P>& lhs, const Matrix<T, C, R, P>& rhs);
+	template<typename T, size_t C, PackingMode P>
+	constexpr const Vector<T, C, P>& operator*=(Vector<T, C, P>& lhs, const Matrix<T, C, C, P>& rhs);
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr Matrix<T, R, C, P> Transpose(const Matrix<T, C, R, P>& matrix);
 }
+
+#include <PWMath/Impl/Matrix.inl>
+
+// The specializations have to be seen before any of their sizes is used, or the generic version would be instantiated instead
+#include <PWMath/Matrix2x2.h>
+#include <PWMath/Matrix3x3.h>
+#include <PWMath/Matrix4x4.h>
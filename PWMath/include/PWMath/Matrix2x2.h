@@ -35,7 +35,7 @@ namespace PWMath
 
 		// Special constructors
 		template<typename TVal>
-		Matrix(TVal identityVal)
+		constexpr Matrix(TVal identityVal)
 			:array{
 				{ static_cast<T>(identityVal), static_cast<T>(0) },
 				{ static_cast<T>(0), static_cast<T>(identityVal) } }
@@ -43,12 +43,12 @@ namespace PWMath
 
 		// NOTE: Each parameter is a row
 		template<typename TX, typename TY, PackingMode PX, PackingMode PY>
-		Matrix(Vector2<TX, PX> x, Vector2<TY, PY> y)
+		constexpr Matrix(Vector2<TX, PX> x, Vector2<TY, PY> y)
 			:array{ Vector2<T, P>{ x }, Vector2<T, P>{ y } }
 		{}
 
 		template<typename TMat, PackingMode PMat>
-		Matrix(Matrix<TMat, 2, 2, PMat> matrix)
+		constexpr Matrix(Matrix<TMat, 2, 2, PMat> matrix)
 			: array{ Vector2<T, P>{ matrix[0] }, Vector2<T, P>{ matrix[1] } }
 		{}
 
@@ -56,7 +56,7 @@ namespace PWMath
 		template<
 			typename T00, typename T01,
 			typename T10, typename T11>
-		Matrix(
+		constexpr Matrix(
 			T00 _00, T01 _01,
 			T10 _10, T11 _11)
 			:array{
@@ -66,70 +66,71 @@ namespace PWMath
 
 		// NOTE: Row major ordering
 		template<typename TArr>
-		Matrix(TArr(&vals)[4])
+		constexpr Matrix(TArr(&vals)[4])
 			:array{
 				{ static_cast<T>(vals[0]), static_cast<T>(vals[1]) },
 				{ static_cast<T>(vals[2]), static_cast<T>(vals[3]) } }
 		{}
 
-		RowType GetRow(size_t index) const { return array[index]; }
-		ColumnType GetColumn(size_t index) const { return RowType{ x[index], y[index] }; }
+		constexpr RowType GetRow(size_t index) const { return array[index]; }
+		constexpr ColumnType GetColumn(size_t index) const { return RowType{ array[0][index], array[1][index] }; }
 
-		ColumnType& operator[](size_t index) { return array[index]; }
-		const ColumnType& operator[](size_t index) const { return array[index]; }
+		constexpr ColumnType& operator[](size_t index) { return array[index]; }
+		constexpr const ColumnType& operator[](size_t index) const { return array[index]; }
 
 		Matrix& operator=(const Matrix&) = default;
 
-		bool operator==(const Matrix&) const = default;
+		// Compared element by element, a defaulted comparison is deleted because of the anonymous union
+		constexpr bool operator==(const Matrix& rhs) const { return array[0] == rhs.array[0] && array[1] == rhs.array[1]; }
 
-		TransposeType Transpose() const;
-		T Determinant() const;
+		constexpr TransposeType Transpose() const;
+		constexpr T Determinant() const;
 	};
 
 	// Unary plus and minus
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& rhs);
 
 	// Addition and substraction
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator+(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator-(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator+=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr const Matrix<T, 2, 2, P>& operator+=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator-=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr const Matrix<T, 2, 2, P>& operator-=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 
 	// Matrix-scalar multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, T rhs);
+	constexpr Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, T rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, T rhs);
+	constexpr const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, T rhs);
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(T lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator*(T lhs, const Matrix<T, 2, 2, P>& rhs);
 
 	// Matrix multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr Matrix<T, 2, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr const Matrix<T, 2, 2, P>& operator*=(Matrix<T, 2, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 
 	// Matrix-vector multiplication
 	template<typename T, PackingMode P>
-	Vector<T, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Vector<T, 2, P>& rhs);
+	constexpr Vector<T, 2, P> operator*(const Matrix<T, 2, 2, P>& lhs, const Vector<T, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	Vector<T, 2, P> operator*(const Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr Vector<T, 2, P> operator*(const Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 	template<typename T, PackingMode P>
-	const Vector<T, 2, P>& operator*=(Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
+	constexpr const Vector<T, 2, P>& operator*=(Vector<T, 2, P>& lhs, const Matrix<T, 2, 2, P>& rhs);
 
 	template<typename T, PackingMode P>
-	Matrix<T, 2, 2, P>::TransposeType Transpose(const Matrix<T, 2, 2, P>& matrix);
+	constexpr Matrix<T, 2, 2, P>::TransposeType Transpose(const Matrix<T, 2, 2, P>& matrix);
 
 	template<typename T, PackingMode P>
-	T Determinant(const Matrix<T, 2, 2, P>& matrix);
+	constexpr T Determinant(const Matrix<T, 2, 2, P>& matrix);
 
 #if PWM_DEFINE_OSTREAM
 	// Prints as row major
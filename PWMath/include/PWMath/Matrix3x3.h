@@ -35,7 +35,7 @@ namespace PWMath
 
 		// Special constructors
 		template<typename TVal>
-		Matrix(TVal identityVal)
+		constexpr Matrix(TVal identityVal)
 			:array{
 				{ static_cast<T>(identityVal), static_cast<T>(0), static_cast<T>(0) },
 				{ static_cast<T>(0), static_cast<T>(identityVal), static_cast<T>(0) },
@@ -44,21 +44,30 @@ namespace PWMath
 
 		// NOTE: Each parameter is a row
 		template<typename TX, typename TY, typename TZ, PackingMode PX, PackingMode PY, PackingMode PZ>
-		Matrix(Vector3<TX, PX> x, Vector3<TY, PY> y, Vector3<TZ, PZ> z)
+		constexpr Matrix(Vector3<TX, PX> x, Vector3<TY, PY> y, Vector3<TZ, PZ> z)
 			:array{ Vector3<T, P>{ x }, Vector3<T, P>{ y }, Vector3<T, P>{ z } }
 		{}
 
 		template<typename TMat, PackingMode PMat>
-		Matrix(Matrix<TMat, 3, 3, PMat> matrix)
+		constexpr Matrix(Matrix<TMat, 3, 3, PMat> matrix)
 			: array{ Vector3<T, P>{ matrix[0] }, Vector3<T, P>{ matrix[1] }, Vector3<T, P>{ matrix[2] } }
 		{}
 
+		// Takes the upper left 3x3 of a 4x4 matrix (ex: the rotation and scale of a 3D transform)
+		template<typename TMat, PackingMode PMat>
+		constexpr Matrix(const Matrix<TMat, 4, 4, PMat>& matrix)
+			:array{
+				{ static_cast<T>(matrix[0][0]), static_cast<T>(matrix[0][1]), static_cast<T>(matrix[0][2]) },
+				{ static_cast<T>(matrix[1][0]), static_cast<T>(matrix[1][1]), static_cast<T>(matrix[1][2]) },
+				{ static_cast<T>(matrix[2][0]), static_cast<T>(matrix[2][1]), static_cast<T>(matrix[2][2]) } }
+		{}
+
 		// NOTE: Row major ordering
 		template<
 			typename T00, typename T01, typename T02,
 			typename T10, typename T11, typename T12,
 			typename T20, typename T21, typename T22>
-		Matrix(
+		constexpr Matrix(
 			T00 _00, T01 _01, T02 _02,
 			T10 _10, T11 _11, T12 _12,
 			T20 _20, T21 _21, T22 _22)
@@ -70,71 +79,83 @@ namespace PWMath
 
 		// NOTE: Row major ordering
 		template<typename TArr>
-		Matrix(TArr(&vals)[9])
+		constexpr Matrix(TArr(&vals)[9])
 			:array{
 				{ static_cast<T>(vals[0]), static_cast<T>(vals[1]), static_cast<T>(vals[2]) },
 				{ static_cast<T>(vals[3]), static_cast<T>(vals[4]), static_cast<T>(vals[5]) },
-				{ static_cast<T>(vals[6]), static_cast<T>(vals[7]), static_cast<T>(vals[9]) } }
+				{ static_cast<T>(vals[6]), static_cast<T>(vals[7]), static_cast<T>(vals[8]) } }
 		{}
 
-		RowType GetRow(size_t index) const { return array[index]; }
-		ColumnType GetColumn(size_t index) const { return RowType{ x[index], y[index], z[index] }; }
+		constexpr RowType GetRow(size_t index) const { return array[index]; }
+		constexpr ColumnType GetColumn(size_t index) const { return RowType{ array[0][index], array[1][index], array[2][index] }; }
 
-		ColumnType& operator[](size_t index) { return array[index]; }
-		const ColumnType& operator[](size_t index) const { return array[index]; }
+		constexpr ColumnType& operator[](size_t index) { return array[index]; }
+		constexpr const ColumnType& operator[](size_t index) const { return array[index]; }
 
 		Matrix& operator=(const Matrix&) = default;
 
-		bool operator==(const Matrix&) const = default;
+		// Compared element by element, a defaulted comparison is deleted because of the anonymous union
+		constexpr bool operator==(const Matrix& rhs) const { return array[0] == rhs.array[0] && array[1] == rhs.array[1] && array[2] == rhs.array[2]; }
 
-		TransposeType Transpose() const;
-		T Determinant() const;
+		constexpr TransposeType Transpose() const;
+		constexpr T Determinant() const;
+		constexpr Matrix Cofactor() const;
+		constexpr Matrix Inverse() const;
 	};
 
 	// Unary plus and minus
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& rhs);
 
 	// Addition and substraction
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator+(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator-(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator+=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr const Matrix<T, 3, 3, P>& operator+=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator-=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr const Matrix<T, 3, 3, P>& operator-=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 
 	// Matrix-scalar multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, T rhs);
+	constexpr Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, T rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, T rhs);
+	constexpr const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, T rhs);
 
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(T lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator*(T lhs, const Matrix<T, 3, 3, P>& rhs);
 
 	// Matrix multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr Matrix<T, 3, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr const Matrix<T, 3, 3, P>& operator*=(Matrix<T, 3, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
 
 	// Matrix-vector multiplication
 	template<typename T, PackingMode P>
-	Vector<T, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Vector<T, 3, P>& rhs);
+	constexpr Vector<T, 3, P> operator*(const Matrix<T, 3, 3, P>& lhs, const Vector<T, 3, P>& rhs);
 	template<typename T, PackingMode P>
-	Vector<T, 3, P> operator*(const Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr Vector<T, 3, P> operator*(const Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	template<typename T, PackingMode P>
+	constexpr const Vector<T, 3, P>& operator*=(Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+
+	template<typename T, PackingMode P>
+	constexpr Matrix<T, 3, 3, P>::TransposeType Transpose(const Matrix<T, 3, 3, P>& matrix);
+
 	template<typename T, PackingMode P>
-	const Vector<T, 3, P>& operator*=(Vector<T, 3, P>& lhs, const Matrix<T, 3, 3, P>& rhs);
+	constexpr T Determinant(const Matrix<T, 3, 3, P>& matrix);
 
+	// Matrix of cofactors, the transpose of the adjugate
 	template<typename T, PackingMode P>
-	Matrix<T, 3, 3, P>::TransposeType Transpose(const Matrix<T, 3, 3, P>& matrix);
+	constexpr Matrix<T, 3, 3, P> Cofactor(const Matrix<T, 3, 3, P>& matrix);
 
+	// Notes:
+	//  - The matrix must not be singular (determinant of zero)
 	template<typename T, PackingMode P>
-	T Determinant(const Matrix<T, 3, 3, P>& matrix);
+	constexpr Matrix<T, 3, 3, P> Inverse(const Matrix<T, 3, 3, P>& matrix);
 
 #if PWM_DEFINE_OSTREAM
 	// Prints as row major
@@ -35,7 +35,7 @@ namespace PWMath
 
 		// Special constructors
 		template<typename TVal>
-		Matrix(TVal identityVal)
+		constexpr Matrix(TVal identityVal)
 			:array{
 				{ static_cast<T>(identityVal), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0) },
 				{ static_cast<T>(0), static_cast<T>(identityVal), static_cast<T>(0), static_cast<T>(0) },
@@ -45,12 +45,12 @@ namespace PWMath
 
 		// NOTE: Each parameter is a row
 		template<typename TX, typename TY, typename TZ, typename TW, PackingMode PX, PackingMode PY, PackingMode PZ, PackingMode PW>
-		Matrix(Vector4<TX, PX> x, Vector4<TY, PY> y, Vector4<TZ, PZ> z, Vector4<TW, PW> w)
+		constexpr Matrix(Vector4<TX, PX> x, Vector4<TY, PY> y, Vector4<TZ, PZ> z, Vector4<TW, PW> w)
 			:array{ Vector4<T, P>{ x }, Vector4<T, P>{ y }, Vector4<T, P>{ z }, Vector4<T, P>{ w } }
 		{}
 
 		template<typename TMat, PackingMode PMat>
-		Matrix(Matrix<TMat, 4, 4, PMat> matrix)
+		constexpr Matrix(Matrix<TMat, 4, 4, PMat> matrix)
 			: array{ Vector4<T, P>{ matrix[0] }, Vector4<T, P>{ matrix[1] }, Vector4<T, P>{ matrix[2] }, Vector4<T, P>{ matrix[3] } }
 		{}
 
@@ -60,7 +60,7 @@ namespace PWMath
 			typename T10, typename T11, typename T12, typename T13,
 			typename T20, typename T21, typename T22, typename T23,
 			typename T30, typename T31, typename T32, typename T33>
-		Matrix(
+		constexpr Matrix(
 			T00 _00, T01 _01, T02 _02, T03 _03,
 			T10 _10, T11 _11, T12 _12, T13 _13,
 			T20 _20, T21 _21, T22 _22, T23 _23,
@@ -74,7 +74,7 @@ namespace PWMath
 
 		// NOTE: Row major ordering
 		template<typename TArr>
-		Matrix(TArr(&vals)[16])
+		constexpr Matrix(TArr(&vals)[16])
 			:array{
 				{ static_cast<T>(vals[0]), static_cast<T>(vals[1]), static_cast<T>(vals[2]), static_cast<T>(vals[3]) },
 				{ static_cast<T>(vals[4]), static_cast<T>(vals[5]), static_cast<T>(vals[6]), static_cast<T>(vals[7]) },
@@ -82,64 +82,65 @@ namespace PWMath
 				{ static_cast<T>(vals[12]), static_cast<T>(vals[13]), static_cast<T>(vals[14]), static_cast<T>(vals[15]) } }
 		{}
 
-		RowType GetRow(size_t index) const { return array[index]; }
-		ColumnType GetColumn(size_t index) const { return RowType{ x[index], y[index], z[index], w[index] }; }
+		constexpr RowType GetRow(size_t index) const { return array[index]; }
+		constexpr ColumnType GetColumn(size_t index) const { return RowType{ array[0][index], array[1][index], array[2][index], array[3][index] }; }
 
-		ColumnType& operator[](size_t index) { return array[index]; }
-		const ColumnType& operator[](size_t index) const { return array[index]; }
+		constexpr ColumnType& operator[](size_t index) { return array[index]; }
+		constexpr const ColumnType& operator[](size_t index) const { return array[index]; }
 
 		Matrix& operator=(const Matrix&) = default;
 
-		bool operator==(const Matrix&) const = default;
+		// Compared element by element, a defaulted comparison is deleted because of the anonymous union
+		constexpr bool operator==(const Matrix& rhs) const { return array[0] == rhs.array[0] && array[1] == rhs.array[1] && array[2] == rhs.array[2] && array[3] == rhs.array[3]; }
 
-		TransposeType Transpose() const;
-		T Determinant() const;
+		constexpr TransposeType Transpose() const;
+		constexpr T Determinant() const;
 	};
 
 	// Unary operators
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator+(const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator+(const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator-(const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator-(const Matrix<T, 4, 4, P>& rhs);
 
 	// Addition and substraction
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator+(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator+(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator-(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator-(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 4, 4, P>& operator+=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr const Matrix<T, 4, 4, P>& operator+=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 4, 4, P>& operator-=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr const Matrix<T, 4, 4, P>& operator-=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 
 	// Matrix-scalar multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, T rhs);
+	constexpr Matrix<T, 4, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, T rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 4, 4, P>& operator*=(Matrix<T, 4, 4, P>& lhs, T rhs);
+	constexpr const Matrix<T, 4, 4, P>& operator*=(Matrix<T, 4, 4, P>& lhs, T rhs);
 
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator*(T lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator*(T lhs, const Matrix<T, 4, 4, P>& rhs);
 
 	// Matrix multiplication
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr Matrix<T, 4, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	const Matrix<T, 4, 4, P>& operator*=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr const Matrix<T, 4, 4, P>& operator*=(Matrix<T, 4, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 
 	// Matrix-vector multiplication
 	template<typename T, PackingMode P>
-	Vector<T, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, const Vector<T, 4, P>& rhs);
+	constexpr Vector<T, 4, P> operator*(const Matrix<T, 4, 4, P>& lhs, const Vector<T, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	Vector<T, 4, P> operator*(const Vector<T, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr Vector<T, 4, P> operator*(const Vector<T, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 	template<typename T, PackingMode P>
-	const Vector<T, 4, P>& operator*=(Vector<T, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
+	constexpr const Vector<T, 4, P>& operator*=(Vector<T, 4, P>& lhs, const Matrix<T, 4, 4, P>& rhs);
 
 	template<typename T, PackingMode P>
-	Matrix<T, 4, 4, P>::TransposeType Transpose(const Matrix<T, 4, 4, P>& matrix);
+	constexpr Matrix<T, 4, 4, P>::TransposeType Transpose(const Matrix<T, 4, 4, P>& matrix);
 
 	template<typename T, PackingMode P>
-	T Determinant(const Matrix<T, 4, 4, P>& matrix);
+	constexpr T Determinant(const Matrix<T, 4, 4, P>& matrix);
 
 #if PWM_DEFINE_OSTREAM
 	// Prints as row major
@@ -0,0 +1,89 @@
+#pragma once
+#include <PWMath/Packing.h>
+#include <PWMath/Vector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace PWMath
+{
+	// Compact encodings of unit vectors (normals and tangents)
+	// Notes:
+	//  - Components are signed normalized integers: value * max rounded to nearest even, decoded as max(encoded / max, -1)
+	//  - The batch Encode and Decode below give the same bits as encoding and decoding one at a time
+	//  - The error bounds are the largest angle between a unit vector and its decoded encoding (measured over 2 million random directions)
+
+	// Octahedral encoding, the direction is projected on the octahedron |x| + |y| + |z| = 1 and the lower half folded over the upper one
+	// Notes:
+	//  - OctahedralNormal16 is 4 bytes (3x smaller than a Vector3F32), max error 0.004 degrees
+	//  - OctahedralNormal8 is 2 bytes (6x smaller), max error 0.96 degrees
+	//  - The input doesn't have to be normalized (only its direction is kept), the decoded vector is normalized
+	//  - A zero vector encodes as +z
+	template<typename I>
+	struct OctahedralNormal
+	{
+		static_assert(std::is_integral_v<I> && std::is_signed_v<I>, "Octahedral normals are stored as signed integers");
+
+		I x, y;
+
+		template<typename T, PackingMode P>
+		static constexpr OctahedralNormal Encode(const Vector3<T, P>& normal);
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector3<float, P> Decode() const;
+
+		bool operator==(const OctahedralNormal&) const = default;
+	};
+
+	// Each component as a 16-bit signed normalized integer
+	// Notes:
+	//  - 6 bytes (2x smaller than a Vector3F32), max error 0.0015 degrees
+	//  - The decoded vector isn't renormalized, its length is within 3e-5 of 1
+	struct SnormNormal16
+	{
+		int16_t x, y, z;
+
+		template<typename T, PackingMode P>
+		static constexpr SnormNormal16 Encode(const Vector3<T, P>& normal);
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector3<float, P> Decode() const;
+
+		bool operator==(const SnormNormal16&) const = default;
+	};
+
+	// x, y and z as 10-bit signed normalized integers (bits 0-9, 10-19 and 20-29), w as a 2-bit one (bits 30-31)
+	// Notes:
+	//  - 4 bytes (3x smaller than a Vector3F32), max error 0.1 degrees
+	//  - w is -1, 0 or 1, it holds the handedness of a tangent (the bitangent is Cross(normal, tangent) * w), 0 when encoding a Vector3
+	//  - The decoded vector isn't renormalized, its length is within 2e-3 of 1
+	struct PackedNormal1010102
+	{
+		uint32_t bits;
+
+		template<typename T, PackingMode P>
+		static constexpr PackedNormal1010102 Encode(const Vector3<T, P>& normal);
+		template<typename T, PackingMode P>
+		static constexpr PackedNormal1010102 Encode(const Vector4<T, P>& tangent);
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector3<float, P> Decode() const;
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector4<float, P> DecodeTangent() const;
+
+		bool operator==(const PackedNormal1010102&) const = default;
+	};
+
+	// Encodes count vectors, output[i] = TEncoded::Encode(normals[i])
+	// Notes:
+	//  - The octahedral and packed encodings do their math Simd::Lanes::width vectors at a time
+	template<typename TEncoded, PackingMode P>
+	void Encode(TEncoded* output, const Vector3<float, P>* normals, size_t count);
+
+	// Decodes count vectors, normals[i] = input[i].Decode<P>()
+	template<typename TEncoded, PackingMode P>
+	void Decode(Vector3<float, P>* normals, const TEncoded* input, size_t count);
+
+	using OctahedralNormal16 = OctahedralNormal<int16_t>;
+	using OctahedralNormal8 = OctahedralNormal<int8_t>;
+}
+
+#include <PWMath/Impl/NormalEncoding.inl>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <PWMath/Scalar.h>
+
 #include <PWMath/Vector.h>
 #include <PWMath/Vector2.h>
 #include <PWMath/Vector3.h>
@@ -11,3 +13,25 @@
 #include <PWMath/Matrix4x4.h>
 
 #include <PWMath/Transform.h>
+#include <PWMath/Projection.h>
+#include <PWMath/AABB.h>
+#include <PWMath/Frustum.h>
+#include <PWMath/Ray.h>
+#include <PWMath/Triangle.h>
+#include <PWMath/Viewport.h>
+#include <PWMath/Fixed.h>
+#include <PWMath/Half.h>
+#include <PWMath/NormalEncoding.h>
+#include <PWMath/Color.h>
+#include <PWMath/Stats.h>
+
+// Not included here: BVH.h, KDTree.h, SpatialHashGrid.h and Sphere.h split their work over std::thread (Parallel.h),
+// so only the files that use them pay for parsing <thread> and <future>
+
+// With PWM_EXTERN_TEMPLATES the float and double batch functions are instantiated once
+// in the PWMath::Compiled library (see Instantiations.inl) instead of in every file
+#if PWM_EXTERN_TEMPLATES
+#define PWM_TEMPLATE extern template
+#include <PWMath/Impl/Instantiations.inl>
+#undef PWM_TEMPLATE
+#endif // PWM_EXTERN_TEMPLATES
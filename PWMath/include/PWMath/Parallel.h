@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+namespace PWMath
+{
+	// Amount of hardware threads, at least 1
+	// Notes:
+	//  - Recursive builds split it between their subtrees, so they never run more threads than this at once
+	inline size_t HardwareThreadCount();
+
+	// Amount of ranges ParallelFor splits count elements into, use it to size per range results
+	// Notes:
+	//  - At most one range per hardware thread, and every range has at least minRange elements (except when count < minRange)
+	inline size_t ParallelRangeCount(size_t count, size_t minRange);
+
+	// Splits [0, count) into ParallelRangeCount(count, minRange) ranges and calls function(range, begin, end) for each, in parallel
+	// Notes:
+	//  - range is the index of the range, so each call can write to its own slot of a results array
+	//  - The calling thread runs the last range, returns once every range is done
+	//  - When there is only one range the function is called directly, without starting any thread
+	template<typename Function>
+	void ParallelFor(size_t count, size_t minRange, Function&& function);
+
+	// Calls function(begin, end) on the ranges of ParallelFor in parallel and combines what they return with merge(lhs, rhs)
+	// Notes:
+	//  - The results are merged in range order on the calling thread
+	template<typename Function, typename Merge>
+	auto ParallelReduce(size_t count, size_t minRange, Function&& function, Merge&& merge);
+}
+
+#include <PWMath/Impl/Parallel.inl>
@@ -3,6 +3,9 @@
 #include <PWMath/Vector3.h>
 #include <PWMath/Matrix3x3.h>
 #include <PWMath/Matrix4x4.h>
+#include <PWMath/Stream.h>
+
+#include <cstddef>
 
 namespace PWMath
 {
@@ -29,6 +32,85 @@ namespace PWMath
 	//  - Z axis gets squished into a (-1)-1 range (For OpenGL)
 	template<typename T = float, PackingMode P = PackingMode::Default>
 	constexpr Matrix4x4<T, P> PerpectiveGL(float screenSize, float aspectRatio, float near, float far);
+
+	enum class ProjectionType
+	{
+		Perspective,
+		Orthographic
+	};
+
+	// Projection stored as the 4 values of its matrix that aren't fixed to 0 or 1
+	// Notes:
+	//  - A point (row vector) projects to { x * scaleX, y * scaleY, z * depthScale + w * depthOffset, z } for a perspective projection,
+	//    and the same with w as the last component for an orthographic one
+	//  - That's 4 multiplies and an add, instead of the 16 multiplies and 12 adds of a vector-Matrix4x4 multiplication
+	//  - Multiplying a view matrix by it costs 16 multiplies instead of the 64 of a Matrix4x4 multiplication
+	//  - ToMatrix gives the matrix of Perpective, PerpectiveGL, Orthographic or OrthographicGL
+	template<typename T, ProjectionType K>
+	struct Projection
+	{
+		using Type = T;
+		static constexpr ProjectionType projectionType = K;
+
+		T scaleX, scaleY;
+		T depthScale, depthOffset;
+
+		// Z axis gets squished into a 0-1 range
+		// Notes:
+		//  - size is the field of view for a perspective projection, and the screen size for an orthographic one
+		static constexpr Projection Create(float size, float aspectRatio, float near, float far);
+
+		// Z axis gets squished into a (-1)-1 range (For OpenGL)
+		// Notes:
+		//  - size is the field of view for a perspective projection, and the screen size for an orthographic one
+		static constexpr Projection CreateGL(float size, float aspectRatio, float near, float far);
+
+		template<PackingMode P = PackingMode::Default>
+		constexpr Matrix4x4<T, P> ToMatrix() const;
+
+		bool operator==(const Projection&) const = default;
+	};
+
+	// Projects a point to clip space, same as point * projection.ToMatrix()
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Vector4<T, P> operator*(const Vector4<T, P>& point, const Projection<T, K>& projection);
+
+	// Projects a point with a w of 1 to clip space
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Vector4<T, P> Project(const Vector3<T, P>& point, const Projection<T, K>& projection);
+
+	// Combines a view (or model view) matrix with the projection, same as view * projection.ToMatrix()
+	// Notes:
+	//  - Each row of the matrix is projected like a point
+	template<typename T, ProjectionType K, PackingMode P>
+	constexpr Matrix4x4<T, P> operator*(const Matrix4x4<T, P>& view, const Projection<T, K>& projection);
+
+	// Projects count points with a w of 1 to clip space
+	// Notes:
+	//  - clipPoints[i] is Project(points[i], projection)
+	template<typename T, ProjectionType K, PackingMode P>
+	void Project(Vector4<T, P>* clipPoints, const Vector3<T, P>* points, const Projection<T, K>& projection, size_t count);
+
+	// Projects count points to clip space
+	// Notes:
+	//  - clipPoints[i] is points[i] * projection
+	//  - Each point is one multiply, one multiply-add and one shuffle when T fits in a Simd::Row
+	template<typename T, ProjectionType K, PackingMode P>
+	void Project(Vector4<T, P>* clipPoints, const Vector4<T, P>* points, const Projection<T, K>& projection, size_t count);
+
+	// Projects count points with a w of 1 to clip space, Simd::Lanes::width points at a time for floats
+	template<typename T, ProjectionType K>
+	void Project(std::type_identity_t<Vector4Stream<T>> clipPoints, std::type_identity_t<Vector3Stream<const T>> points, const Projection<T, K>& projection, size_t count);
+
+	template<typename T = float>
+	using PerspectiveProjection = Projection<T, ProjectionType::Perspective>;
+	template<typename T = float>
+	using OrthographicProjection = Projection<T, ProjectionType::Orthographic>;
+
+	using PerspectiveProjectionF32	= PerspectiveProjection<float>;
+	using PerspectiveProjectionF64	= PerspectiveProjection<double>;
+	using OrthographicProjectionF32	= OrthographicProjection<float>;
+	using OrthographicProjectionF64	= OrthographicProjection<double>;
 }
 
 #include <PWMath/Impl/Projection.inl>
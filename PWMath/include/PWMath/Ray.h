@@ -0,0 +1,87 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/AABB.h>
+#include <PWMath/Stream.h>
+#include <PWMath/Simd.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace PWMath
+{
+	// Half line starting at origin and going along direction
+	// Notes:
+	//  - The inverse of the direction is kept so slab tests only multiply
+	//  - The direction isn't normalized, distances along the ray are in units of direction
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct Ray
+	{
+		using Type = T;
+		using VectorType = Vector3<T, P>;
+		static constexpr PackingMode packingMode = P;
+
+		Vector3<T, P> origin, direction, inverseDirection;
+
+		// Default constructors
+		Ray() = default;
+		Ray(const Ray&) = default;
+		~Ray() = default;
+
+		// Special constructors
+		constexpr Ray(const Vector3<T, P>& origin, const Vector3<T, P>& direction) noexcept
+			:origin{ origin }, direction{ direction }, inverseDirection{ static_cast<T>(1) / direction }
+		{}
+
+		Ray& operator=(const Ray&) = default;
+
+		bool operator==(const Ray&) const = default;
+
+		// Point at distance along the ray
+		constexpr Vector3<T, P> At(T distance) const { return origin + direction * distance; }
+	};
+
+	// SoA view over rays, used by the packet and batch functions
+	template<typename T>
+	struct RayStream
+	{
+		Vector3Stream<T> origins;
+		Vector3Stream<T> inverseDirections;
+	};
+
+	// Amount of boxes or rays tested by one IntersectPacket call (16 with AVX-512, 8 with AVX, 4 with SSE, 1 otherwise)
+	inline constexpr size_t rayPacketSize = Simd::Lanes::width;
+
+	// Tests a ray against a box with the slab method
+	// Notes:
+	//  - Only hits between 0 and maxDistance count, entry is set to the distance the ray enters the box (0 when starting inside)
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const Ray<T, P>& ray, const AABB<T, P>& box, T maxDistance, T& entry);
+
+	// Tests one ray against rayPacketSize boxes
+	// Notes:
+	//  - Bit i of the result is set when the ray hits box i, entries[i] is the entry distance (infinity on a miss)
+	//  - mins and maxs point to the first box of the packet and must have rayPacketSize boxes
+	template<PackingMode P>
+	uint32_t IntersectPacket(const Ray<float, P>& ray, Vector3Stream<const float> mins, Vector3Stream<const float> maxs, float maxDistance, float* entries);
+
+	// Tests rayPacketSize rays against one box
+	// Notes:
+	//  - Bit i of the result is set when ray i hits the box, entries[i] is the entry distance (infinity on a miss)
+	//  - rays and maxDistances point to the first ray of the packet and must have rayPacketSize rays
+	template<PackingMode P>
+	uint32_t IntersectPacket(RayStream<const float> rays, const AABB<float, P>& box, const float* maxDistances, float* entries);
+
+	// Tests one ray against count boxes and writes the indices and entry distances of the boxes hit
+	// Notes:
+	//  - hitIndices and entries must have room for count values, returns the amount written
+	//  - count must fit in a uint32_t, like the indices (asserted)
+	//  - Float boxes are tested rayPacketSize at a time
+	template<typename T, PackingMode P>
+	size_t Intersect(const Ray<T, P>& ray, std::type_identity_t<Vector3Stream<const T>> mins, std::type_identity_t<Vector3Stream<const T>> maxs, size_t count,
+		T maxDistance, uint32_t* hitIndices, T* entries);
+
+	using RayF32 = Ray<float>;
+	using RayF64 = Ray<double>;
+}
+
+#include <PWMath/Impl/Ray.inl>
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace PWMath
+{
+	// Square root that can be evaluated at compile time
+	// Notes:
+	//  - Calls std::sqrt at runtime, integers are rooted as double and truncated like std::sqrt would when assigned back
+	template<typename T>
+	constexpr T Sqrt(T value);
+
+	// Sine of an angle in radians that can be evaluated at compile time
+	// Notes:
+	//  - Calls std::sin at runtime, the compile time version loses precision for angles far from 0 (around 1e5 and up)
+	template<typename T>
+	constexpr T Sin(T angle);
+
+	// Cosine of an angle in radians that can be evaluated at compile time
+	// Notes:
+	//  - Calls std::cos at runtime, the compile time version loses precision for angles far from 0 (around 1e5 and up)
+	template<typename T>
+	constexpr T Cos(T angle);
+
+	// Sine and cosine of an angle in radians that can be evaluated at compile time
+	// Notes:
+	//  - Same results as Sin and Cos
+	template<typename T>
+	constexpr void SinCos(T angle, T& sine, T& cosine);
+
+	// Sines and cosines of count angles in radians, sines[i] and cosines[i] are those of angles[i]
+	// Notes:
+	//  - Floats go through Simd::SinCos Simd::Lanes::width at a time (max error 1.5 ulp for |angle| <= pi, 9e-8 absolute up to 8192)
+	//  - Other types call Sin and Cos
+	template<typename T>
+	void SinCos(T* sines, T* cosines, const T* angles, size_t count);
+
+	// Tangent of an angle in radians that can be evaluated at compile time
+	// Notes:
+	//  - Calls std::tan at runtime
+	template<typename T>
+	constexpr T Tan(T angle);
+
+	// Absolute value that can be evaluated at compile time
+	template<typename T>
+	constexpr T Abs(T value);
+}
+
+#include <PWMath/Impl/Scalar.inl>
@@ -0,0 +1,228 @@
+#pragma once
+#include <PWMath/Macros.h>
+
+#if PWM_USE_SSE
+#include <immintrin.h>
+#endif // PWM_USE_SSE
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+
+namespace PWMath::Simd
+{
+	// Operations on a 4 component row (ex: a Vector4 or a row of a Matrix4x4) held in one register
+	// Notes:
+	//  - Only specialized for the types the enabled instruction sets can hold, check Row<T>::enabled before using
+	//  - Loads and stores are unaligned, the vector types don't guarantee any alignment
+	template<typename T>
+	struct Row
+	{
+		static constexpr bool enabled = false;
+	};
+
+#if PWM_USE_SSE
+	template<>
+	struct Row<float>
+	{
+		using Type = __m128;
+		static constexpr bool enabled = true;
+
+		static Type Load(const float* values) { return _mm_loadu_ps(values); }
+		static void Store(float* values, Type row) { _mm_storeu_ps(values, row); }
+
+		static Type Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+		static Type Set(float value) { return _mm_set1_ps(value); }
+
+		static Type Add(Type lhs, Type rhs) { return _mm_add_ps(lhs, rhs); }
+		static Type Mul(Type lhs, Type rhs) { return _mm_mul_ps(lhs, rhs); }
+		static Type Min(Type lhs, Type rhs) { return _mm_min_ps(lhs, rhs); }
+		static Type Max(Type lhs, Type rhs) { return _mm_max_ps(lhs, rhs); }
+
+		// Returns the components in the order I0, I1, I2, I3 (ex: <2, 0, 1, 3> gives z, x, y, w)
+		template<size_t I0, size_t I1, size_t I2, size_t I3>
+		static Type Shuffle(Type row) { return _mm_shuffle_ps(row, row, _MM_SHUFFLE(I3, I2, I1, I0)); }
+
+		// Returns (a * b) + c
+		static Type MulAdd(Type a, Type b, Type c)
+		{
+#if PWM_USE_FMA
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif // PWM_USE_FMA
+		}
+	};
+#endif // PWM_USE_SSE
+
+#if PWM_USE_AVX
+	template<>
+	struct Row<double>
+	{
+		using Type = __m256d;
+		static constexpr bool enabled = true;
+
+		static Type Load(const double* values) { return _mm256_loadu_pd(values); }
+		static void Store(double* values, Type row) { _mm256_storeu_pd(values, row); }
+
+		static Type Set(double x, double y, double z, double w) { return _mm256_setr_pd(x, y, z, w); }
+		static Type Set(double value) { return _mm256_set1_pd(value); }
+
+		static Type Add(Type lhs, Type rhs) { return _mm256_add_pd(lhs, rhs); }
+		static Type Mul(Type lhs, Type rhs) { return _mm256_mul_pd(lhs, rhs); }
+		static Type Min(Type lhs, Type rhs) { return _mm256_min_pd(lhs, rhs); }
+		static Type Max(Type lhs, Type rhs) { return _mm256_max_pd(lhs, rhs); }
+
+		// Returns the components in the order I0, I1, I2, I3 (ex: <2, 0, 1, 3> gives z, x, y, w)
+		// Notes:
+		//  - One vpermpd with AVX2, AVX alone can't permute across the 128-bit halves so it blends the row with a half-swapped copy
+		template<size_t I0, size_t I1, size_t I2, size_t I3>
+		static Type Shuffle(Type row)
+		{
+#if PWM_USE_AVX2
+			return _mm256_permute4x64_pd(row, _MM_SHUFFLE(I3, I2, I1, I0));
+#else
+			constexpr int within = (I0 & 1) | ((I1 & 1) << 1) | ((I2 & 1) << 2) | ((I3 & 1) << 3);
+			constexpr int crossed = (I0 >= 2) | ((I1 >= 2) << 1) | ((I2 < 2) << 2) | ((I3 < 2) << 3);
+			const Type swapped = _mm256_permute2f128_pd(row, row, 0x01);
+			return _mm256_blend_pd(_mm256_permute_pd(row, within), _mm256_permute_pd(swapped, within), crossed);
+#endif // PWM_USE_AVX2
+		}
+
+		// Returns (a * b) + c
+		static Type MulAdd(Type a, Type b, Type c)
+		{
+#if PWM_USE_FMA
+			return _mm256_fmadd_pd(a, b, c);
+#else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif // PWM_USE_FMA
+		}
+	};
+#endif // PWM_USE_AVX
+
+	// Lanes of independent values, the batch functions process <width> elements of a stream at a time with these
+	// Notes:
+	//  - 16 lanes with AVX-512, 8 with AVX, 4 with SSE, and a single lane (plain scalar code) without any of them
+	//  - Comparisons return a LaneMask, use Select to pick between two values per lane
+	struct LaneMask;
+
+	struct Lanes
+	{
+#if PWM_USE_AVX512
+		using Type = __m512;
+		static constexpr size_t width = 16;
+#elif PWM_USE_AVX
+		using Type = __m256;
+		static constexpr size_t width = 8;
+#elif PWM_USE_SSE
+		using Type = __m128;
+		static constexpr size_t width = 4;
+#else
+		using Type = float;
+		static constexpr size_t width = 1;
+#endif // PWM_USE_AVX512
+
+		Type value;
+
+		Lanes() = default;
+		Lanes(Type value) :value{ value } {}
+#if PWM_USE_SSE
+		Lanes(float value) :value{ Broadcast(value) } {}
+#endif // PWM_USE_SSE
+
+		// Loads width values from memory (no alignment needed)
+		static Lanes Load(const float* values);
+		// Loads width 8-bit or 16-bit unsigned integers converted to float
+		static Lanes Load(const uint8_t* values);
+		static Lanes Load(const uint16_t* values);
+		// Loads lane i from values[i * stride], use for pulling one member out of an array of structs
+		static Lanes Load(const float* values, size_t stride);
+		// Loads the first count values from memory (count <= width), the other lanes are 0
+		static Lanes LoadPartial(const float* values, size_t count);
+		// Loads width xyz triples stored one after the other (3 * width values) as one Lanes per component
+		static void LoadXYZ(const float* values, Lanes& x, Lanes& y, Lanes& z);
+		// Loads width xyzw quadruples stored one after the other (4 * width values) as one Lanes per component
+		static void LoadXYZW(const float* values, Lanes& x, Lanes& y, Lanes& z, Lanes& w);
+		// Stores width values to memory (no alignment needed)
+		void Store(float* values) const;
+		// Stores width 8-bit or 16-bit unsigned integers, the lanes must hold integers in the type's range
+		void Store(uint8_t* values) const;
+		void Store(uint16_t* values) const;
+		// Stores lane i to values[i * stride]
+		void Store(float* values, size_t stride) const;
+		// Stores x, y and z as width xyz triples one after the other (3 * width values)
+		static void StoreXYZ(float* values, Lanes x, Lanes y, Lanes z);
+		// Stores x, y, z and w as width xyzw quadruples one after the other (4 * width values)
+		static void StoreXYZW(float* values, Lanes x, Lanes y, Lanes z, Lanes w);
+
+	private:
+		static Type Broadcast(float value);
+	};
+
+	struct LaneMask
+	{
+#if PWM_USE_AVX512
+		using Type = __mmask16;
+#elif PWM_USE_AVX
+		using Type = __m256;
+#elif PWM_USE_SSE
+		using Type = __m128;
+#else
+		using Type = bool;
+#endif // PWM_USE_AVX512
+
+		Type value;
+
+		// Bit i is set when lane i is set
+		uint32_t Bits() const;
+		bool Any() const { return Bits() != 0; }
+		bool All() const { return Bits() == (1u << Lanes::width) - 1; }
+	};
+
+	inline Lanes operator+(Lanes lhs, Lanes rhs);
+	inline Lanes operator-(Lanes lhs, Lanes rhs);
+	inline Lanes operator*(Lanes lhs, Lanes rhs);
+	inline Lanes operator/(Lanes lhs, Lanes rhs);
+	inline Lanes operator-(Lanes value);
+
+	inline LaneMask operator<(Lanes lhs, Lanes rhs);
+	inline LaneMask operator<=(Lanes lhs, Lanes rhs);
+	inline LaneMask operator>(Lanes lhs, Lanes rhs);
+	inline LaneMask operator>=(Lanes lhs, Lanes rhs);
+	inline LaneMask operator&(LaneMask lhs, LaneMask rhs);
+	inline LaneMask operator|(LaneMask lhs, LaneMask rhs);
+
+	// Returns (a * b) + c
+	inline Lanes MulAdd(Lanes a, Lanes b, Lanes c);
+	// Returns (a * b) - (c * d) computed as doubles and rounded once
+	// Notes:
+	//  - The products are exact as doubles, so the result is the same whether or not anything gets fused into an FMA,
+	//    and matches static_cast<float>(double(a) * b - double(c) * d) in scalar code
+	inline Lanes DifferenceOfProducts(Lanes a, Lanes b, Lanes c, Lanes d);
+	// Like the minps and maxps instructions, rhs is returned when either value is NaN
+	inline Lanes Min(Lanes lhs, Lanes rhs);
+	inline Lanes Max(Lanes lhs, Lanes rhs);
+	inline Lanes Abs(Lanes value);
+	inline Lanes Sqrt(Lanes value);
+	// Approximate 1 / value refined with one Newton-Raphson step, a few ulp off instead of the 0.5 of a division
+	// Notes:
+	//  - 0 and infinity give NaN instead of infinity and 0
+	inline Lanes Reciprocal(Lanes value);
+	// Picks ifTrue for the set lanes of mask, ifFalse for the rest
+	inline Lanes Select(LaneMask mask, Lanes ifTrue, Lanes ifFalse);
+
+	// Sine and cosine of angles in radians
+	// Notes:
+	//  - The angle is reduced by the nearest multiple of pi/2 (the multiple is subtracted in three parts, so the reduction is exact),
+	//    then minimax polynomials on [-pi/4, pi/4] are used
+	//  - Max error 1.5 ulp for |angle| <= pi and 9e-8 absolute for |angle| <= 8192, lanes past that (and infinities and NaNs) go through std::sin and std::cos
+	inline void SinCos(Lanes angle, Lanes& sine, Lanes& cosine);
+
+	// Writes first + i for each set bit i of bits to indices, returns the amount written
+	inline size_t CompressIndices(uint32_t bits, uint32_t first, uint32_t* indices);
+}
+
+#include <PWMath/Impl/Simd.inl>
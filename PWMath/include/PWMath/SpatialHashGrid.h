@@ -0,0 +1,64 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/Stream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace PWMath
+{
+	// Uniform grid of cubic cells over points, with the cells hashed into a fixed amount of buckets
+	// Notes:
+	//  - Made to be rebuilt every frame for moving points, the vectors keep their memory between rebuilds
+	//  - The points are copied in bucket order as SoA arrays, so each bucket is a contiguous range that is tested Simd::Lanes::width points at a time
+	//  - Different cells can share a bucket, the queries check the distance of every point so this only costs time
+	//  - Queries work best with a cell size around the query radius
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct SpatialHashGrid
+	{
+		using Type = T;
+		static constexpr PackingMode packingMode = P;
+
+		T cellSize = static_cast<T>(1);
+		// Sorted points of bucket b are [bucketStarts[b], bucketStarts[b + 1])
+		std::vector<uint32_t> bucketStarts;
+		// Index of each sorted point in the points given to Rebuild
+		std::vector<uint32_t> pointIndices;
+		// Sorted point positions
+		std::vector<T> x, y, z;
+
+		size_t BucketCount() const { return bucketStarts.empty() ? 0 : bucketStarts.size() - 1; }
+		size_t PointCount() const { return pointIndices.size(); }
+		Vector3Stream<const T> Points() const { return Vector3Stream<const T>{ x.data(), y.data(), z.data() }; }
+	};
+
+	// Sorts count points into the grid's buckets with a counting sort
+	// Notes:
+	//  - The bucket count is the power of two at or above count, cellSize must be positive
+	//  - Large inputs are counted and scattered on all cores, sharing one atomic count per bucket, then each bucket is sorted so the order doesn't depend on the threads
+	//  - Only allocates when the point count grows past what the grid held before, apart from a value per core
+	template<typename T, PackingMode P>
+	void Rebuild(SpatialHashGrid<T, P>& grid, const Vector3<T, P>* points, size_t count, std::type_identity_t<T> cellSize);
+
+	// Calls callback(pointIndex, distance2) for every point within radius of center (on the surface counts)
+	// Notes:
+	//  - pointIndex indexes the points given to Rebuild, distance2 is the squared distance to center
+	//  - The points come in bucket order, not by distance
+	template<typename T, PackingMode P, typename Callback>
+	void QueryRadius(const SpatialHashGrid<T, P>& grid, const Vector3<T, P>& center, std::type_identity_t<T> radius, Callback&& callback);
+
+	// Finds the k points nearest to point, up to maxDistance away
+	// Notes:
+	//  - indices and distances2 must have room for k values, they are written nearest first and the amount written is returned
+	//  - Searches rings of cells around point, stopping once no unvisited cell can hold anything nearer
+	//  - When the search would visit more cells than there are buckets every bucket is searched once instead, so maxDistance can be infinity
+	template<typename T, PackingMode P>
+	size_t QueryNearest(const SpatialHashGrid<T, P>& grid, const Vector3<T, P>& point, size_t k, std::type_identity_t<T> maxDistance, uint32_t* indices, T* distances2);
+
+	using SpatialHashGridF32 = SpatialHashGrid<float>;
+	using SpatialHashGridF64 = SpatialHashGrid<double>;
+}
+
+#include <PWMath/Impl/SpatialHashGrid.inl>
@@ -0,0 +1,86 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/AABB.h>
+
+#include <cstddef>
+
+namespace PWMath
+{
+	// Bounding sphere
+	// Notes:
+	//  - A negative radius is an empty sphere, containing nothing (see Empty)
+	template<typename T, PackingMode P = PackingMode::Default>
+	struct Sphere
+	{
+		using Type = T;
+		using VectorType = Vector3<T, P>;
+		static constexpr PackingMode packingMode = P;
+
+		Vector3<T, P> center;
+		T radius;
+
+		// Default constructors
+		Sphere() = default;
+		Sphere(const Sphere&) = default;
+		~Sphere() = default;
+
+		// Special constructors
+		constexpr Sphere(const Vector3<T, P>& center, T radius) noexcept :center{ center }, radius{ radius } {}
+
+		// A sphere that contains nothing, merging anything into it gives back what was merged
+		static constexpr Sphere Empty();
+
+		Sphere& operator=(const Sphere&) = default;
+
+		bool operator==(const Sphere&) const = default;
+	};
+
+	// Tests if a point is inside the sphere (on the surface counts)
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const Sphere<T, P>& sphere, const Vector3<T, P>& point);
+
+	// Tests if a sphere is completely inside the other sphere
+	template<typename T, PackingMode P>
+	constexpr bool Contains(const Sphere<T, P>& sphere, const Sphere<T, P>& inner);
+
+	// Smallest sphere containing both spheres
+	template<typename T, PackingMode P>
+	constexpr Sphere<T, P> Merge(const Sphere<T, P>& lhs, const Sphere<T, P>& rhs);
+
+	// Grows the sphere just enough to contain the point, moving its center towards the point (Ritter's update)
+	// Notes:
+	//  - Gives back the sphere when the point is already inside
+	template<typename T, PackingMode P>
+	constexpr Sphere<T, P> Merge(const Sphere<T, P>& sphere, const Vector3<T, P>& point);
+
+	// Sphere around count points, centered on the center of their bounding box
+	// Notes:
+	//  - The radius is the distance to the farthest point, so it is never larger than the length of the box extent
+	//  - Two passes over the points, the cheapest and loosest of the bounding sphere functions
+	//  - Float points are processed Simd::Lanes::width at a time, large inputs are split over all cores
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereCentroid(const Vector3<T, P>* points, size_t count);
+
+	// Sphere around count points with Ritter's method
+	// Notes:
+	//  - Starts from the sphere between two far apart points, then grows it over every point
+	//  - Three passes over the points, usually 5-20% larger than the smallest sphere
+	//  - Float points are processed Simd::Lanes::width at a time, large inputs are split over all cores
+	//  - With several cores each range grows its own sphere and they are merged, which can come out a bit larger
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereRitter(const Vector3<T, P>* points, size_t count);
+
+	// Sphere around count points with the extremal points optimal sphere method (EPOS) and iterative refinement
+	// Notes:
+	//  - The starting sphere is fitted to the points farthest along 7 directions (the axes and the 4 diagonals), then grown over every point
+	//  - Each refinement pass shrinks the sphere and grows it back over every point, keeping it when it came out smaller
+	//  - 2 + refinementPasses passes over the points, usually within a few percent of the smallest sphere
+	//  - Float points are processed Simd::Lanes::width at a time, large inputs are split over all cores
+	template<typename T, PackingMode P>
+	Sphere<T, P> BoundingSphereEPOS(const Vector3<T, P>* points, size_t count, size_t refinementPasses = 2);
+
+	using SphereF32 = Sphere<float>;
+	using SphereF64 = Sphere<double>;
+}
+
+#include <PWMath/Impl/Sphere.inl>
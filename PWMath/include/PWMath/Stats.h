@@ -0,0 +1,75 @@
+#pragma once
+#include <PWMath/Macros.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace PWMath
+{
+	// What PWM_ENABLE_STATS counts, operation families and the degenerate inputs they were given
+	enum class Stat
+	{
+		Normalize,
+		MatrixMultiply,				// Matrix * matrix, including the one Rotate does
+		MatrixVectorMultiply,		// Matrix * vector and vector * matrix, including the rows of a matrix * matrix bigger than 4x4 or not square
+		Determinant,
+		Inverse,
+		Translate,
+		Scale,
+		Rotate,						// Rotate and MakeRotation (the batch Rotate counts through MakeRotation)
+		Shear,
+		NormalMatrix,
+		ComposeTRS,
+		Project,					// Points projected with a Projection
+
+		NormalizeZeroLength,		// Normalize of a vector with a length of 0 (the result is NaN)
+		SingularDeterminant,		// Determinant gave 0
+		SingularInverse,			// Inverse or NormalMatrix of a matrix with a determinant of 0 (the result is infinite or NaN)
+
+		Count
+	};
+
+	// Counts of every Stat, summed over all threads
+	struct StatsSnapshot
+	{
+		uint64_t counts[static_cast<size_t>(Stat::Count)];
+
+		constexpr uint64_t operator[](Stat stat) const { return counts[static_cast<size_t>(stat)]; }
+
+		// The counts since an earlier snapshot (ex: per frame)
+		constexpr StatsSnapshot operator-(const StatsSnapshot& earlier) const;
+	};
+
+	// True when the library was built with PWM_ENABLE_STATS
+#if PWM_ENABLE_STATS
+	inline constexpr bool statsEnabled = true;
+#else
+	inline constexpr bool statsEnabled = false;
+#endif // PWM_ENABLE_STATS
+
+	// Takes a snapshot of the counts of all threads (including the ones that have exited)
+	// Notes:
+	//  - Each thread counts into its own block of relaxed atomics, so counting never locks or contends
+	//  - Taking a snapshot locks the list of blocks, a thread counting at the same time may or may not be included yet
+	//  - Without PWM_ENABLE_STATS every count is 0
+	StatsSnapshot GetStats();
+
+	// snake_case name of a stat for exporting (ex: "normalize_zero_length")
+	const char* StatName(Stat stat);
+}
+
+// Counts operations when PWM_ENABLE_STATS is defined to 1, expands to nothing otherwise
+// Notes:
+//  - PWM_ENABLE_STATS has to be the same in every translation unit (the CMake option PWMATH_ENABLE_STATS sets it on the target)
+//  - Nothing is counted during constant evaluation
+#if PWM_ENABLE_STATS
+#define PWM_STATS_ADD(stat, amount) do { if (!std::is_constant_evaluated()) ::PWMath::Detail::AddStat(::PWMath::Stat::stat, (amount)); } while (false)
+#define PWM_STATS_COUNT_IF(condition, stat) do { if (!std::is_constant_evaluated() && (condition)) ::PWMath::Detail::AddStat(::PWMath::Stat::stat, 1); } while (false)
+#else
+#define PWM_STATS_ADD(stat, amount) ((void)0)
+#define PWM_STATS_COUNT_IF(condition, stat) ((void)0)
+#endif // PWM_ENABLE_STATS
+#define PWM_STATS_COUNT(stat) PWM_STATS_ADD(stat, 1)
+
+#include <PWMath/Impl/Stats.inl>
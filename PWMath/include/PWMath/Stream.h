@@ -0,0 +1,103 @@
+#pragma once
+#include <PWMath/Vector2.h>
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
+#include <PWMath/Simd.h>
+
+#include <type_traits>
+
+namespace PWMath
+{
+	// Structure of arrays (SoA) views over vector data, used by the batch functions
+	// Notes:
+	//  - Each component is its own contiguous array, element i of the stream is { x[i], y[i], ... }
+	//  - Use a const T (ex: Vector3Stream<const float>) for read only streams
+	//  - The streams don't own their memory
+
+	template<typename T>
+	struct Vector2Stream
+	{
+		using Type = std::remove_const_t<T>;
+
+		T* x;
+		T* y;
+
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector2<Type, P> Get(size_t index) const { return Vector2<Type, P>{ x[index], y[index] }; }
+
+		template<PackingMode P>
+		constexpr void Set(size_t index, const Vector2<Type, P>& value) const { x[index] = value.x; y[index] = value.y; }
+
+		constexpr operator Vector2Stream<const Type>() const { return Vector2Stream<const Type>{ x, y }; }
+	};
+
+	template<typename T>
+	struct Vector3Stream
+	{
+		using Type = std::remove_const_t<T>;
+
+		T* x;
+		T* y;
+		T* z;
+
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector3<Type, P> Get(size_t index) const { return Vector3<Type, P>{ x[index], y[index], z[index] }; }
+
+		template<PackingMode P>
+		constexpr void Set(size_t index, const Vector3<Type, P>& value) const { x[index] = value.x; y[index] = value.y; z[index] = value.z; }
+
+		constexpr operator Vector3Stream<const Type>() const { return Vector3Stream<const Type>{ x, y, z }; }
+	};
+
+	template<typename T>
+	struct Vector4Stream
+	{
+		using Type = std::remove_const_t<T>;
+
+		T* x;
+		T* y;
+		T* z;
+		T* w;
+
+		template<PackingMode P = PackingMode::Default>
+		constexpr Vector4<Type, P> Get(size_t index) const { return Vector4<Type, P>{ x[index], y[index], z[index], w[index] }; }
+
+		template<PackingMode P>
+		constexpr void Set(size_t index, const Vector4<Type, P>& value) const { x[index] = value.x; y[index] = value.y; z[index] = value.z; w[index] = value.w; }
+
+		constexpr operator Vector4Stream<const Type>() const { return Vector4Stream<const Type>{ x, y, z, w }; }
+	};
+
+	namespace Detail
+	{
+		// Loads Simd::Lanes::width consecutive vectors as one Lanes per component
+		template<PackingMode P>
+		void LoadVectors(const Vector3<float, P>* vectors, Simd::Lanes& x, Simd::Lanes& y, Simd::Lanes& z)
+		{
+			if constexpr (sizeof(Vector3<float, P>) == 3 * sizeof(float))
+				Simd::Lanes::LoadXYZ(vectors->array, x, y, z);
+			else
+			{
+				constexpr size_t stride = sizeof(Vector3<float, P>) / sizeof(float);
+				x = Simd::Lanes::Load(vectors->array + 0, stride);
+				y = Simd::Lanes::Load(vectors->array + 1, stride);
+				z = Simd::Lanes::Load(vectors->array + 2, stride);
+			}
+		}
+
+		// Stores one Lanes per component as Simd::Lanes::width consecutive vectors
+		template<PackingMode P>
+		void StoreVectors(Vector3<float, P>* vectors, Simd::Lanes x, Simd::Lanes y, Simd::Lanes z)
+		{
+			if constexpr (sizeof(Vector3<float, P>) == 3 * sizeof(float))
+				Simd::Lanes::StoreXYZ(vectors->array, x, y, z);
+			else
+			{
+				constexpr size_t stride = sizeof(Vector3<float, P>) / sizeof(float);
+				x.Store(vectors->array + 0, stride);
+				y.Store(vectors->array + 1, stride);
+				z.Store(vectors->array + 2, stride);
+			}
+		}
+	}
+}
@@ -8,6 +8,11 @@
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
 
+#include "Stream.h"
+
+#include <cstddef>
+#include <type_traits>
+
 namespace PWMath
 {
 	// Translates a matrix (2D in 3x3 matrix)
@@ -18,6 +23,14 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Translate(const Matrix4x4<T, P>& matrix, const Vector3<T, P>& translation);
 
+	// Translates a matrix in place (2D in 3x3 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& TranslateInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& translation);
+
+	// Translates a matrix in place (3D in 4x4 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix4x4<T, P>& TranslateInPlace(Matrix4x4<T, P>& matrix, const Vector3<T, P>& translation);
+
 
 	// Scales a matrix (2D in 2x2 matrix)
 	template<typename T, PackingMode P>
@@ -35,22 +48,75 @@ namespace PWMath
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Scale(const Matrix4x4<T, P>& matrix, const Vector3<T, P>& scale);
 
+	// Scales a matrix in place (2D in 2x2 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix2x2<T, P>& ScaleInPlace(Matrix2x2<T, P>& matrix, const Vector2<T, P>& scale);
+
+	// Scales a matrix in place (2D in 3x3 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ScaleInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& scale);
+
+	// Scales a matrix in place (3D in 3x3 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ScaleInPlace(Matrix3x3<T, P>& matrix, const Vector3<T, P>& scale);
+
+	// Scales a matrix in place (3D in 4x4 matrix)
+	template<typename T, PackingMode P>
+	constexpr const Matrix4x4<T, P>& ScaleInPlace(Matrix4x4<T, P>& matrix, const Vector3<T, P>& scale);
+
 
 	// Rotates a matrix (2D in 2x2 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix2x2<T, P> Rotate(const Matrix2x2<T, P>& matrix, float rotation);
+	constexpr Matrix2x2<T, P> Rotate(const Matrix2x2<T, P>& matrix, std::type_identity_t<T> rotation);
 
 	// Rotates a matrix (2D in 3x3 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, float rotation);
+	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, std::type_identity_t<T> rotation);
 
 	// Rotates a matrix (3D in 3x3 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, float rotation, const Vector3<T, P>& axis);
+	constexpr Matrix3x3<T, P> Rotate(const Matrix3x3<T, P>& matrix, std::type_identity_t<T> rotation, const Vector3<T, P>& axis);
 
 	// Rotates a matrix (3D in 4x4 matrix)
 	template<typename T, PackingMode P>
-	constexpr Matrix4x4<T, P> Rotate(const Matrix4x4<T, P>& matrix, float rotation, const Vector3<T, P>& axis);
+	constexpr Matrix4x4<T, P> Rotate(const Matrix4x4<T, P>& matrix, std::type_identity_t<T> rotation, const Vector3<T, P>& axis);
+
+	// Creates count rotation matrices (2D in 2x2 matrix)
+	// Notes:
+	//  - matrices[i] is Rotate(Matrix2x2<T, P>{ 1 }, angles[i]), with the sines and cosines from the batch SinCos (max error 1.5 ulp for |angle| <= pi for floats)
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix2x2<T, P>* matrices, const T* angles, size_t count);
+
+	// Creates count rotation matrices (2D in 3x3 matrix), see MakeRotation for 2x2 matrices
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix3x3<T, P>* matrices, const T* angles, size_t count);
+
+	// Creates count rotation matrices about axes (3D in 3x3 matrix)
+	// Notes:
+	//  - matrices[i] is Rotate(Matrix3x3<T, P>{ 1 }, angles[i], axes.Get(i)) up to the error of the batch SinCos
+	//  - Float matrices are built Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix3x3<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count);
+
+	// Creates count rotation matrices about axes (3D in 4x4 matrix), see MakeRotation for 3x3 matrices
+	template<typename T, PackingMode P>
+	void MakeRotation(Matrix4x4<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count);
+
+	// Rotates count matrices in place, matrices[i] = Rotate(matrices[i], angles[i]) (2D in 2x2 and 3x3 matrices)
+	// Notes:
+	//  - The rotations are made with MakeRotation in blocks, then multiplied in
+	template<typename T, PackingMode P>
+	void Rotate(Matrix2x2<T, P>* matrices, const T* angles, size_t count);
+	template<typename T, PackingMode P>
+	void Rotate(Matrix3x3<T, P>* matrices, const T* angles, size_t count);
+
+	// Rotates count matrices in place, matrices[i] = Rotate(matrices[i], angles[i], axes.Get(i)) (3D in 3x3 and 4x4 matrices)
+	// Notes:
+	//  - The rotations are made with MakeRotation in blocks, then multiplied in
+	template<typename T, PackingMode P>
+	void Rotate(Matrix3x3<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count);
+	template<typename T, PackingMode P>
+	void Rotate(Matrix4x4<T, P>* matrices, const T* angles, std::type_identity_t<Vector3Stream<const T>> axes, size_t count);
 
 
 	// Shears a matrix (2D in 2x2 matrix)
@@ -82,6 +148,71 @@ namespace PWMath
 	//  - zShear.x indecates how the the Z axis affects the X axis, yShear.y indecates the effect the Y axis
 	template<typename T, PackingMode P>
 	constexpr Matrix4x4<T, P> Shear(const Matrix4x4<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear);
+
+	// Shears a matrix in place (2D in 2x2 matrix), see Shear for the meaning of the parameters
+	template<typename T, PackingMode P>
+	constexpr const Matrix2x2<T, P>& ShearInPlace(Matrix2x2<T, P>& matrix, float xShear, float yShear);
+
+	// Shears a matrix in place (2D in 3x3 matrix), see Shear for the meaning of the parameters
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ShearInPlace(Matrix3x3<T, P>& matrix, float xShear, float yShear);
+
+	// Shears a matrix in place (3D in 3x3 matrix), see Shear for the meaning of the parameters
+	template<typename T, PackingMode P>
+	constexpr const Matrix3x3<T, P>& ShearInPlace(Matrix3x3<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear);
+
+	// Shears a matrix in place (3D in 4x4 matrix), see Shear for the meaning of the parameters
+	template<typename T, PackingMode P>
+	constexpr const Matrix4x4<T, P>& ShearInPlace(Matrix4x4<T, P>& matrix, const Vector2<T, P>& xShear, const Vector2<T, P>& yShear, const Vector2<T, P>& zShear);
+
+	// Creates the matrix for transforming normals, the inverse transpose of the matrix (3D in 3x3 matrix)
+	// Notes:
+	//  - When the matrix only rotates and uniformly scales (rows orthogonal and of equal length), the inverse is skipped
+	//  - Transformed normals keep the scale of the matrix, normalize them if needed
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> NormalMatrix(const Matrix3x3<T, P>& matrix);
+
+	// Creates the matrix for transforming normals, the inverse transpose of the upper left 3x3 (3D in 4x4 matrix)
+	// Notes:
+	//  - When the matrix only rotates and uniformly scales (rows orthogonal and of equal length), the inverse is skipped
+	//  - Transformed normals keep the scale of the matrix, normalize them if needed
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> NormalMatrix(const Matrix4x4<T, P>& matrix);
+
+	// Creates the normal matrices for count matrices (3D in 4x4 matrix)
+	// Notes:
+	//  - normalMatrices[i] is NormalMatrix(matrices[i])
+	//  - Float matrices are processed Simd::Lanes::width at a time, the uniform scale shortcut is taken when it applies to all of them
+	template<typename T, PackingMode P>
+	void NormalMatrix(Matrix3x3<T, P>* normalMatrices, const Matrix4x4<T, P>* matrices, size_t count);
+
+	// Composes a translation, rotation and scale into a matrix (2D in 3x3 matrix)
+	// Notes:
+	//  - Gives the same result as Scale(Rotate(Translate(Matrix3x3<T, P>{ 1 }, translation), rotation), scale)
+	//  - The matrix is written directly, no matrix multiplies are done
+	template<typename T, PackingMode P>
+	constexpr Matrix3x3<T, P> ComposeTRS(const Vector2<T, P>& translation, std::type_identity_t<T> rotation, const Vector2<T, P>& scale);
+
+	// Composes a translation, rotation and scale into a matrix (3D in 4x4 matrix)
+	// Notes:
+	//  - Gives the same result as Scale(Rotate(Translate(Matrix4x4<T, P>{ 1 }, translation), rotation, axis), scale)
+	//  - The matrix is written directly, no matrix multiplies are done
+	template<typename T, PackingMode P>
+	constexpr Matrix4x4<T, P> ComposeTRS(const Vector3<T, P>& translation, std::type_identity_t<T> rotation, const Vector3<T, P>& axis, const Vector3<T, P>& scale);
+
+	// Composes count translations, rotations and scales into matrices (2D in 3x3 matrix)
+	// Notes:
+	//  - matrices[i] is ComposeTRS(translations.Get(i), rotations[i], scales.Get(i))
+	template<typename T, PackingMode P>
+	void ComposeTRS(Matrix3x3<T, P>* matrices, std::type_identity_t<Vector2Stream<const T>> translations, const T* rotations,
+		std::type_identity_t<Vector2Stream<const T>> scales, size_t count);
+
+	// Composes count translations, rotations and scales into matrices (3D in 4x4 matrix)
+	// Notes:
+	//  - matrices[i] is ComposeTRS(translations.Get(i), rotations[i], axes.Get(i), scales.Get(i))
+	template<typename T, PackingMode P>
+	void ComposeTRS(Matrix4x4<T, P>* matrices, std::type_identity_t<Vector3Stream<const T>> translations, const T* rotations,
+		std::type_identity_t<Vector3Stream<const T>> axes, std::type_identity_t<Vector3Stream<const T>> scales, size_t count);
 }
 
 #include <PWMath/Impl/Transform.inl>
@@ -0,0 +1,71 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/Stream.h>
+#include <PWMath/Ray.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace PWMath
+{
+	// SoA view over triangles, vertex i of triangle n is vertexi.Get(n)
+	template<typename T>
+	struct TriangleStream
+	{
+		using Type = std::remove_const_t<T>;
+
+		Vector3Stream<T> vertex0;
+		Vector3Stream<T> vertex1;
+		Vector3Stream<T> vertex2;
+
+		constexpr operator TriangleStream<const Type>() const { return TriangleStream<const Type>{ vertex0, vertex1, vertex2 }; }
+	};
+
+	// Where a ray hit a triangle
+	// Notes:
+	//  - u and v are the barycentric weights of vertex1 and vertex2, the hit point is vertex0 * (1 - u - v) + vertex1 * u + vertex2 * v
+	//  - index is the index of the triangle in the stream (only set by the batch functions)
+	template<typename T>
+	struct TriangleHit
+	{
+		T distance;
+		T u, v;
+		uint32_t index;
+	};
+
+	// Tests a ray against a triangle with the Moller-Trumbore algorithm
+	// Notes:
+	//  - Both sides of the triangle are hit, only hits between 0 and maxDistance count
+	//  - Rays going through a shared edge may miss both triangles, use IntersectsWatertight when that matters
+	template<typename T, PackingMode P>
+	constexpr bool Intersects(const Ray<T, P>& ray, const Vector3<T, P>& vertex0, const Vector3<T, P>& vertex1, const Vector3<T, P>& vertex2,
+		T maxDistance, TriangleHit<T>& hit);
+
+	// Tests a ray against a triangle with the watertight algorithm of Woop, Benthin and Wald
+	// Notes:
+	//  - A ray going through a shared edge or vertex hits at least one of the triangles sharing it
+	//  - Both sides of the triangle are hit, only hits between 0 and maxDistance count
+	//  - Slower than Intersects, the ray is sheared into a space where it points along +Z
+	template<typename T, PackingMode P>
+	bool IntersectsWatertight(const Ray<T, P>& ray, const Vector3<T, P>& vertex0, const Vector3<T, P>& vertex1, const Vector3<T, P>& vertex2,
+		T maxDistance, TriangleHit<T>& hit);
+
+	// Finds the nearest triangle hit by the ray, using Intersects
+	// Notes:
+	//  - Returns false if nothing was hit between 0 and maxDistance, hit is only written on a hit
+	//  - Float triangles are tested Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	bool IntersectNearest(const Ray<T, P>& ray, std::type_identity_t<TriangleStream<const T>> triangles, size_t count, T maxDistance, TriangleHit<T>& hit);
+
+	// Finds the nearest triangle hit by the ray, using IntersectsWatertight
+	// Notes:
+	//  - Returns false if nothing was hit between 0 and maxDistance, hit is only written on a hit
+	//  - Float triangles are tested Simd::Lanes::width at a time
+	template<typename T, PackingMode P>
+	bool IntersectNearestWatertight(const Ray<T, P>& ray, std::type_identity_t<TriangleStream<const T>> triangles, size_t count, T maxDistance, TriangleHit<T>& hit);
+
+	using TriangleHitF32 = TriangleHit<float>;
+	using TriangleHitF64 = TriangleHit<double>;
+}
+
+#include <PWMath/Impl/Triangle.inl>
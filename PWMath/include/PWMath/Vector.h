@@ -1,9 +1,202 @@
 #pragma once
+#include <PWMath/Macros.h>
 #include <PWMath/Packing.h>
+#include <PWMath/Scalar.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace PWMath
 {
+	namespace Detail
+	{
+		template<typename TVec, size_t... I>
+		struct SwizzleProxy;
+	}
+
 	// Template base type for vector
+	// Notes:
+	//  - Used for the sizes without a specialization (2, 3 and 4 have one, with named components)
+	//  - The operators are unrolled at compile time, there are no loops over the components
 	template<typename T, size_t L, PackingMode P = PackingMode::Default>
-	struct Vector {};
+	struct Vector
+	{
+		static_assert(L > 0, "Vector needs at least one component");
+
+	public:
+		using Type = T;
+		static constexpr size_t size = L;
+		static constexpr PackingMode packingMode = P;
+
+		T array[L];
+
+		// Default constuctors and destructors
+		Vector() = default;
+		Vector(const Vector&) = default;
+		~Vector() = default;
+
+		// Special constructors and destructors
+		template<typename TVal>
+		constexpr Vector(TVal values) noexcept :Vector([&](size_t) { return values; }, std::make_index_sequence<L>{}) {}
+		// NOTE: One value per component
+		template<typename... TVals> requires (sizeof...(TVals) == L && L > 1 && (std::is_convertible_v<TVals, T> && ...))
+		constexpr Vector(TVals... values) noexcept :array{ static_cast<T>(values)... } {}
+		template<typename TVec, PackingMode PVec>
+		constexpr Vector(const Vector<TVec, L, PVec>& rhs) noexcept :Vector([&](size_t i) { return rhs[i]; }, std::make_index_sequence<L>{}) {}
+		template<typename TArr>
+		constexpr Vector(TArr (&values)[L]) noexcept :Vector([&](size_t i) { return values[i]; }, std::make_index_sequence<L>{}) {}
+
+		constexpr T& operator[](size_t index) { return array[index]; }
+		constexpr const T& operator[](size_t index) const { return array[index]; }
+
+		Vector& operator=(const Vector& rhs) = default;
+
+		constexpr bool operator==(const Vector& rhs) const = default;
+
+		constexpr T Length() const;
+		constexpr T Length2() const;
+		constexpr Vector Normalize() const;
+		constexpr T Dot(const Vector<T, L, P>& rhs) const;
+
+		template<size_t... I>
+		constexpr Vector<T, sizeof...(I), P> Swizzle() const;
+		template<size_t... I>
+		constexpr Detail::SwizzleProxy<Vector, I...> SwizzleRef();
+
+	private:
+		// Sets component i to function(i), expanded at compile time
+		template<typename Function, size_t... I>
+		constexpr Vector(Function&& function, std::index_sequence<I...>) noexcept :array{ static_cast<T>(function(I))... } {}
+	};
+
+	namespace Detail
+	{
+		// Number of components of TVec if it is a Vector, 0 otherwise
+		template<typename TVec>
+		inline constexpr size_t vectorSize = 0;
+		template<typename T, size_t L, PackingMode P>
+		inline constexpr size_t vectorSize<Vector<T, L, P>> = L;
+
+		// Components I... of vector as a new vector, the indices are known at compile time
+		// Notes:
+		//  - A 4 component swizzle of a Fast 4 component vector is a single shuffle when the type fits in a Simd::Row
+		template<size_t... I, typename T, size_t L, PackingMode P>
+		constexpr Vector<T, sizeof...(I), P> Swizzle(const Vector<T, L, P>& vector);
+
+		// True if no index is repeated
+		template<size_t... I>
+		constexpr bool DistinctIndices()
+		{
+			constexpr size_t indices[] = { I... };
+			for (size_t i = 0; i < sizeof...(I); i++)
+				for (size_t j = i + 1; j < sizeof...(I); j++)
+					if (indices[i] == indices[j])
+						return false;
+			return true;
+		}
+
+		// Writable swizzle, returned by SwizzleRef<I...>()
+		// Notes:
+		//  - Assigning writes only the components I..., the others are left as they are
+		//  - The indices have to be distinct, otherwise a write would be ambiguous
+		//  - Converts to a vector for reading, but keep it only as long as the vector it refers to
+		template<typename TVec, size_t... I>
+		struct SwizzleProxy
+		{
+			static_assert(((I < TVec::size) && ...), "Swizzle index out of range");
+			static_assert(DistinctIndices<I...>(), "Writable swizzles can't repeat a component");
+
+			using ValueType = Vector<typename TVec::Type, sizeof...(I), TVec::packingMode>;
+
+			TVec& vector;
+
+			constexpr SwizzleProxy(TVec& vector) :vector(vector) {}
+			SwizzleProxy(const SwizzleProxy&) = default;
+
+			constexpr operator ValueType() const { return Detail::Swizzle<I...>(vector); }
+
+			constexpr SwizzleProxy& operator=(const ValueType& rhs) { return Assign(rhs, std::make_index_sequence<sizeof...(I)>{}); }
+			constexpr SwizzleProxy& operator=(const SwizzleProxy& rhs) { return *this = Detail::Swizzle<I...>(rhs.vector); }
+			constexpr SwizzleProxy& operator+=(const ValueType& rhs) { return *this = Detail::Swizzle<I...>(vector) + rhs; }
+			constexpr SwizzleProxy& operator-=(const ValueType& rhs) { return *this = Detail::Swizzle<I...>(vector) - rhs; }
+			constexpr SwizzleProxy& operator*=(const ValueType& rhs) { return *this = Detail::Swizzle<I...>(vector) * rhs; }
+			constexpr SwizzleProxy& operator/=(const ValueType& rhs) { return *this = Detail::Swizzle<I...>(vector) / rhs; }
+
+		private:
+			template<size_t... J>
+			constexpr SwizzleProxy& Assign(const ValueType& rhs, std::index_sequence<J...>)
+			{
+				((vector[I] = rhs[J]), ...);
+				return *this;
+			}
+		};
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& vector) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& vector) noexcept;
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(const Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(const Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator+=(Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator-=(Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator*=(Vector<T, L, P>& lhs, T rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator/=(Vector<T, L, P>& lhs, T rhs) noexcept;
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator+=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator-=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator*=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr const Vector<T, L, P>& operator/=(Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs) noexcept;
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator+(T lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator-(T lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator*(T lhs, const Vector<T, L, P>& rhs) noexcept;
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> operator/(T lhs, const Vector<T, L, P>& rhs) noexcept;
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Length(const Vector<T, L, P>& vector);
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Length2(const Vector<T, L, P>& vector);
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr Vector<T, L, P> Normalize(const Vector<T, L, P>& vector);
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr T Dot(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs);
 }
+
+#include <PWMath/Impl/Vector.inl>
+
+// The specializations have to be seen before any of their sizes is used, or the generic version would be instantiated instead
+#include <PWMath/Vector2.h>
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
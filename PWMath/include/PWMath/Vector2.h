@@ -1,5 +1,6 @@
 #pragma once
 #include <PWMath/Vector.h>
+#include <PWMath/Scalar.h>
 
 #if PWM_DEFINE_OSTREAM
 #include <ostream>
@@ -35,7 +36,7 @@ namespace PWMath
 		template<typename TX, typename TY>
 		constexpr Vector(TX x, TY y) noexcept :array{ static_cast<T>(x), static_cast<T>(y) } {}
 		template<typename TVec, PackingMode PVec>
-		constexpr Vector(const Vector<TVec, 2, PVec>& rhs) noexcept :array{ static_cast<T>(rhs.x), static_cast<T>(rhs.y) } {}
+		constexpr Vector(const Vector<TVec, 2, PVec>& rhs) noexcept :array{ static_cast<T>(rhs[0]), static_cast<T>(rhs[1]) } {}
 		template<typename TArr>
 		constexpr Vector(TArr (&values)[2]) noexcept :array{ static_cast<T>(values[0]), static_cast<T>(values[1]) } {}
 
@@ -44,7 +45,8 @@ namespace PWMath
 
 		Vector& operator=(const Vector& rhs) = default;
 
-		bool operator==(const Vector& rhs) const = default;
+		// Compared element by element, a defaulted comparison is deleted because of the anonymous union
+		constexpr bool operator==(const Vector& rhs) const { return array[0] == rhs.array[0] && array[1] == rhs.array[1]; }
 
 		constexpr T Length() const;
 		constexpr T Length2() const;
@@ -54,6 +56,16 @@ namespace PWMath
 		constexpr Vector<T, 2, P> Swizzle(size_t index0, size_t index1) const { return Vector<T, 2, P>{ array[index0], array[index1] }; }
 		constexpr Vector<T, 3, P> Swizzle(size_t index0, size_t index1, size_t index2) const { return Vector<T, 3, P>{ array[index0], array[index1], array[index2] }; }
 		constexpr Vector<T, 4, P> Swizzle(size_t index0, size_t index1, size_t index2, size_t index3) const { return Vector<T, 4, P>{ array[index0], array[index1], array[index2], array[index3] }; }
+
+		// Swizzle with the indices known at compile time (ex: Swizzle<2, 0, 1>() is zxy())
+		template<size_t... I>
+		constexpr Vector<T, sizeof...(I), P> Swizzle() const;
+		// Writable swizzle, only the listed components are written (ex: v.SwizzleRef<1, 0>() = { 1, 2 } sets y to 1 and x to 2)
+		template<size_t... I>
+		constexpr Detail::SwizzleProxy<Vector, I...> SwizzleRef();
+
+		// Named swizzles for the common permutations, Swizzle<...>() covers the rest
+		constexpr Vector<T, 2, P> yx() const { return Swizzle<1, 0>(); }
 	};
 
 	template<typename T, PackingMode P>
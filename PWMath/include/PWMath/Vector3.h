@@ -1,5 +1,6 @@
 #pragma once
 #include <PWMath/Vector.h>
+#include <PWMath/Scalar.h>
 
 #if PWM_DEFINE_OSTREAM
 #include <ostream>
@@ -35,11 +36,11 @@ namespace PWMath
 		template<typename TX, typename TY, typename TZ>
 		constexpr Vector(TX x, TY y, TZ z) noexcept :array{ static_cast<T>(x), static_cast<T>(y), static_cast<T>(z) } {}
 		template<typename TVec, PackingMode PVec>
-		constexpr Vector(const Vector<TVec, 2, PVec>& xy, TVec z) noexcept :array{ static_cast<T>(xy.x), static_cast<T>(xy.y), static_cast<T>(z) } {}
+		constexpr Vector(const Vector<TVec, 2, PVec>& xy, TVec z) noexcept :array{ static_cast<T>(xy[0]), static_cast<T>(xy[1]), static_cast<T>(z) } {}
 		template<typename TVec, PackingMode PVec>
-		constexpr Vector(TVec x, const Vector<TVec, 2, PVec>& yz) noexcept :array{ static_cast<T>(x), static_cast<T>(yz.x), static_cast<T>(yz.y) } {}
+		constexpr Vector(TVec x, const Vector<TVec, 2, PVec>& yz) noexcept :array{ static_cast<T>(x), static_cast<T>(yz[0]), static_cast<T>(yz[1]) } {}
 		template<typename TVec, PackingMode PVec>
-		constexpr Vector(const Vector<TVec, 3, PVec>& rhs) noexcept :array{ static_cast<T>(rhs.x), static_cast<T>(rhs.y),  static_cast<T>(rhs.z) } {}
+		constexpr Vector(const Vector<TVec, 3, PVec>& rhs) noexcept :array{ static_cast<T>(rhs[0]), static_cast<T>(rhs[1]),  static_cast<T>(rhs[2]) } {}
 		template<typename TArr>
 		constexpr Vector(TArr (&values)[3]) noexcept :array{ static_cast<T>(values[0]), static_cast<T>(values[1]), static_cast<T>(values[2]) } {}
 
@@ -48,7 +49,8 @@ namespace PWMath
 
 		Vector& operator=(const Vector& rhs) = default;
 
-		bool operator==(const Vector& rhs) const = default;
+		// Compared element by element, a defaulted comparison is deleted because of the anonymous union
+		constexpr bool operator==(const Vector& rhs) const { return array[0] == rhs.array[0] && array[1] == rhs.array[1] && array[2] == rhs.array[2]; }
 
 		constexpr T Length() const;
 		constexpr T Length2() const;
@@ -59,6 +61,26 @@ namespace PWMath
 		constexpr Vector<T, 2, P> Swizzle(size_t index0, size_t index1) const { return Vector<T, 2, P>{ array[index0], array[index1] }; }
 		constexpr Vector<T, 3, P> Swizzle(size_t index0, size_t index1, size_t index2) const { return Vector<T, 3, P>{ array[index0], array[index1], array[index2] }; }
 		constexpr Vector<T, 4, P> Swizzle(size_t index0, size_t index1, size_t index2, size_t index3) const { return Vector<T, 4, P>{ array[index0], array[index1], array[index2], array[index3] }; }
+
+		// Swizzle with the indices known at compile time (ex: Swizzle<2, 0, 1>() is zxy())
+		template<size_t... I>
+		constexpr Vector<T, sizeof...(I), P> Swizzle() const;
+		// Writable swizzle, only the listed components are written (ex: v.SwizzleRef<0, 2>() = { 1, 2 } sets x and z)
+		template<size_t... I>
+		constexpr Detail::SwizzleProxy<Vector, I...> SwizzleRef();
+
+		// Named swizzles for the common permutations, Swizzle<...>() covers the rest
+		constexpr Vector<T, 2, P> xy() const { return Swizzle<0, 1>(); }
+		constexpr Vector<T, 2, P> xz() const { return Swizzle<0, 2>(); }
+		constexpr Vector<T, 2, P> yx() const { return Swizzle<1, 0>(); }
+		constexpr Vector<T, 2, P> yz() const { return Swizzle<1, 2>(); }
+		constexpr Vector<T, 2, P> zx() const { return Swizzle<2, 0>(); }
+		constexpr Vector<T, 2, P> zy() const { return Swizzle<2, 1>(); }
+		constexpr Vector<T, 3, P> xzy() const { return Swizzle<0, 2, 1>(); }
+		constexpr Vector<T, 3, P> yxz() const { return Swizzle<1, 0, 2>(); }
+		constexpr Vector<T, 3, P> yzx() const { return Swizzle<1, 2, 0>(); }
+		constexpr Vector<T, 3, P> zxy() const { return Swizzle<2, 0, 1>(); }
+		constexpr Vector<T, 3, P> zyx() const { return Swizzle<2, 1, 0>(); }
 	};
 
 	template<typename T, PackingMode P>
@@ -0,0 +1,59 @@
+#pragma once
+#include <PWMath/Vector3.h>
+#include <PWMath/Vector4.h>
+#include <PWMath/Matrix4x4.h>
+#include <PWMath/Frustum.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PWMath
+{
+	// Rectangle of the render target that normalized device coordinates are mapped to, in pixels
+	template<typename T>
+	struct Viewport
+	{
+		T x = static_cast<T>(0), y = static_cast<T>(0);
+		T width = static_cast<T>(1), height = static_cast<T>(1);
+		// Range the depth is mapped to
+		T minDepth = static_cast<T>(0), maxDepth = static_cast<T>(1);
+	};
+
+	// Bit of a clip plane in the clip flags written by ProjectToScreen
+	constexpr uint8_t ClipFlag(FrustumPlane plane) { return static_cast<uint8_t>(1u << static_cast<uint32_t>(plane)); }
+
+	// Projects count points to the screen: transforms them to clip space, divides by w and maps the result to the viewport
+	// Notes:
+	//  - For projections with the Z axis squished into a 0-1 range (ex: Perpective and Orthographic)
+	//  - The screen y axis points down, (viewport.x, viewport.y) being the top left corner
+	//  - screenPoints[i] is { x, y, depth }, clipFlags[i] has the ClipFlag bit of every frustum plane the point is outside of
+	//  - clipFlags can be nullptr, the screen position of points behind the camera (w <= 0) is meaningless
+	//  - Float points are projected Simd::Lanes::width at a time with Simd::Reciprocal for the divide, a few ulp off a true division
+	template<typename T, PackingMode P>
+	void ProjectToScreen(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector3<T, P>* points, size_t count);
+
+	// Same as the Vector3 version, for points with their own w
+	template<typename T, PackingMode P>
+	void ProjectToScreen(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector4<T, P>* points, size_t count);
+
+	// Projects count points to the screen: transforms them to clip space, divides by w and maps the result to the viewport
+	// Notes:
+	//  - For projections with the Z axis squished into a (-1)-1 range (ex: PerpectiveGL and OrthographicGL)
+	//  - The screen y axis points up, (viewport.x, viewport.y) being the bottom left corner
+	//  - Otherwise the same as ProjectToScreen
+	template<typename T, PackingMode P>
+	void ProjectToScreenGL(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector3<T, P>* points, size_t count);
+
+	// Same as the Vector3 version, for points with their own w
+	template<typename T, PackingMode P>
+	void ProjectToScreenGL(Vector3<T, P>* screenPoints, uint8_t* clipFlags, const Matrix4x4<T, P>& viewProjection, const Viewport<T>& viewport,
+		const Vector4<T, P>* points, size_t count);
+
+	using ViewportF32 = Viewport<float>;
+	using ViewportF64 = Viewport<double>;
+}
+
+#include <PWMath/Impl/Viewport.inl>
@@ -0,0 +1,41 @@
+// The PWMath module, import PWMath; instead of including PWMath.h
+// Notes:
+//  - The headers are parsed and their templates checked once, when the module is built, instead of in every file that includes them
+//  - Macros don't cross a module boundary, PWM_USE_*, PWM_ENABLE_STATS and PWM_DEFINE_OSTREAM have to be set on the module target (the CMake options do)
+//  - PWMath.h is included in an export block, so everything in it is exported (Detail too)
+//  - Every standard header PWMath.h includes has to be in the global module fragment first, their include guards then keep them out of the export block
+//  - Like PWMath.h it leaves out BVH.h, KDTree.h, SpatialHashGrid.h and Sphere.h, files using them include the headers instead of importing.
+//    GCC 12 stops with an internal error when a file importing them instantiates their std::optional or std::future uses
+//  - GCC 12 also stops with an internal error on the thread_local counts of Stats.h, build the module without PWM_ENABLE_STATS there
+//  - Built and imported with GCC 12 (-fmodules-ts), the ModuleTest target imports it
+module;
+
+#include <PWMath/Macros.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if PWM_USE_SSE || PWM_USE_F16C
+#include <immintrin.h>
+#endif // PWM_USE_SSE || PWM_USE_F16C
+
+export module PWMath;
+
+export
+{
+#include <PWMath/PWMath.h>
+}
@@ -0,0 +1,6 @@
+// The explicit instantiations the extern templates in PWMath.h refer to, built into the PWMath::Compiled library
+#include <PWMath/PWMath.h>
+
+#define PWM_TEMPLATE template
+#include <PWMath/Impl/Instantiations.inl>
+#undef PWM_TEMPLATE
@@ -1,7 +1,788 @@
 #include <iostream>
 #define PWM_DEFINE_OSTREAM 1
 #include <PWMath/PWMath.h>
+#include <PWMath/BVH.h>
+#include <PWMath/KDTree.h>
 #include <PWMath/Projection.h>
+#include <PWMath/SpatialHashGrid.h>
+#include <PWMath/Sphere.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace PWMath;
+
+namespace
+{
+	int failures = 0;
+
+	// Prints the check if it failed, main returns the number of failed checks
+	void Check(bool passed, const char* description)
+	{
+		if (!passed)
+		{
+			std::cout << "FAILED: " << description << '\n';
+			failures++;
+		}
+	}
+
+	constexpr bool Near(double lhs, double rhs, double tolerance) { return Abs(lhs - rhs) <= tolerance; }
+
+	// Fills count floats in [min, max), seeded so every run checks the same values
+	std::vector<float> RandomFloats(size_t count, float min, float max, uint32_t seed)
+	{
+		std::mt19937 generator{ seed };
+		std::uniform_real_distribution<float> distribution{ min, max };
+		std::vector<float> values(count);
+		for (float& value : values)
+			value = distribution(generator);
+		return values;
+	}
+
+	template<typename T, size_t L, PackingMode P>
+	constexpr bool NearVector(const Vector<T, L, P>& lhs, const Vector<T, L, P>& rhs, double tolerance)
+	{
+		for (size_t i = 0; i < L; i++)
+		{
+			if (!Near(static_cast<double>(lhs[i]), static_cast<double>(rhs[i]), tolerance))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, size_t C, size_t R, PackingMode P>
+	constexpr bool NearMatrix(const Matrix<T, C, R, P>& lhs, const Matrix<T, C, R, P>& rhs, double tolerance)
+	{
+		for (size_t r = 0; r < R; r++)
+		{
+			if (!NearVector(lhs[r], rhs[r], tolerance))
+				return false;
+		}
+		return true;
+	}
+
+	// Angles (two far outside [-pi, pi]) and unit axes for the batch rotations
+	struct RandomRotations
+	{
+		std::vector<float> angles, axisX, axisY, axisZ;
+
+		explicit RandomRotations(size_t count) :
+			angles{ RandomFloats(count, -3.14159265f, 3.14159265f, 4) }, axisX(count), axisY(count), axisZ(count)
+		{
+			angles[0] = 100.0f, angles[1] = -8000.0f;
+			const std::vector<float> axisValues = RandomFloats(3 * count, -1.0f, 1.0f, 5);
+			for (size_t i = 0; i < count; i++)
+			{
+				const Vector3F32 axis = Normalize(Vector3F32{ axisValues[3 * i], axisValues[3 * i + 1], axisValues[3 * i + 2] + 2.0f });
+				axisX[i] = axis.x, axisY[i] = axis.y, axisZ[i] = axis.z;
+			}
+		}
+
+		Vector3Stream<const float> Axes() const { return { axisX.data(), axisY.data(), axisZ.data() }; }
+	};
+
+	// Points in front of the test camera with a radius each, as AoS and SoA, and the boxes around them
+	struct RandomBounds
+	{
+		std::vector<float> values;
+		std::vector<Vector3F32> points;
+		std::vector<float> x, y, z, radii, maxX, maxY, maxZ;
+
+		explicit RandomBounds(size_t count) :
+			values{ RandomFloats(4 * count, -10.0f, 10.0f, 7) }, points(count), x(count), y(count), z(count), radii(count), maxX(count), maxY(count), maxZ(count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				points[i] = Vector3F32{ values[4 * i], values[4 * i + 1], values[4 * i + 2] + 12.0f };
+				x[i] = points[i].x, y[i] = points[i].y, z[i] = points[i].z;
+				radii[i] = std::abs(values[4 * i + 3]) * 0.2f;
+				maxX[i] = x[i] + radii[i], maxY[i] = y[i] + radii[i], maxZ[i] = z[i] + radii[i];
+			}
+		}
+
+		Vector3Stream<const float> Points() const { return { x.data(), y.data(), z.data() }; }
+		Vector3Stream<const float> Maxs() const { return { maxX.data(), maxY.data(), maxZ.data() }; }
+	};
+
+	const PerspectiveProjectionF32 testPerspective = PerspectiveProjectionF32::Create(1.2f, 1.5f, 0.5f, 20.0f);
+	const Matrix4x4F32 testViewProjection = Translate(Matrix4x4F32{ 1.0f }, Vector3F32{ 1.0f, -2.0f, 0.0f }) * testPerspective.ToMatrix();
+
+	// Points spread over a cube, for the acceleration structures
+	std::vector<Vector3F32> RandomPoints(size_t count, float extent, uint32_t seed)
+	{
+		const std::vector<float> values = RandomFloats(3 * count, -extent, extent, seed);
+		std::vector<Vector3F32> points(count);
+		for (size_t i = 0; i < count; i++)
+			points[i] = Vector3F32{ values[3 * i], values[3 * i + 1], values[3 * i + 2] };
+		return points;
+	}
+
+	// The k smallest squared distances from point, by testing every point
+	std::vector<float> NearestDistances2(const std::vector<Vector3F32>& points, const Vector3F32& point, size_t k)
+	{
+		std::vector<float> distances2(points.size());
+		for (size_t i = 0; i < points.size(); i++)
+			distances2[i] = Length2(points[i] - point);
+		std::partial_sort(distances2.begin(), distances2.begin() + k, distances2.end());
+		distances2.resize(k);
+		return distances2;
+	}
+
+	size_t CountInRadius(const std::vector<Vector3F32>& points, const Vector3F32& center, float radius)
+	{
+		size_t inside = 0;
+		for (const Vector3F32& point : points)
+			inside += Length2(point - center) <= radius * radius;
+		return inside;
+	}
+
+	// The brute force distances can be an ulp off the SIMD ones
+	bool DistancesMatch(const std::vector<float>& expected, const float* distances2)
+	{
+		bool matches = true;
+		for (size_t i = 0; i < expected.size(); i++)
+			matches = matches && Near(distances2[i], expected[i], expected[i] * 1e-6);
+		return matches;
+	}
+}
+
+#define CHECK(expression) Check((expression), #expression)
+
+// The float projections, transforms and Sqrt fold at compile time (at runtime they use SIMD and <cmath>)
+constexpr Matrix4x4F32 constantProjection = Perpective(1.57079632f, 1.0f, 0.1f, 1.0f);
+static_assert(Near(constantProjection[0][0], 1.0, 1e-6) && Near(constantProjection[1][1], 1.0, 1e-6) && constantProjection[2][3] == 1.0f);
+static_assert(Near(constantProjection[2][2], 1.0 / 0.9, 1e-6) && Near(constantProjection[3][2], -0.1 / 0.9, 1e-6));
+
+constexpr Vector3F32 constantAxis{ 0.0f, 0.6f, 0.8f };
+constexpr Matrix4x4F32 constantModel = Scale(Rotate(Translate(Matrix4x4F32{ 1.0f }, Vector3F32{ 1.0f, 2.0f, 3.0f }), 0.5f, constantAxis), Vector3F32{ 2.0f, 4.0f, 8.0f });
+static_assert(NearMatrix(constantModel, ComposeTRS(Vector3F32{ 1.0f, 2.0f, 3.0f }, 0.5f, constantAxis, Vector3F32{ 2.0f, 4.0f, 8.0f }), 1e-6));
+
+constexpr Matrix3x3F32 constantNormal = NormalMatrix(constantModel);
+static_assert(NearMatrix(constantNormal, Transpose(Inverse(Matrix3x3F32{ constantModel })), 1e-6));
+static_assert(NearMatrix(Inverse(constantNormal) * constantNormal, Matrix3x3F32{ 1.0f }, 1e-6));
+static_assert(NormalMatrix(Scale(Matrix4x4F32{ 1.0f }, Vector3F32{ 2.0f, 4.0f, 8.0f })) == Matrix3x3F32{ 0.5f, 0.0f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.125f });
+
+static_assert(Sqrt(16.0f) == 4.0f && Sqrt(2.0f) == 1.41421356f && Sqrt(0.0f) == 0.0f);
+
+// Operators that didn't compile once instantiated
+void TestOperators()
+{
+	CHECK((Vector2F32{ 1, 2 } == Vector2F32{ 1, 2 } && !(Vector2F32{ 1, 2 } == Vector2F32{ 1, 3 })));
+	CHECK((Vector3I32{ 1, 2, 3 } == Vector3I32{ 1, 2, 3 } && Vector3I32{ 1, 2, 3 } != Vector3I32{ 1, 2, 4 }));
+	CHECK((Vector4F64{ 1, 2, 3, 4 } == Vector4F64{ 1, 2, 3, 4 } && Vector4F64{ 1, 2, 3, 4 } != Vector4F64{ 1, 2, 3, 5 }));
+	CHECK((Vector<float, 5>{ 1, 2, 3, 4, 5 } == Vector<float, 5>{ 1, 2, 3, 4, 5 } && Vector<float, 5>{ 1, 2, 3, 4, 5 } != Vector<float, 5>{ 1, 2, 3, 4, 6 }));
+
+	const Matrix3x3F32 matrix{ Vector3F32{ 1, 2, 3 }, Vector3F32{ 4, 5, 6 }, Vector3F32{ 7, 8, 10 } };
+	const Matrix3x3F32 negated{ Vector3F32{ -1, -2, -3 }, Vector3F32{ -4, -5, -6 }, Vector3F32{ -7, -8, -10 } };
+	CHECK(matrix == matrix && matrix != negated);
+	CHECK(-matrix == negated);
+	CHECK(Determinant(matrix) == -3.0f && Determinant(matrix) == Dot(matrix[0], Cofactor(matrix)[0]));
+	CHECK(NearMatrix(Inverse(matrix) * matrix, Matrix3x3F32{ 1.0f }, 1e-5));
+	CHECK(Determinant(Matrix3x3Q16{ FixedQ16{ 2 } }) == FixedQ16{ 8 });
+	CHECK(-Matrix2x2I32{ 3 } == Matrix2x2I32{ -3 });
+	CHECK(-Matrix4x4F64{ 2.0 } == Matrix4x4F64{ -2.0 });
+
+	const Matrix<float, 2, 3> rectangle{ Vector2F32{ 1, 2 }, Vector2F32{ 3, 4 }, Vector2F32{ 5, 6 } };
+	CHECK((rectangle == rectangle && -rectangle == rectangle * -1.0f && -rectangle != rectangle));
+
+	Matrix3x3F32 product = matrix;
+	product *= negated;
+	CHECK(product == matrix * negated);
+	product *= 2.0f;
+	CHECK(product == (matrix * negated) * 2.0f);
+
+	Matrix4x4I32 product4{ 2 };
+	product4 *= Matrix4x4I32{ 3 };
+	CHECK(product4 == Matrix4x4I32{ 6 });
+	Matrix2x2F32 product2{ 2.0f };
+	product2 *= 0.5f;
+	CHECK(product2 == Matrix2x2F32{ 1.0f });
+}
+
+void TestFixed()
+{
+	constexpr int32_t max = std::numeric_limits<int32_t>::max(), min = std::numeric_limits<int32_t>::min();
+
+	// Addition, substraction, negation and integer conversion wrap like the integer type (and are constant expressions, so not undefined)
+	constexpr FixedQ16 sum = FixedQ16::FromRaw(max) + FixedQ16::FromRaw(1);
+	constexpr FixedQ16 difference = FixedQ16::FromRaw(min) - FixedQ16::FromRaw(1);
+	constexpr FixedQ16 negated = -FixedQ16::FromRaw(min);
+	constexpr FixedQ16 converted = FixedQ16{ 40000 };
+	CHECK(sum.raw == min);
+	CHECK(difference.raw == max);
+	CHECK(negated.raw == min);
+	CHECK(converted.raw == static_cast<int32_t>(40000u << 16));
+	CHECK((FixedQ32{ 3 } - FixedQ32{ 5 }) == FixedQ32{ -2 });
+
+	// Rotations of fixed point matrices take a fixed point angle, and give the same bits at compile time and at runtime
+	const Vector3Q16 axis{ FixedQ16{ 0 }, FixedQ16{ 0 }, FixedQ16{ 1 } };
+	constexpr Matrix3x3Q16 constantRotation = Rotate(Matrix3x3Q16{ FixedQ16{ 1 } }, FixedQ16{ 0.5 }, Vector3Q16{ FixedQ16{ 0 }, FixedQ16{ 0 }, FixedQ16{ 1 } });
+	const Matrix3x3Q16 rotation = Rotate(Matrix3x3Q16{ FixedQ16{ 1 } }, FixedQ16{ 0.5 }, axis);
+	const Matrix4x4Q16 rotation4 = Rotate(Matrix4x4Q16{ FixedQ16{ 1 } }, FixedQ16{ 0.5 }, axis);
+	const Matrix2x2Q16 rotation2 = Rotate(Matrix2x2Q16{ FixedQ16{ 1 } }, FixedQ16{ 0.5 });
+	CHECK(rotation == constantRotation);
+	CHECK(Near(static_cast<double>(rotation[0][0]), std::cos(0.5), 1e-4) && Near(static_cast<double>(rotation[1][0]), std::sin(0.5), 1e-4));
+	CHECK(rotation4[0][0] == rotation[0][0] && rotation4[1][0] == rotation[1][0] && rotation4[3][3] == FixedQ16{ 1 });
+	CHECK(rotation2[0][0] == rotation[0][0]);
+}
+
+void TestTriangles()
+{
+	// Cross used rhs.z instead of rhs.x for z
+	CHECK((Cross(Vector3F32{ 1, 2, 3 }, Vector3F32{ 4, 5, 6 }) == Vector3F32{ -3, 6, -3 }));
+
+	// The batch tests (SIMD loop and scalar tail) against one scalar test per triangle
+	constexpr size_t triangleCount = 37;
+	const std::vector<float> vertices = RandomFloats(9 * triangleCount, -1.0f, 1.0f, 1);
+	const auto component = [&](size_t index) { return vertices.data() + index * triangleCount; };
+	const TriangleStream<const float> triangles{ { component(0), component(1), component(2) }, { component(3), component(4), component(5) },
+		{ component(6), component(7), component(8) } };
+	const auto vertex = [&](size_t first, size_t i) { return Vector3F32{ component(first)[i], component(first + 1)[i], component(first + 2)[i] }; };
+
+	const std::vector<float> rays = RandomFloats(4 * 64, -1.0f, 1.0f, 2);
+	bool allMatch = true, watertightMatch = true;
+	for (size_t r = 0; r < 64; r++)
+	{
+		const Ray<float> ray{ Vector3F32{ rays[4 * r], rays[4 * r + 1], -3.0f }, Normalize(Vector3F32{ rays[4 * r + 2] * 0.2f, rays[4 * r + 3] * 0.2f, 1.0f }) };
+
+		TriangleHit<float> batchHit{}, watertightHit{}, scalarHit{}, scalarWatertightHit{};
+		const bool batchFound = IntersectNearest(ray, triangles, triangleCount, 100.0f, batchHit);
+		const bool watertightFound = IntersectNearestWatertight(ray, triangles, triangleCount, 100.0f, watertightHit);
+
+		bool scalarFound = false, scalarWatertightFound = false;
+		for (uint32_t i = 0; i < triangleCount; i++)
+		{
+			TriangleHit<float> candidate;
+			if (Intersects(ray, vertex(0, i), vertex(3, i), vertex(6, i), scalarFound ? scalarHit.distance : 100.0f, candidate)
+				&& (!scalarFound || candidate.distance < scalarHit.distance))
+			{
+				scalarHit = candidate;
+				scalarHit.index = i;
+				scalarFound = true;
+			}
+			if (IntersectsWatertight(ray, vertex(0, i), vertex(3, i), vertex(6, i), scalarWatertightFound ? scalarWatertightHit.distance : 100.0f, candidate)
+				&& (!scalarWatertightFound || candidate.distance < scalarWatertightHit.distance))
+			{
+				scalarWatertightHit = candidate;
+				scalarWatertightHit.index = i;
+				scalarWatertightFound = true;
+			}
+		}
+
+		allMatch = allMatch && batchFound == scalarFound && (!batchFound || (batchHit.index == scalarHit.index && Near(batchHit.distance, scalarHit.distance, 1e-5)));
+		// The edge functions are evaluated the same way in both, so the barycentrics match exactly
+		watertightMatch = watertightMatch && watertightFound == scalarWatertightFound && (!watertightFound || (watertightHit.index == scalarWatertightHit.index
+			&& watertightHit.u == scalarWatertightHit.u && watertightHit.v == scalarWatertightHit.v && Near(watertightHit.distance, scalarWatertightHit.distance, 1e-5)));
+	}
+	CHECK(allMatch);
+	CHECK(watertightMatch);
+
+	// A ray through the edge shared by two triangles hits one of them
+	const Ray<float> edgeRay{ Vector3F32{ 0.1f, 0.1f, -1.0f }, Vector3F32{ 0.0f, 0.0f, 1.0f } };
+	TriangleHit<float> edgeHit;
+	CHECK(IntersectsWatertight(edgeRay, Vector3F32{ 0, 0, 0 }, Vector3F32{ 1, 0, 0 }, Vector3F32{ 0, 1, 0 }, 10.0f, edgeHit)
+		|| IntersectsWatertight(edgeRay, Vector3F32{ 0, 0, 0 }, Vector3F32{ 0, 1, 0 }, Vector3F32{ -1, 0, 0 }, 10.0f, edgeHit));
+}
+
+void TestRays()
+{
+	// Boxes in [-4, 4] tested by the batch function (packets and scalar tail) and one at a time
+	constexpr size_t boxCount = 37;
+	const std::vector<float> corners = RandomFloats(6 * boxCount, -4.0f, 4.0f, 3);
+	std::vector<float> minX(boxCount), minY(boxCount), minZ(boxCount), maxX(boxCount), maxY(boxCount), maxZ(boxCount);
+	for (size_t i = 0; i < boxCount; i++)
+	{
+		minX[i] = std::min(corners[6 * i], corners[6 * i + 3]), maxX[i] = std::max(corners[6 * i], corners[6 * i + 3]);
+		minY[i] = std::min(corners[6 * i + 1], corners[6 * i + 4]), maxY[i] = std::max(corners[6 * i + 1], corners[6 * i + 4]);
+		minZ[i] = std::min(corners[6 * i + 2], corners[6 * i + 5]), maxZ[i] = std::max(corners[6 * i + 2], corners[6 * i + 5]);
+	}
+	const Vector3Stream<const float> mins{ minX.data(), minY.data(), minZ.data() }, maxs{ maxX.data(), maxY.data(), maxZ.data() };
+
+	const RayF32 ray{ Vector3F32{ 0.5f, -0.25f, -6.0f }, Normalize(Vector3F32{ 0.1f, 0.05f, 1.0f }) };
+	std::vector<uint32_t> hitIndices(boxCount);
+	std::vector<float> entries(boxCount);
+	const size_t hits = Intersect(ray, mins, maxs, boxCount, 100.0f, hitIndices.data(), entries.data());
+
+	size_t scalarHits = 0;
+	bool boxesMatch = true;
+	for (uint32_t i = 0; i < boxCount; i++)
+	{
+		float entry;
+		if (Intersects(ray, AABBF32{ mins.Get(i), maxs.Get(i) }, 100.0f, entry))
+		{
+			boxesMatch = boxesMatch && scalarHits < hits && hitIndices[scalarHits] == i && entries[scalarHits] == entry;
+			scalarHits++;
+		}
+	}
+	CHECK(hits == scalarHits && hits > 0);
+	CHECK(boxesMatch);
+
+	// A packet of rays against one box
+	std::vector<float> originX(rayPacketSize), originY(rayPacketSize), originZ(rayPacketSize, -6.0f);
+	std::vector<float> inverseX(rayPacketSize), inverseY(rayPacketSize), inverseZ(rayPacketSize), maxDistances(rayPacketSize, 100.0f), packetEntries(rayPacketSize);
+	std::vector<RayF32> packetRays;
+	for (size_t i = 0; i < rayPacketSize; i++)
+	{
+		packetRays.push_back(RayF32{ Vector3F32{ minX[i], maxY[i], -6.0f }, Normalize(Vector3F32{ 0.05f, -0.1f, 1.0f }) });
+		originX[i] = packetRays[i].origin.x, originY[i] = packetRays[i].origin.y;
+		inverseX[i] = packetRays[i].inverseDirection.x, inverseY[i] = packetRays[i].inverseDirection.y, inverseZ[i] = packetRays[i].inverseDirection.z;
+	}
+	const AABBF32 box{ Vector3F32{ -2.0f, -2.0f, -2.0f }, Vector3F32{ 2.0f, 2.0f, 2.0f } };
+	const uint32_t packetBits = IntersectPacket(RayStream<const float>{ { originX.data(), originY.data(), originZ.data() }, { inverseX.data(), inverseY.data(), inverseZ.data() } },
+		box, maxDistances.data(), packetEntries.data());
+
+	bool raysMatch = true;
+	for (size_t i = 0; i < rayPacketSize; i++)
+	{
+		float entry;
+		const bool hit = Intersects(packetRays[i], box, 100.0f, entry);
+		raysMatch = raysMatch && hit == ((packetBits >> i) & 1) && (!hit || packetEntries[i] == entry);
+	}
+	CHECK(raysMatch);
+}
+
+// The batch ComposeTRS (SIMD for floats) against composing each matrix on its own
+void TestComposeTRS()
+{
+	constexpr size_t count = 37;
+	const RandomRotations rotations{ count };
+	const Vector3Stream<const float> axes = rotations.Axes();
+
+	// Non-uniform scales, so the normal matrices below go through the inverse
+	const std::vector<float> scaleValues = RandomFloats(3 * count, 0.5f, 2.0f, 6);
+	std::vector<float> scaleX(count), scaleY(count), scaleZ(count);
+	for (size_t i = 0; i < count; i++)
+		scaleX[i] = scaleValues[3 * i], scaleY[i] = scaleValues[3 * i + 1], scaleZ[i] = scaleValues[3 * i + 2];
+	const Vector3Stream<const float> scales{ scaleX.data(), scaleY.data(), scaleZ.data() };
+
+	std::vector<Matrix4x4F32> composed(count);
+	ComposeTRS(composed.data(), Vector3Stream<const float>{ scaleZ.data(), scaleX.data(), scaleY.data() }, rotations.angles.data(), axes, scales, count);
+
+	bool composedMatch = true;
+	for (size_t i = 0; i < count; i++)
+		composedMatch = composedMatch && NearMatrix(composed[i], ComposeTRS(Vector3F32{ scaleZ[i], scaleX[i], scaleY[i] }, rotations.angles[i], axes.Get(i), scales.Get(i)), 1e-5);
+	CHECK(composedMatch);
+}
+
+// The batch NormalMatrix against the single one, with and without a uniform scale
+void TestNormalMatrix()
+{
+	constexpr size_t count = 37;
+	const RandomRotations rotations{ count };
+	const std::vector<float> scaleValues = RandomFloats(3 * count, 0.5f, 2.0f, 6);
+
+	std::vector<Matrix4x4F32> composed(count), rotated(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const Vector3F32 axis = rotations.Axes().Get(i);
+		composed[i] = ComposeTRS(Vector3F32{ 1.0f, -2.0f, 3.0f }, rotations.angles[i], axis, Vector3F32{ scaleValues[3 * i], scaleValues[3 * i + 1], scaleValues[3 * i + 2] });
+		rotated[i] = Rotate(Matrix4x4F32{ 1.0f }, rotations.angles[i], axis);
+	}
+
+	// Non-uniform scales go through the inverse, the rotations alone take the uniform scale shortcut
+	std::vector<Matrix3x3F32> normalMatrices(count), rotationNormalMatrices(count);
+	NormalMatrix(normalMatrices.data(), composed.data(), count);
+	NormalMatrix(rotationNormalMatrices.data(), rotated.data(), count);
+
+	bool normalMatch = true;
+	for (size_t i = 0; i < count; i++)
+		normalMatch = normalMatch && NearMatrix(normalMatrices[i], NormalMatrix(composed[i]), 1e-5) && NearMatrix(rotationNormalMatrices[i], NormalMatrix(rotated[i]), 1e-6);
+	CHECK(normalMatch);
+}
+
+// The batch culling against testing each sphere and box on its own
+void TestCulling()
+{
+	constexpr size_t count = 37;
+	const RandomBounds bounds{ count };
+	const FrustumF32 frustum = ExtractFrustum(testViewProjection);
+
+	std::vector<uint32_t> visibleSpheres(count), visibleBoxes(count);
+	const size_t sphereCount = CullSpheres(frustum, bounds.Points(), bounds.radii.data(), count, visibleSpheres.data());
+	const size_t boxCount = CullBoxes(frustum, bounds.Points(), bounds.Maxs(), count, visibleBoxes.data());
+
+	std::vector<uint32_t> expectedSpheres, expectedBoxes;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (Intersects(frustum, bounds.points[i], bounds.radii[i]))
+			expectedSpheres.push_back(i);
+		if (Intersects(frustum, AABBF32{ bounds.points[i], bounds.Maxs().Get(i) }))
+			expectedBoxes.push_back(i);
+	}
+	CHECK(std::vector<uint32_t>(visibleSpheres.begin(), visibleSpheres.begin() + sphereCount) == expectedSpheres);
+	CHECK(std::vector<uint32_t>(visibleBoxes.begin(), visibleBoxes.begin() + boxCount) == expectedBoxes);
+	CHECK(!expectedSpheres.empty() && expectedSpheres.size() < count);
+}
+
+// The batch box transforms, AoS and SoA, against transforming each box on its own
+void TestBoxTransforms()
+{
+	constexpr size_t count = 37;
+	const RandomBounds bounds{ count };
+	std::vector<AABBF32> boxes(count), transformedBoxes(count);
+	std::vector<Matrix4x4F32> matrices(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		boxes[i] = AABBF32{ bounds.points[i], bounds.Maxs().Get(i) };
+		matrices[i] = ComposeTRS(Vector3F32{ bounds.radii[i], 1.0f, -2.0f }, bounds.values[4 * i + 3], Normalize(Vector3F32{ 1.0f, 2.0f, 3.0f }), Vector3F32{ 1.0f, 2.0f, 0.5f });
+	}
+
+	std::vector<float> outMinX(count), outMinY(count), outMinZ(count), outMaxX(count), outMaxY(count), outMaxZ(count);
+	Transform(transformedBoxes.data(), boxes.data(), matrices.data(), count);
+	Transform<float, PackingMode::Default>(Vector3Stream<float>{ outMinX.data(), outMinY.data(), outMinZ.data() }, Vector3Stream<float>{ outMaxX.data(), outMaxY.data(), outMaxZ.data() },
+		bounds.Points(), bounds.Maxs(), matrices.data(), count);
+
+	bool boxesMatch = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		const AABBF32 expected = Transform(boxes[i], matrices[i]);
+		boxesMatch = boxesMatch && NearVector(transformedBoxes[i].min, expected.min, 1e-4) && NearVector(transformedBoxes[i].max, expected.max, 1e-4)
+			&& NearVector(Vector3F32{ outMinX[i], outMinY[i], outMinZ[i] }, expected.min, 1e-4) && NearVector(Vector3F32{ outMaxX[i], outMaxY[i], outMaxZ[i] }, expected.max, 1e-4);
+	}
+	CHECK(boxesMatch);
+}
+
+// The BVH against testing every box, count past BVHBuilder::parallelBinningSize also bins and builds subtrees in parallel
+void TestBVH(size_t count)
+{
+	const std::vector<Vector3F32> points = RandomPoints(count, 20.0f, 8);
+	const std::vector<float> sizes = RandomFloats(count, 0.0f, 1.0f, 9);
+	std::vector<AABBF32> boxes(count);
+	for (size_t i = 0; i < count; i++)
+		boxes[i] = AABBF32{ points[i] - Vector3F32{ sizes[i], sizes[i], sizes[i] }, points[i] + Vector3F32{ sizes[i], sizes[i], sizes[i] } };
+
+	BVHF32 bvh = BuildBVH(boxes.data(), count);
+	const RayF32 ray{ Vector3F32{ -30.0f, 0.5f, 0.25f }, Normalize(points[7] - Vector3F32{ -30.0f, 0.5f, 0.25f }) };
+	const auto nearestBox = [&](const std::vector<AABBF32>& testedBoxes)
+	{
+		uint32_t nearest = UINT32_MAX;
+		float nearestDistance = 100.0f;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			float entry;
+			if (Intersects(ray, testedBoxes[i], nearestDistance, entry) && entry < nearestDistance)
+				nearest = i, nearestDistance = entry;
+		}
+		return nearest;
+	};
+	const auto bvhNearest = [&](const std::vector<AABBF32>& testedBoxes)
+	{
+		uint32_t nearest = UINT32_MAX;
+		Intersect(bvh, ray, 100.0f, [&](uint32_t index, float& maxDistance)
+		{
+			float entry;
+			if (!Intersects(ray, testedBoxes[index], maxDistance, entry) || (entry == maxDistance && index > nearest))
+				return false;
+			nearest = index, maxDistance = entry;
+			return true;
+		});
+		return nearest;
+	};
+	const AABBF32 queryBox{ Vector3F32{ -5.0f, -5.0f, -5.0f }, Vector3F32{ 5.0f, 5.0f, 5.0f } };
+	const auto queryMatches = [&](const std::vector<AABBF32>& testedBoxes)
+	{
+		std::vector<bool> reported(count, false);
+		Query(bvh, queryBox, [&](uint32_t index) { reported[index] = true; });
+		bool matches = true;
+		for (size_t i = 0; i < count; i++)
+			matches = matches && (reported[i] || !Intersects(queryBox, testedBoxes[i]));
+		return matches;
+	};
+	CHECK(nearestBox(boxes) != UINT32_MAX && bvhNearest(boxes) == nearestBox(boxes));
+	CHECK(queryMatches(boxes));
+
+	std::vector<AABBF32> movedBoxes = boxes;
+	for (size_t i = 0; i < count; i++)
+		movedBoxes[i] = AABBF32{ boxes[i].min * 0.5f, boxes[i].max * 0.5f };
+	Refit(bvh, movedBoxes.data());
+	CHECK(bvhNearest(movedBoxes) == nearestBox(movedBoxes));
+	CHECK(queryMatches(movedBoxes));
+}
+
+// The sphere fits contain every point
+void TestBoundingSpheres()
+{
+	constexpr size_t count = 500;
+	const std::vector<Vector3F32> points = RandomPoints(count, 20.0f, 8);
+	const SphereF32 spheres[] = { BoundingSphereCentroid(points.data(), count), BoundingSphereRitter(points.data(), count), BoundingSphereEPOS(points.data(), count) };
+	bool spheresContain = true;
+	for (const SphereF32& sphere : spheres)
+	{
+		for (const Vector3F32& point : points)
+			spheresContain = spheresContain && Length(point - sphere.center) <= sphere.radius * 1.000001f;
+	}
+	CHECK(spheresContain);
+}
+
+// The hash grid's nearest points and points in a radius against testing every point.
+// count past hashGridParallelSize counts and scatters in parallel
+void TestSpatialHashGrid(size_t count)
+{
+	constexpr size_t queryCount = 16, k = 5;
+	constexpr float radius = 4.0f;
+	const std::vector<Vector3F32> points = RandomPoints(count, 20.0f, 8), queries = RandomPoints(queryCount, 20.0f, 10);
+	SpatialHashGridF32 grid;
+	Rebuild(grid, points.data(), count, radius);
+
+	// Every point is in its own cell's bucket, in input order whatever the thread count
+	bool bucketsMatch = grid.bucketStarts.front() == 0 && grid.bucketStarts.back() == count;
+	for (size_t bucket = 0; bucket < grid.BucketCount(); bucket++)
+	{
+		for (uint32_t sorted = grid.bucketStarts[bucket]; sorted < grid.bucketStarts[bucket + 1]; sorted++)
+		{
+			const Vector3F32& point = points[grid.pointIndices[sorted]];
+			bucketsMatch = bucketsMatch && (sorted == grid.bucketStarts[bucket] || grid.pointIndices[sorted - 1] < grid.pointIndices[sorted]) && point == grid.Points().Get(sorted)
+				&& Detail::HashCell(Detail::CellCoordinate(point.x, 1.0f / radius), Detail::CellCoordinate(point.y, 1.0f / radius), Detail::CellCoordinate(point.z, 1.0f / radius),
+					static_cast<uint32_t>(grid.BucketCount() - 1)) == bucket;
+		}
+	}
+	CHECK(bucketsMatch);
+
+	bool gridMatch = true;
+	for (const Vector3F32& query : queries)
+	{
+		uint32_t indices[k];
+		float distances2[k];
+		size_t inside = 0;
+		const bool found = QueryNearest(grid, query, k, std::numeric_limits<float>::infinity(), indices, distances2) == k;
+		QueryRadius(grid, query, radius, [&](uint32_t, float) { inside++; });
+		gridMatch = gridMatch && found && DistancesMatch(NearestDistances2(points, query, k), distances2) && inside == CountInRadius(points, query, radius);
+	}
+	CHECK(gridMatch);
+}
+
+// The k-d tree's nearest points, single and batched, and points in a radius against testing every point.
+// count past kdTreeParallelBuildSize builds subtrees in parallel
+void TestKDTree(size_t count)
+{
+	constexpr size_t queryCount = 16, k = 5;
+	constexpr float radius = 4.0f;
+	const std::vector<Vector3F32> points = RandomPoints(count, 20.0f, 8), queries = RandomPoints(queryCount, 20.0f, 10);
+	const KDTree3F32 tree = BuildKDTree(points.data(), count);
+
+	std::vector<uint32_t> batchIndices(queryCount * k), batchCounts(queryCount);
+	std::vector<float> batchDistances2(queryCount * k);
+	QueryNearest(tree, queries.data(), queryCount, k, 1000.0f, batchIndices.data(), batchDistances2.data(), batchCounts.data());
+
+	bool treeMatch = true;
+	for (size_t q = 0; q < queryCount; q++)
+	{
+		uint32_t indices[k];
+		float distances2[k];
+		size_t inside = 0;
+		const bool found = QueryNearest(tree, queries[q], k, 1000.0f, indices, distances2) == k;
+		QueryRadius(tree, queries[q], radius, [&](uint32_t, float) { inside++; });
+		treeMatch = treeMatch && found && DistancesMatch(NearestDistances2(points, queries[q], k), distances2) && inside == CountInRadius(points, queries[q], radius)
+			&& batchCounts[q] == k && std::equal(distances2, distances2 + k, batchDistances2.begin() + q * k) && std::equal(indices, indices + k, batchIndices.begin() + q * k);
+	}
+	CHECK(treeMatch);
+}
+
+// Floats (SIMD with an approximate reciprocal) against doubles (scalar)
+void TestProjectToScreen()
+{
+	constexpr size_t count = 37;
+	const RandomBounds bounds{ count };
+	const Matrix4x4F64 viewProjection64 = testViewProjection;
+	std::vector<Vector3F32> screenPoints(count);
+	std::vector<Vector3F64> points64(bounds.points.begin(), bounds.points.end()), screenPoints64(count);
+	std::vector<uint8_t> clipFlags(count), clipFlags64(count);
+	ProjectToScreen(screenPoints.data(), clipFlags.data(), testViewProjection, ViewportF32{ 0, 0, 640, 480, 0, 1 }, bounds.points.data(), count);
+	ProjectToScreen(screenPoints64.data(), clipFlags64.data(), viewProjection64, ViewportF64{ 0, 0, 640, 480, 0, 1 }, points64.data(), count);
+
+	bool screenMatch = true;
+	for (size_t i = 0; i < count; i++)
+		screenMatch = screenMatch && clipFlags[i] == clipFlags64[i] && (clipFlags[i] != 0 || NearVector(Vector3F64{ screenPoints[i] }, screenPoints64[i], 1e-3));
+	CHECK(screenMatch);
+}
+
+// Compile time swizzles against the runtime index version
+void TestSwizzles()
+{
+	const Vector4F32Fast fast{ 1.0f, 2.0f, 3.0f, 4.0f };
+	const Vector4F32 packed{ 1.0f, 2.0f, 3.0f, 4.0f };
+	CHECK((fast.Swizzle<3, 1, 0, 2>() == fast.Swizzle(3, 1, 0, 2) && packed.Swizzle<3, 1, 0, 2>() == packed.Swizzle(3, 1, 0, 2)));
+	CHECK((fast.wzyx() == Vector4F32Fast{ 4.0f, 3.0f, 2.0f, 1.0f } && fast.Swizzle<0, 0, 3>() == Vector3<float, PackingMode::Fast>{ 1.0f, 1.0f, 4.0f }));
+
+	Vector3F32 vector{ 1.0f, 2.0f, 3.0f };
+	CHECK((vector.zxy() == Vector3F32{ 3.0f, 1.0f, 2.0f } && vector.xz() == Vector2F32{ 1.0f, 3.0f }));
+	vector.SwizzleRef<2, 0>() = Vector2F32{ 5.0f, 6.0f };
+	CHECK((vector == Vector3F32{ 6.0f, 2.0f, 5.0f }));
+	vector.SwizzleRef<1>() += Vector<float, 1>{ 1.0f };
+	CHECK(vector.y == 3.0f);
+}
+
+// The batch projections, AoS, Vector4 and SoA, against projecting each point on its own
+void TestProject()
+{
+	constexpr size_t count = 37;
+	const RandomBounds bounds{ count };
+	std::vector<Vector4F32> points4(count), clipPoints(count), clipPoints4(count);
+	for (size_t i = 0; i < count; i++)
+		points4[i] = Vector4F32{ bounds.x[i], bounds.y[i], bounds.z[i], 1.0f };
+
+	std::vector<float> clipX(count), clipY(count), clipZ(count), clipW(count);
+	Project(clipPoints.data(), bounds.points.data(), testPerspective, count);
+	Project(clipPoints4.data(), points4.data(), testPerspective, count);
+	Project(Vector4Stream<float>{ clipX.data(), clipY.data(), clipZ.data(), clipW.data() }, bounds.Points(), testPerspective, count);
+
+	bool projectMatch = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		const Vector4F32 expected = Project(bounds.points[i], testPerspective);
+		projectMatch = projectMatch && NearVector(clipPoints[i], expected, 1e-5) && NearVector(clipPoints4[i], expected, 1e-5)
+			&& NearVector(Vector4F32{ clipX[i], clipY[i], clipZ[i], clipW[i] }, expected, 1e-5);
+	}
+	CHECK(projectMatch);
+}
+
+// The batch fixed point dot products and the Fast vectors against the packed ones
+void TestFixedBatch()
+{
+	constexpr size_t count = 37;
+	const std::vector<float> values = RandomFloats(6 * count, -100.0f, 100.0f, 11);
+	std::vector<FixedQ16> fixed(values.begin(), values.end()), dots(count);
+	const auto component = [&](size_t index) { return fixed.data() + index * count; };
+	const Vector3Stream<const FixedQ16> lhs{ component(0), component(1), component(2) }, rhs{ component(3), component(4), component(5) };
+	Dot(dots.data(), lhs, rhs, count);
+	bool dotsMatch = true;
+	for (size_t i = 0; i < count; i++)
+		dotsMatch = dotsMatch && dots[i] == Dot(lhs.Get(i), rhs.Get(i));
+	CHECK(dotsMatch);
+
+	const Vector4Q16Fast fastLhs{ fixed[0], fixed[1], fixed[2], fixed[3] }, fastRhs{ fixed[4], fixed[5], fixed[6], fixed[7] };
+	const Vector4Q16 packedLhs{ fixed[0], fixed[1], fixed[2], fixed[3] }, packedRhs{ fixed[4], fixed[5], fixed[6], fixed[7] };
+	CHECK(Dot(fastLhs, fastRhs) == Dot(packedLhs, packedRhs) && Vector4Q16{ fastLhs * fastRhs } == packedLhs * packedRhs);
+}
+
+// Half precision against known bit patterns, and the batch conversions against converting one value at a time
+void TestHalf()
+{
+	constexpr size_t count = 37;
+	CHECK(Half{ 65504.0f }.bits == 0x7bff && Half{ 1e6f }.bits == 0x7c00 && Half{ 1.0f }.bits == 0x3c00 && static_cast<float>(Half::FromBits(0x0001)) == std::ldexp(1.0f, -24));
+	std::vector<float> floats = RandomFloats(count, -70000.0f, 70000.0f, 12), roundTrip(count);
+	floats[0] = 1e-6f, floats[1] = -0.0f, floats[2] = std::numeric_limits<float>::infinity();
+	std::vector<Half> halves(count);
+	Convert(halves.data(), floats.data(), count);
+	Convert(roundTrip.data(), halves.data(), count);
+	bool halvesMatch = true;
+	for (size_t i = 0; i < count; i++)
+		halvesMatch = halvesMatch && halves[i].bits == Half{ floats[i] }.bits && roundTrip[i] == static_cast<float>(halves[i]);
+	CHECK(halvesMatch);
+}
+
+// The batch normal encodings against the single ones and their angle error bounds
+void TestNormalEncodings()
+{
+	constexpr size_t count = 37;
+	const std::vector<float> directions = RandomFloats(3 * count, -1.0f, 1.0f, 13);
+	std::vector<Vector3F32> normals(count), decoded(count);
+	for (size_t i = 0; i < count; i++)
+		normals[i] = Normalize(Vector3F32{ directions[3 * i], directions[3 * i + 1], directions[3 * i + 2] });
+	// The angle is measured in double, a float dot product can't resolve the 0.0015 degree bounds
+	const auto angle = [](const Vector3F64& lhs, const Vector3F64& rhs) { return std::atan2(Length(Cross(lhs, rhs)), Dot(lhs, rhs)) * 57.2957795; };
+	const auto encodingsMatch = [&]<typename TEncoded>(TEncoded, double maxError)
+	{
+		std::vector<TEncoded> encoded(count);
+		Encode(encoded.data(), normals.data(), count);
+		Decode(decoded.data(), encoded.data(), count);
+		bool matches = true;
+		for (size_t i = 0; i < count; i++)
+			matches = matches && encoded[i] == TEncoded::Encode(normals[i]) && decoded[i] == encoded[i].Decode() && angle(Vector3F64{ decoded[i] }, Vector3F64{ normals[i] }) <= maxError;
+		return matches;
+	};
+	CHECK(encodingsMatch(OctahedralNormal16{}, 0.004));
+	CHECK(encodingsMatch(OctahedralNormal8{}, 0.96));
+	CHECK(encodingsMatch(SnormNormal16{}, 0.0015));
+	CHECK(encodingsMatch(PackedNormal1010102{}, 0.1));
+}
+
+// Every 8-bit colour goes through decoding and encoding unchanged, and the batch curves match the single ones
+void TestColors()
+{
+	std::vector<Vector4<uint8_t>> colors8(256), encoded8(256);
+	std::vector<Vector4F32> decodedColors(256), curved(256);
+	for (size_t i = 0; i < 256; i++)
+		colors8[i] = Vector4<uint8_t>{ static_cast<uint8_t>(i), static_cast<uint8_t>(255 - i), static_cast<uint8_t>(i * 7), static_cast<uint8_t>(i) };
+	bool colorsMatch = true;
+	for (ColorSpace space : { ColorSpace::Linear, ColorSpace::Srgb })
+	{
+		DecodeColors(decodedColors.data(), colors8.data(), 256, space);
+		EncodeColors(encoded8.data(), decodedColors.data(), 256, space);
+		colorsMatch = colorsMatch && encoded8 == colors8;
+		for (size_t i = 0; i < 256; i++)
+		{
+			// The sRGB table is computed from i / 255 in double, so it can be an ulp off SrgbToLinear of the rounded float
+			const float expected = space == ColorSpace::Srgb ? SrgbToLinear(colors8[i].x / 255.0f) : colors8[i].x * (1.0f / 255.0f);
+			colorsMatch = colorsMatch && Near(decodedColors[i].x, expected, expected * 1e-6) && decodedColors[i].w == colors8[i].w * (1.0f / 255.0f);
+		}
+	}
+	CHECK(colorsMatch);
+
+	bool curvesMatch = true;
+	for (size_t i = 0; i < 256; i++)
+		curved[i] = Vector4F32{ i / 255.0f, 1.0f - i / 255.0f, i / 510.0f, 0.5f };
+	std::vector<Vector4F32> linear = curved;
+	SrgbToLinear(linear.data(), 256);
+	std::vector<Vector4F32> srgb = linear;
+	LinearToSrgb(srgb.data(), 256);
+	for (size_t i = 0; i < 256; i++)
+	{
+		for (size_t c = 0; c < 3; c++)
+		{
+			curvesMatch = curvesMatch && Near(linear[i][c], SrgbToLinear(curved[i][c]), 1e-6 * SrgbToLinear(curved[i][c]) + 1e-12)
+				&& Near(srgb[i][c], LinearToSrgb(linear[i][c]), 1e-6);
+		}
+		curvesMatch = curvesMatch && linear[i].w == 0.5f && srgb[i].w == 0.5f;
+	}
+	CHECK(curvesMatch);
+
+	std::vector<Vector4F32> premultiplied = curved;
+	PremultiplyAlpha(premultiplied.data(), 256);
+	CHECK((premultiplied[255] == Vector4F32{ 0.5f, 0.0f, 0.25f, 0.5f }));
+	UnpremultiplyAlpha(premultiplied.data(), 256);
+	CHECK(NearVector(premultiplied[100], curved[100], 1e-6));
+}
+
+// The batch SinCos and rotations (SIMD for floats) against building each matrix on its own
+void TestBatchRotations()
+{
+	constexpr size_t count = 37;
+	const RandomRotations rotations{ count };
+	const std::vector<float>& angles = rotations.angles;
+	const Vector3Stream<const float> axes = rotations.Axes();
+
+	std::vector<float> sines(count), cosines(count);
+	SinCos(sines.data(), cosines.data(), angles.data(), count);
+	bool sinCosMatch = true;
+	for (size_t i = 0; i < count; i++)
+		sinCosMatch = sinCosMatch && Near(sines[i], std::sin(static_cast<double>(angles[i])), 2e-7) && Near(cosines[i], std::cos(static_cast<double>(angles[i])), 2e-7);
+	CHECK(sinCosMatch);
+
+	std::vector<Matrix2x2F32> rotations2(count);
+	std::vector<Matrix3x3F32> rotations3(count), axisRotations3(count);
+	std::vector<Matrix4x4F32> rotations4(count), rotated4(count, Matrix4x4F32{ 2.0f });
+	MakeRotation(rotations2.data(), angles.data(), count);
+	MakeRotation(rotations3.data(), angles.data(), count);
+	MakeRotation(axisRotations3.data(), angles.data(), axes, count);
+	MakeRotation(rotations4.data(), angles.data(), axes, count);
+	Rotate(rotated4.data(), angles.data(), axes, count);
+
+	bool rotationsMatch = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		rotationsMatch = rotationsMatch && NearMatrix(rotations2[i], Rotate(Matrix2x2F32{ 1.0f }, angles[i]), 1e-6)
+			&& NearMatrix(rotations3[i], Rotate(Matrix3x3F32{ 1.0f }, angles[i]), 1e-6)
+			&& NearMatrix(axisRotations3[i], Rotate(Matrix3x3F32{ 1.0f }, angles[i], axes.Get(i)), 1e-6)
+			&& NearMatrix(rotations4[i], Rotate(Matrix4x4F32{ 1.0f }, angles[i], axes.Get(i)), 1e-6)
+			&& NearMatrix(rotated4[i], Rotate(Matrix4x4F32{ 2.0f }, angles[i], axes.Get(i)), 2e-6);
+	}
+	CHECK(rotationsMatch);
+}
 
 int main()
 {
@@ -14,5 +795,30 @@ int main()
 
 	std::cout << pos << '\n';
 
-	return 0;
+	TestOperators();
+	TestFixed();
+	TestTriangles();
+	TestRays();
+	TestComposeTRS();
+	TestNormalMatrix();
+	TestCulling();
+	TestBoxTransforms();
+	TestBVH(500);
+	TestBVH(size_t{ 1 } << 17);
+	TestBoundingSpheres();
+	TestSpatialHashGrid(500);
+	TestSpatialHashGrid(size_t{ 1 } << 17);
+	TestKDTree(500);
+	TestKDTree(size_t{ 1 } << 17);
+	TestProjectToScreen();
+	TestSwizzles();
+	TestProject();
+	TestFixedBatch();
+	TestHalf();
+	TestNormalEncodings();
+	TestColors();
+	TestBatchRotations();
+
+	std::cout << (failures == 0 ? "All checks passed" : "Some checks failed") << '\n';
+	return failures;
 }
@@ -0,0 +1,49 @@
+#include <iostream>
+
+import PWMath;
+
+using namespace PWMath;
+
+namespace
+{
+	int failures = 0;
+
+	// Prints the check if it failed, main returns the number of failed checks
+	void Check(bool passed, const char* description)
+	{
+		if (!passed)
+		{
+			std::cout << "FAILED: " << description << '\n';
+			failures++;
+		}
+	}
+}
+
+#define CHECK(expression) Check((expression), #expression)
+
+// Uses a bit of every header in PWMath.h through import PWMath; instead of the includes, the math itself is checked by the Test program
+int main()
+{
+	static_assert(Sqrt(16.0f) == 4.0f);
+	CHECK((Normalize(Vector3F32{ 3.0f, 0.0f, 4.0f }) == Vector3F32{ 0.6f, 0.0f, 0.8f }));
+
+	const Matrix4x4F32 model = ComposeTRS(Vector3F32{ 1.0f, 2.0f, 3.0f }, 0.0f, Vector3F32{ 0.0f, 0.0f, 1.0f }, Vector3F32{ 2.0f, 2.0f, 2.0f });
+	CHECK((Vector4F32{ 1.0f, 1.0f, 1.0f, 1.0f } * model == Vector4F32{ 4.0f, 6.0f, 8.0f, 1.0f }));
+	CHECK((NormalMatrix(model) == Matrix3x3F32{ 0.5f }));
+
+	const Matrix4x4F32 viewProjection = Perpective(1.2f, 1.5f, 0.5f, 20.0f);
+	Vector3F32 screenPoint;
+	uint8_t clipFlags;
+	const Vector3F32 point{ 0.0f, 0.0f, 5.0f };
+	ProjectToScreen(&screenPoint, &clipFlags, viewProjection, ViewportF32{ 0, 0, 640, 480, 0, 1 }, &point, 1);
+	CHECK(clipFlags == 0 && screenPoint.x == 320.0f && screenPoint.y == 240.0f);
+	CHECK(Intersects(ExtractFrustum(viewProjection), point, 1.0f));
+
+	CHECK(Half{ 1.0f }.bits == 0x3c00 && static_cast<float>(FixedQ16{ 2.5f }) == 2.5f);
+	CHECK((OctahedralNormal16::Encode(Vector3F32{ 0.0f, 0.0f, 1.0f }).Decode() == Vector3F32{ 0.0f, 0.0f, 1.0f }));
+
+	CHECK((GetStats()[Stat::Normalize] != 0) == statsEnabled);
+
+	std::cout << (failures == 0 ? "All checks passed" : "Some checks failed") << '\n';
+	return failures;
+}
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <PWMath/PWMath.h>
+
+#include <thread>
+
+static_assert(PWMath::statsEnabled, "StatsTest is built with PWM_ENABLE_STATS=1");
+
+using namespace PWMath;
+
+namespace
+{
+	int failures = 0;
+
+	// Prints the check if it failed, main returns the number of failed checks
+	void Check(bool passed, const char* description)
+	{
+		if (!passed)
+		{
+			std::cout << "FAILED: " << description << '\n';
+			failures++;
+		}
+	}
+}
+
+#define CHECK(expression) Check((expression), #expression)
+
+// The counts of GetStats, built with PWM_ENABLE_STATS=1 (the Test program checks the math without it)
+int main()
+{
+	const StatsSnapshot start = GetStats();
+
+	// Degenerate inputs are counted along with the operation
+	volatile float zero = 0.0f;
+	const Vector3F32 normalized = Normalize(Vector3F32{ 3.0f, 0.0f, 4.0f });
+	const Vector3F32 zeroLength = Normalize(Vector3F32{ zero, zero, zero });
+	const Matrix3x3F32 singular{ 1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 0.0f, 1.0f, 1.0f };
+	const float determinant = Determinant(singular);
+	const Matrix3x3F32 inverse = Inverse(singular);
+	const float invertible = Determinant(Matrix3x3F32{ 2.0f });
+	CHECK(normalized.x == 0.6f && zeroLength.x != zeroLength.x && determinant == 0.0f && inverse[0][0] != 0.0f && invertible == 8.0f);
+
+	const StatsSnapshot single = GetStats() - start;
+	CHECK(single[Stat::Normalize] == 2 && single[Stat::NormalizeZeroLength] == 1);
+	CHECK(single[Stat::Determinant] == 2 && single[Stat::SingularDeterminant] == 1);
+	CHECK(single[Stat::Inverse] == 1 && single[Stat::SingularInverse] == 1);
+
+	// Counts from another thread, both while it runs and after it has exited
+	const StatsSnapshot beforeThread = GetStats();
+	bool countedWhileRunning = false;
+	std::thread thread{ [&]()
+	{
+		for (int i = 0; i < 100; i++)
+			Normalize(Vector2F32{ static_cast<float>(i), zero });
+		countedWhileRunning = (GetStats() - beforeThread)[Stat::Normalize] == 100;
+	} };
+	thread.join();
+	const StatsSnapshot threaded = GetStats() - beforeThread;
+	CHECK(countedWhileRunning);
+	CHECK(threaded[Stat::Normalize] == 100 && threaded[Stat::NormalizeZeroLength] == 1 && threaded[Stat::Determinant] == 0);
+
+	// A difference only holds what happened between its snapshots
+	const StatsSnapshot total = GetStats() - start;
+	CHECK(total[Stat::Normalize] == 102 && total[Stat::NormalizeZeroLength] == 2 && total[Stat::SingularInverse] == 1);
+	CHECK((GetStats() - GetStats())[Stat::Normalize] == 0);
+
+	std::cout << (failures == 0 ? "All checks passed" : "Some checks failed") << '\n';
+	return failures;
+}